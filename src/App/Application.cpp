@@ -515,6 +515,7 @@ Document* Application::newDocument(const char * Name, const char * UserName, boo
     _pActiveDoc->signalDeletedObject.connect(std::bind(&App::Application::slotDeletedObject, this, sp::_1));
     _pActiveDoc->signalBeforeChangeObject.connect(std::bind(&App::Application::slotBeforeChangeObject, this, sp::_1, sp::_2));
     _pActiveDoc->signalChangedObject.connect(std::bind(&App::Application::slotChangedObject, this, sp::_1, sp::_2));
+    _pActiveDoc->signalChangedObjectCoalesced.connect(std::bind(&App::Application::slotChangedObjectCoalesced, this, sp::_1, sp::_2));
     _pActiveDoc->signalRelabelObject.connect(std::bind(&App::Application::slotRelabelObject, this, sp::_1));
     _pActiveDoc->signalActivatedObject.connect(std::bind(&App::Application::slotActivatedObject, this, sp::_1));
     _pActiveDoc->signalUndo.connect(std::bind(&App::Application::slotUndoDocument, this, sp::_1));
@@ -1615,6 +1616,11 @@ void Application::slotChangedObject(const App::DocumentObject&O, const App::Prop
     this->signalChangedObject(O,P);
 }
 
+void Application::slotChangedObjectCoalesced(const App::DocumentObject&O, const App::Property& P)
+{
+    this->signalChangedObjectCoalesced(O,P);
+}
+
 void Application::slotRelabelObject(const App::DocumentObject&O)
 {
     this->signalRelabelObject(O);
@@ -2132,6 +2138,7 @@ void Application::initTypes()
     App::FeatureTestAbsAddress     ::init();
     App::FeatureTestPlacement      ::init();
     App::FeatureTestAttribute      ::init();
+    App::FeatureTestRestoring      ::init();
 
     // Feature class
     App::FeaturePython             ::init();
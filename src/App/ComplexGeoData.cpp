@@ -226,6 +226,14 @@ size_t ComplexGeoData::getElementMapSize(bool flush) const
     return _elementMap ? _elementMap->size() : 0;
 }
 
+size_t ComplexGeoData::getElementMapMemSize(bool flush) const
+{
+    if (flush) {
+        flushElementMap();
+    }
+    return _elementMap ? _elementMap->getMemSize() : 0;
+}
+
 MappedName ComplexGeoData::getMappedName(const IndexedName& element,
                                          bool allowUnmapped,
                                          ElementIDRefs* sid) const
@@ -659,12 +667,7 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
 
 unsigned int ComplexGeoData::getMemSize() const
 {
-    flushElementMap();
-    if (_elementMap) {
-        static const int multiplier {10};
-        return _elementMap->size() * multiplier;
-    }
-    return 0;
+    return getElementMapMemSize();
 }
 
 std::vector<IndexedName> ComplexGeoData::getHigherElements(const char*, bool) const
@@ -346,6 +346,9 @@ public:
     /// Get the current element map size
     size_t getElementMapSize(bool flush = true) const;
 
+    /// Get the estimated memory used by the element map, including its child maps
+    size_t getElementMapMemSize(bool flush = true) const;
+
     /// Return the higher level element names of the given element
     virtual std::vector<IndexedName> getHigherElements(const char* name, bool silent = false) const;
 
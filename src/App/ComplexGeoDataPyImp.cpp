@@ -514,6 +514,11 @@ Py::Int ComplexGeoDataPy::getElementMapSize() const
     return Py::Int((long)getComplexGeoDataPtr()->getElementMapSize());
 }
 
+Py::Int ComplexGeoDataPy::getElementMapMemSize() const
+{
+    return Py::Int((long)getComplexGeoDataPtr()->getElementMapMemSize());
+}
+
 void ComplexGeoDataPy::setHasher(Py::Object obj)
 {
     auto self = getComplexGeoDataPtr();
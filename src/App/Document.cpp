@@ -494,6 +494,45 @@ void Document::_clearRedos()
     }
 }
 
+void Document::_swapOutUndos()
+{
+    if (d->UndoMemSize == 0) {
+        return;
+    }
+
+    unsigned int size = getUndoMemSize();
+    if (size <= d->UndoMemSize) {
+        return;
+    }
+
+    // keep the last transaction in memory as it is the next one to undo
+    for (auto it = mUndoTransactions.begin(); size > d->UndoMemSize; ++it) {
+        if (std::next(it) == mUndoTransactions.end()) {
+            break;
+        }
+
+        Transaction* transaction = *it;
+        if (transaction->isSwappedOut()) {
+            continue;
+        }
+
+        unsigned int transSize = transaction->getMemSize();
+        try {
+            transaction->swapOut(
+                Base::FileInfo::getTempFileName("Undo", TransientDir.getValue()));
+        }
+        catch (const Base::Exception& e) {
+            e.ReportException();
+            break;
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Failed to swap out transaction '" << transaction->Name << "': " << e.what());
+            break;
+        }
+        size -= transSize - transaction->getMemSize();
+    }
+}
+
 void Document::commitTransaction()
 {
     if (isPerformingTransaction() || d->committing) {
@@ -533,6 +572,7 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        _swapOutUndos();
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -648,6 +688,7 @@ void Document::clearDocument()
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearObjectIndex();
     d->lastObjectId = 0;
 }
 
@@ -744,6 +785,21 @@ int Document::getUndoMode() const
 }
 
 unsigned int Document::getUndoMemSize() const
+{
+    unsigned int size = 0;
+    for (auto transaction : mUndoTransactions) {
+        size += transaction->getMemSize();
+    }
+    for (auto transaction : mRedoTransactions) {
+        size += transaction->getMemSize();
+    }
+    if (d->activeUndoTransaction) {
+        size += d->activeUndoTransaction->getMemSize();
+    }
+    return size;
+}
+
+unsigned int Document::getUndoLimit() const
 {
     return d->UndoMemSize;
 }
@@ -849,6 +905,42 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
     signalChangedObject(*Who, *What);
+
+    if (d->batchLevel == 0) {
+        signalChangedObjectCoalesced(*Who, *What);
+    }
+    else if (d->batchChangeSet.emplace(Who->getID(), What).second) {
+        d->batchChanges.emplace_back(Who->getID(), What);
+    }
+}
+
+void Document::openBatch()
+{
+    ++d->batchLevel;
+}
+
+void Document::closeBatch()
+{
+    if (d->batchLevel == 0 || --d->batchLevel > 0) {
+        return;
+    }
+
+    std::vector<std::pair<long, const Property*>> changes;
+    changes.swap(d->batchChanges);
+    d->batchChangeSet.clear();
+    for (const auto& change : changes) {
+        // skip objects that are removed or properties that are removed meanwhile
+        auto it = d->objectIdMap.find(change.first);
+        if (it == d->objectIdMap.end() || !it->second->getPropertyName(change.second)) {
+            continue;
+        }
+        signalChangedObjectCoalesced(*it->second, *change.second);
+    }
+}
+
+bool Document::isBatching() const
+{
+    return d->batchLevel > 0;
 }
 
 void Document::setTransactionMode(int iMode)
@@ -2279,6 +2371,7 @@ void Document::restore(const char* filename,
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearObjectIndex();
     d->lastObjectId = 0;
 
     if (signal) {
@@ -3593,6 +3686,7 @@ DocumentObject* Document::addObject(const char* sType,
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    _addObjectToIndex(pcObject);
 
     // If we are restoring, don't set the Label object now; it will be restored later. This is to
     // avoid potential duplicate label conflicts later.
@@ -3653,13 +3747,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         return objects;
     }
 
-    // get all existing object names
-    std::vector<std::string> reservedNames;
-    reservedNames.reserve(d->objectMap.size());
-    for (const auto& pos : d->objectMap) {
-        reservedNames.push_back(pos.first);
-    }
-
+    DocumentBatch batch(this);
     for (auto it = objects.begin(); it != objects.end(); ++it) {
         auto index = std::distance(objects.begin(), it);
         App::DocumentObject* pcObject = *it;
@@ -3679,21 +3767,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         if (ObjectName.empty()) {
             ObjectName = sType;
         }
-        ObjectName = Base::Tools::getIdentifier(ObjectName);
-        if (d->objectMap.find(ObjectName) != d->objectMap.end()) {
-            // remove also trailing digits from clean name which is to avoid to create lengthy names
-            // like 'Box001001'
-            if (!testStatus(KeepTrailingDigits)) {
-                std::string::size_type index = ObjectName.find_last_not_of("0123456789");
-                if (index + 1 < ObjectName.size()) {
-                    ObjectName = ObjectName.substr(0, index + 1);
-                }
-            }
-
-            ObjectName = Base::Tools::getUniqueName(ObjectName, reservedNames, 3);
-        }
-
-        reservedNames.push_back(ObjectName);
+        ObjectName = getUniqueObjectName(ObjectName.c_str());
 
         // insert in the name map
         d->objectMap[ObjectName] = pcObject;
@@ -3705,6 +3779,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
+        _addObjectToIndex(pcObject);
 
         pcObject->Label.setValue(ObjectName);
 
@@ -3775,6 +3850,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    _addObjectToIndex(pcObject);
 
     pcObject->Label.setValue(ObjectName);
 
@@ -3807,6 +3883,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    _addObjectToIndex(pcObject);
 
     // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3899,6 +3976,7 @@ void Document::removeObject(const char* sName)
     }
 
     // remove the ID before possibly deleting the object
+    _removeObjectFromIndex(pos->second);
     d->objectIdMap.erase(pos->second->_Id);
     // Unset the bit to be on the safe side
     pos->second->setStatus(ObjectStatus::Remove, false);
@@ -4000,6 +4078,7 @@ void Document::_removeObject(DocumentObject* pcObject)
 
     // remove from map
     pcObject->setStatus(ObjectStatus::Remove, false);  // Unset the bit to be on the safe side
+    _removeObjectFromIndex(pcObject);
     d->objectIdMap.erase(pcObject->_Id);
     d->objectMap.erase(pos);
 
@@ -4301,26 +4380,115 @@ std::string Document::getUniqueObjectName(const char* Name) const
             }
         }
 
-        std::vector<std::string> names;
-        names.reserve(d->objectMap.size());
-        for (pos = d->objectMap.begin(); pos != d->objectMap.end(); ++pos) {
-            names.push_back(pos->first);
-        }
+        // the existing name with the highest number is enough to find the next one
+        std::vector<std::string> names {d->objectNames.highest(NameIndex::split(CleanName).first)};
         return Base::Tools::getUniqueName(CleanName, names, 3);
     }
 }
 
-std::string Document::getStandardObjectName(const char* Name, int d) const
+std::string Document::getStandardObjectName(const char* Name, int digits) const
+{
+    if (d->objectArray.empty()) {
+        return Name;
+    }
+    return d->nextObjectLabel(Name, nullptr, digits);
+}
+
+std::vector<DocumentObject*> Document::getObjectsByLabel(const std::string& label) const
+{
+    std::vector<DocumentObject*> objs;
+    auto range = d->objectLabelMap.equal_range(label);
+    for (auto it = range.first; it != range.second; ++it) {
+        objs.push_back(it->second);
+    }
+    std::sort(objs.begin(), objs.end(), [](DocumentObject* obj1, DocumentObject* obj2) {
+        return obj1->getID() < obj2->getID();
+    });
+    return objs;
+}
+
+std::string Document::getUniqueObjectLabel(const std::string& label,
+                                           const DocumentObject* exclude,
+                                           int digits) const
+{
+    auto range = d->objectLabelMap.equal_range(label);
+    if (std::all_of(range.first, range.second, [exclude](const auto& it) {
+            return it.second == exclude;
+        })) {
+        return label;
+    }
+    return d->nextObjectLabel(label, exclude, digits);
+}
+
+std::string DocumentP::nextObjectLabel(const std::string& label,
+                                       const DocumentObject* exclude,
+                                       int digits) const
+{
+    std::string base = NameIndex::split(label).first;
+    if (base.find_first_not_of("0123456789") == std::string::npos) {
+        // the number of a label of digits only is not split off, so longer labels of digits
+        // count as numbered labels, too
+        std::vector<std::string> labels;
+        labels.reserve(objectArray.size());
+        for (auto obj : objectArray) {
+            if (obj != exclude) {
+                labels.push_back(obj->Label.getStrValue());
+            }
+        }
+        return Base::Tools::getUniqueName(label, labels, digits);
+    }
+
+    // the existing label with the highest number is enough to find the next one
+    std::vector<std::string> labels {
+        objectLabels.highest(base, exclude ? exclude->Label.getStrValue() : std::string())};
+    return Base::Tools::getUniqueName(label, labels, digits);
+}
+
+void Document::_addObjectToIndex(DocumentObject* pcObject)
+{
+    d->objectNames.add(pcObject->getNameInDocument());
+    _addObjectLabel(pcObject);
+}
+
+void Document::_removeObjectFromIndex(DocumentObject* pcObject)
+{
+    _removeObjectLabel(pcObject);
+    d->objectNames.remove(pcObject->getNameInDocument());
+}
+
+void Document::_removeObjectLabel(DocumentObject* pcObject)
 {
-    std::vector<App::DocumentObject*> mm = getObjects();
-    std::vector<std::string> labels;
-    labels.reserve(mm.size());
+    // objects kept by the Undo transactions are not indexed
+    auto it = d->objectIdMap.find(pcObject->_Id);
+    if (it == d->objectIdMap.end() || it->second != pcObject) {
+        return;
+    }
+    const std::string& label = pcObject->Label.getStrValue();
+    auto range = d->objectLabelMap.equal_range(label);
+    for (auto jt = range.first; jt != range.second; ++jt) {
+        if (jt->second == pcObject) {
+            d->objectLabelMap.erase(jt);
+            d->objectLabels.remove(label);
+            return;
+        }
+    }
+}
 
-    for (auto it : mm) {
-        std::string label = it->Label.getValue();
-        labels.push_back(label);
+void Document::_addObjectLabel(DocumentObject* pcObject)
+{
+    auto it = d->objectIdMap.find(pcObject->_Id);
+    if (it == d->objectIdMap.end() || it->second != pcObject) {
+        return;
     }
-    return Base::Tools::getUniqueName(Name, labels, d);
+    const std::string& label = pcObject->Label.getStrValue();
+    auto range = d->objectLabelMap.equal_range(label);
+    for (auto jt = range.first; jt != range.second; ++jt) {
+        if (jt->second == pcObject) {
+            return;
+        }
+    }
+    d->objectLabelMap.emplace(label, pcObject);
+    d->objectLabels.add(label);
 }
 
 std::vector<DocumentObject*> Document::getDependingObjects() const
@@ -4539,3 +4707,23 @@ bool Document::mustExecute() const
     }
     return false;
 }
+
+// ----------------------------------------------------------------------------
+
+DocumentBatch::DocumentBatch(Document* doc)
+    : doc(doc)
+{
+    doc->openBatch();
+}
+
+DocumentBatch::~DocumentBatch()
+{
+    try {
+        doc->closeBatch();
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+    }
+    catch (...) {
+    }
+}
@@ -139,6 +139,11 @@ public:
     boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)> signalBeforeChangeObject;
     /// signal on changed Object
     boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)> signalChangedObject;
+    /** signal on changed Object, sent once per property at the end of a batch
+     * @see openBatch()
+     */
+    boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)>
+        signalChangedObjectCoalesced;
     /// signal on manually called DocumentObject::touch()
     boost::signals2::signal<void(const App::DocumentObject&)> signalTouchedObject;
     /// signal on relabeled Object
@@ -270,6 +275,7 @@ public:
                               bool isPartial = false);
     /** Add an array of features of the given types and names.
      * Unicode names are set through the Label property.
+     * Faster than adding the objects one by one, e.g. when importing thousands of objects.
      * @param sType       The type of created object
      * @param objectNames A list of object names
      * @param isNew       If false don't call the \c DocumentObject::setupObject() callback (default
@@ -324,6 +330,15 @@ public:
     std::string getUniqueObjectName(const char* Name) const;
     /// Returns a name of the form prefix_number. d specifies the number of digits.
     std::string getStandardObjectName(const char* Name, int d) const;
+    /// Returns the objects with the given label in the order of their creation
+    std::vector<DocumentObject*> getObjectsByLabel(const std::string& label) const;
+    /** Returns \a label if no object but \a exclude uses it, otherwise a label of the form
+     * prefix_number after the highest number in use. \a digits specifies the minimum number of
+     * digits.
+     */
+    std::string getUniqueObjectLabel(const std::string& label,
+                                     const DocumentObject* exclude = nullptr,
+                                     int digits = 3) const;
     /// Returns a list of document's objects including the dependencies
     std::vector<DocumentObject*> getDependingObjects() const;
     /// Returns a list of all Objects
@@ -425,8 +440,12 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
+    /** Set the Undo limit in Byte! If the Undo/Redo stack needs more memory the large data of
+     * the older transactions is moved to files in the transient directory. 0 means no limit.
+     */
     void setUndoLimit(unsigned int UndoMemSize = 0);
+    /// Returns the Undo limit in Byte
+    unsigned int getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize() const;
     /// Set the Undo limit as stack size
@@ -454,6 +473,24 @@ public:
     void addOrRemovePropertyOfObject(TransactionalObject*, Property* prop, bool add);
     //@}
 
+    /** @name Batched change notifications
+     *
+     * While a batch is open the changes of object properties are collected, and when the
+     * outermost batch is closed signalChangedObjectCoalesced is sent once for each changed
+     * property of an object still in the document. Outside a batch it is sent together with
+     * signalChangedObject, which is always sent for every change. Observers that only need to
+     * know what has changed, e.g. to update a view, should connect to the coalesced signal.
+     * @see DocumentBatch
+     */
+    //@{
+    /// Open a batch, batches can be nested
+    void openBatch();
+    /// Close a batch and send the collected notifications if it is the outermost one
+    void closeBatch();
+    /// Check if a batch is open
+    bool isBatching() const;
+    //@}
+
     /** @name dependency stuff */
     //@{
     /// write GraphViz file
@@ -576,6 +613,8 @@ public:
     friend class DocumentObject;
     friend class Transaction;
     friend class TransactionDocumentObject;
+    /// because of the label index
+    friend class PropertyString;
 
     /// Destruction
     ~Document() override;
@@ -586,6 +625,13 @@ protected:
 
     void _removeObject(DocumentObject* pcObject);
     void _addObject(DocumentObject* pcObject, const char* pObjectName);
+    /// registers the name and label of an object that is added to the document
+    void _addObjectToIndex(DocumentObject* pcObject);
+    /// unregisters the name and label of an object that is removed from the document
+    void _removeObjectFromIndex(DocumentObject* pcObject);
+    /// keeps the label index up to date, called by the label before and after it changes
+    void _removeObjectLabel(DocumentObject* pcObject);
+    void _addObjectLabel(DocumentObject* pcObject);
     /// checks if a valid transaction is open
     void _checkTransaction(DocumentObject* pcDelObj, const Property* What, int line);
     void breakDependency(DocumentObject* pcObject, bool clear);
@@ -604,6 +650,8 @@ protected:
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
     void _clearRedos();
+    /// writes old Undo transactions to files while the Undo limit is exceeded
+    void _swapOutUndos();
 
     /// refresh the internal dependency graph
     void _rebuildDependencyList(
@@ -642,6 +690,27 @@ private:
     std::string myName;
 };
 
+/** Helper class to open a batch of change notifications of a document for its lifetime
+ * @see Document::openBatch()
+ */
+class AppExport DocumentBatch
+{
+public:
+    /// Private new operator to prevent heap allocation
+    void* operator new(std::size_t) = delete;
+
+public:
+    explicit DocumentBatch(Document* doc);
+    /// Closes the batch, the document must still exist
+    ~DocumentBatch();
+
+    DocumentBatch(const DocumentBatch&) = delete;
+    DocumentBatch& operator=(const DocumentBatch&) = delete;
+
+private:
+    Document* doc;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
@@ -101,6 +101,7 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj)
     FC_PY_ELEMENT_ARG1(DeletedObject, DeletedObject)
     FC_PY_ELEMENT_ARG2(BeforeChangeObject, BeforeChangeObject)
     FC_PY_ELEMENT_ARG2(ChangedObject, ChangedObject)
+    FC_PY_ELEMENT_ARG2(ChangedObjectCoalesced, ChangedObjectCoalesced)
     FC_PY_ELEMENT_ARG1(RecomputedObject, ObjectRecomputed)
     FC_PY_ELEMENT_ARG1(BeforeRecomputeDocument, BeforeRecomputeDocument)
     FC_PY_ELEMENT_ARG1(RecomputedDocument, Recomputed)
@@ -372,6 +373,25 @@ void DocumentObserverPython::slotChangedObject(const App::DocumentObject& Obj,
     }
 }
 
+void DocumentObserverPython::slotChangedObjectCoalesced(const App::DocumentObject& Obj,
+                                                        const App::Property& Prop)
+{
+    Base::PyGILStateLocker lock;
+    try {
+        Py::Tuple args(2);
+        args.setItem(0, Py::asObject(const_cast<App::DocumentObject&>(Obj).getPyObject()));
+        const char* prop_name = Obj.getPropertyName(&Prop);
+        if (prop_name) {
+            args.setItem(1, Py::String(prop_name));
+            Base::pyCall(pyChangedObjectCoalesced.ptr(), args.ptr());
+        }
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.ReportException();
+    }
+}
+
 void DocumentObserverPython::slotRecomputedObject(const App::DocumentObject& Obj)
 {
     Base::PyGILStateLocker lock;
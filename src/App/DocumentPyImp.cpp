@@ -406,6 +406,39 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args)
+{
+    char* sType;
+    PyObject* names;
+    if (!PyArg_ParseTuple(args, "sO", &sType, &names)) {
+        return nullptr;
+    }
+
+    std::vector<std::string> objectNames;
+    Py::Sequence seq(names);
+    objectNames.reserve(seq.size());
+    for (Py_ssize_t i = 0; i < seq.size(); i++) {
+        Py::Object item = seq[i];
+        if (!item.isString()) {
+            throw Py::TypeError("names must be a sequence of strings");
+        }
+        objectNames.push_back(Py::String(item).as_std_string("utf-8"));
+    }
+
+    std::vector<DocumentObject*> objs = getDocumentPtr()->addObjects(sType, objectNames, true);
+    if (objs.empty() && !objectNames.empty()) {
+        std::stringstream str;
+        str << "No document object found of type '" << sType << "'" << std::ends;
+        throw Py::TypeError(str.str());
+    }
+
+    Py::List list;
+    for (auto obj : objs) {
+        list.append(Py::asObject(obj->getPyObject()));
+    }
+    return Py::new_reference_to(list);
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName;
@@ -581,6 +614,24 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::openBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->openBatch();
+    Py_Return;
+}
+
+PyObject* DocumentPy::closeBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->closeBatch();
+    Py_Return;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
@@ -764,12 +815,9 @@ PyObject* DocumentPy::getObjectsByLabel(PyObject* args)
     }
 
     Py::List list;
-    std::string name = sName;
-    std::vector<DocumentObject*> objs = getDocumentPtr()->getObjects();
+    std::vector<DocumentObject*> objs = getDocumentPtr()->getObjectsByLabel(sName);
     for (auto obj : objs) {
-        if (name == obj->Label.getValue()) {
-            list.append(Py::asObject(obj->getPyObject()));
-        }
+        list.append(Py::asObject(obj->getPyObject()));
     }
 
     return Py::new_reference_to(list);
@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -442,7 +443,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                this->mappedNames.insert(ref->name, idx);
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -509,25 +510,25 @@ MappedName ElementMap::addName(MappedName& name,
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        auto ret = mappedNames.insert(name, idx);
+        if (ret.second) {               // element just inserted did not exist yet in the map
+            ret.first->name.compact();  // FIXME see MappedName.cpp
+            mappedRef(idx).append(ret.first->name, sids);
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
-        if (ret.first->second == idx) {
+        if (ret.first->index == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = ret.first->index;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        erase(ret.first->name);
     };
 }
 
@@ -777,16 +778,16 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    auto entry = this->mappedNames.find(name);
+    if (!entry) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(entry->index);
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    this->mappedNames.erase(name);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -816,10 +817,48 @@ bool ElementMap::empty() const
     return mappedNames.empty() && childElementSize == 0;
 }
 
+std::size_t ElementMap::getMemSize() const
+{
+    std::set<const ElementMap*> visited;
+    return getMemSize(visited);
+}
+
+std::size_t ElementMap::getMemSize(std::set<const ElementMap*>& visited) const
+{
+    if (!visited.insert(this).second) {
+        return 0;
+    }
+
+    // the allocation of a tree or hash node besides its value, i.e. the links and the color
+    constexpr std::size_t nodeSize = 4 * sizeof(void*);
+    constexpr std::size_t sidSize = sizeof(App::StringIDRef);
+
+    std::size_t size = sizeof(ElementMap);
+    for (auto& indexedName : this->indexedNames) {
+        size += nodeSize + sizeof(indexedName);
+        for (const MappedNameRef& mappedName : indexedName.second.names) {
+            for (const MappedNameRef* ref = &mappedName; ref; ref = ref->next.get()) {
+                size += sizeof(MappedNameRef) + ref->name.size() + ref->sids.size() * sidSize;
+            }
+        }
+        for (auto& childPair : indexedName.second.children) {
+            auto& child = childPair.second;
+            size += nodeSize + sizeof(childPair) + child.postfix.size()
+                + child.sids.size() * sidSize;
+            if (child.elementMap) {
+                size += child.elementMap->getMemSize(visited);
+            }
+        }
+    }
+    size += this->mappedNames.getMemSize();
+    size += this->childElements.size() * (nodeSize + sizeof(QByteArray) + sizeof(ChildMapInfo));
+    return size;
+}
+
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    auto entry = mappedNames.find(name);
+    if (!entry) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -856,7 +895,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(entry->index);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -869,7 +908,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return entry->index;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1072,8 +1111,8 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    for (auto entry : this->mappedNames.sorted()) {
+        addPostfix(entry->name.constPostfix(), postfixMap, postfixes);
     }
 
     childMaps.push_back(this);
@@ -1299,8 +1338,8 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (auto entry : this->mappedNames.sorted()) {
+        ret.emplace_back(entry->name, entry->index);
     }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
@@ -1472,5 +1511,130 @@ void ElementMap::traceElement(const MappedName& name, long masterTag, TraceCallb
     }
 }
 
+std::size_t ElementMap::NameTable::hash(const MappedName& name)
+{
+    // FNV-1a over the data and then the postfix, because names whose concatenations are equal
+    // are the same
+    std::uint64_t value = 14695981039346656037ULL;  // NOLINT
+    auto add = [&value](const QByteArray& bytes) {
+        for (char c : bytes) {
+            value ^= static_cast<unsigned char>(c);
+            value *= 1099511628211ULL;  // NOLINT
+        }
+    };
+    add(name.dataBytes());
+    add(name.postfixBytes());
+    // the bucket is taken from the low bits
+    return static_cast<std::size_t>(value ^ (value >> 32));  // NOLINT
+}
+
+std::size_t ElementMap::NameTable::findBucket(const MappedName& name, std::size_t hash) const
+{
+    std::size_t mask = buckets.size() - 1;
+    for (std::size_t bucket = hash & mask;; bucket = (bucket + 1) & mask) {
+        std::uint32_t index = buckets[bucket];
+        if (index == 0) {
+            return bucket;
+        }
+        const Entry& entry = entries[index - 1];
+        if (entry.hash == hash && entry.name == name) {
+            return bucket;
+        }
+    }
+}
+
+void ElementMap::NameTable::rehash(std::size_t count)
+{
+    buckets.assign(count, 0);
+    std::size_t mask = count - 1;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        std::size_t bucket = entries[i].hash & mask;
+        while (buckets[bucket] != 0) {
+            bucket = (bucket + 1) & mask;
+        }
+        buckets[bucket] = static_cast<std::uint32_t>(i + 1);
+    }
+}
+
+std::pair<const ElementMap::NameTable::Entry*, bool>
+ElementMap::NameTable::insert(const MappedName& name, const IndexedName& idx)
+{
+    // at most half of the buckets are used, so that the probe sequences stay short
+    if ((entries.size() + 1) * 2 > buckets.size()) {
+        rehash(std::max<std::size_t>(16, buckets.size() * 2));  // NOLINT
+    }
+
+    std::size_t value = hash(name);
+    std::size_t bucket = findBucket(name, value);
+    if (buckets[bucket] != 0) {
+        return {&entries[buckets[bucket] - 1], false};
+    }
+    entries.push_back({name, idx, value});
+    buckets[bucket] = static_cast<std::uint32_t>(entries.size());
+    return {&entries.back(), true};
+}
+
+const ElementMap::NameTable::Entry* ElementMap::NameTable::find(const MappedName& name) const
+{
+    if (entries.empty()) {
+        return nullptr;
+    }
+    std::uint32_t index = buckets[findBucket(name, hash(name))];
+    return index != 0 ? &entries[index - 1] : nullptr;
+}
+
+void ElementMap::NameTable::erase(const MappedName& name)
+{
+    // name may be the one of the entry, so it is not used after the entry is changed
+    if (entries.empty()) {
+        return;
+    }
+    std::size_t bucket = findBucket(name, hash(name));
+    std::uint32_t index = buckets[bucket];
+    if (index == 0) {
+        return;
+    }
+
+    // Instead of leaving a tombstone, move back the following entries of the probe sequence
+    // whose home bucket is not between the hole and their bucket
+    std::size_t mask = buckets.size() - 1;
+    std::size_t hole = bucket;
+    for (std::size_t next = (hole + 1) & mask; buckets[next] != 0; next = (next + 1) & mask) {
+        std::size_t home = entries[buckets[next] - 1].hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            buckets[hole] = buckets[next];
+            hole = next;
+        }
+    }
+    buckets[hole] = 0;
+
+    // keep the entries dense by moving the last one into the gap
+    if (index != entries.size()) {
+        const Entry& last = entries.back();
+        buckets[findBucket(last.name, last.hash)] = index;
+        entries[index - 1] = std::move(entries.back());
+    }
+    entries.pop_back();
+}
+
+std::vector<const ElementMap::NameTable::Entry*> ElementMap::NameTable::sorted() const
+{
+    std::vector<const Entry*> res;
+    res.reserve(entries.size());
+    for (const Entry& entry : entries) {
+        res.push_back(&entry);
+    }
+    std::sort(res.begin(), res.end(), [](const Entry* entry1, const Entry* entry2) {
+        return entry1->name < entry2->name;
+    });
+    return res;
+}
+
+std::size_t ElementMap::NameTable::getMemSize() const
+{
+    // the name data is shared with the entries of the indexed names
+    return entries.capacity() * sizeof(Entry) + buckets.capacity() * sizeof(std::uint32_t);
+}
+
 
 }  // Namespace Data
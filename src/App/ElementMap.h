@@ -32,11 +32,13 @@
 #include "MappedElement.h"
 #include "StringHasher.h"
 
+#include <cstdint>
 #include <cstring>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 
 
 namespace Data
@@ -152,6 +154,10 @@ public:
 
     bool empty() const;
 
+    /// Estimated memory used by this map in bytes, child maps shared by several entries are
+    /// counted once
+    std::size_t getMemSize() const;
+
     IndexedName find(const MappedName& name, ElementIDRefs* sids = nullptr) const;
 
     MappedName find(const IndexedName& idx, ElementIDRefs* sids = nullptr) const;
@@ -281,6 +287,8 @@ private:
 
     MappedNameRef& mappedRef(const IndexedName& idx);
 
+    std::size_t getMemSize(std::set<const ElementMap*>& visited) const;
+
     void collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
                           std::vector<const ElementMap*>& childMaps,
                           std::map<QByteArray, int>& postfixMap,
@@ -303,7 +311,48 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /* Maps the names to their elements. It is an open addressing hash table with linear probing
+     * that keeps its entries in one array, instead of allocating a tree node for each name.
+     */
+    class NameTable
+    {
+    public:
+        struct Entry
+        {
+            MappedName name;
+            IndexedName index;
+            std::size_t hash;
+        };
+
+        /// Returns the entry of \a name, and true if it was added or false if it existed
+        std::pair<const Entry*, bool> insert(const MappedName& name, const IndexedName& idx);
+        const Entry* find(const MappedName& name) const;
+        void erase(const MappedName& name);
+
+        std::size_t size() const
+        {
+            return entries.size();
+        }
+        bool empty() const
+        {
+            return entries.empty();
+        }
+        /// The entries ordered by their names
+        std::vector<const Entry*> sorted() const;
+        std::size_t getMemSize() const;
+
+    private:
+        static std::size_t hash(const MappedName& name);
+        /// The bucket of \a name, or the empty bucket ending its probe sequence
+        std::size_t findBucket(const MappedName& name, std::size_t hash) const;
+        void rehash(std::size_t count);
+
+        std::vector<Entry> entries;
+        // the index of the entry in each bucket plus one, 0 marks an empty bucket
+        std::vector<std::uint32_t> buckets;
+    };
+
+    NameTable mappedNames;
 
     struct ChildMapInfo
     {
@@ -1107,6 +1107,9 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    ExpressionProgram::Value value;
+    if (ExpressionProgram::get(this).run(value))
+        return value.toAny();
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
@@ -1131,6 +1134,8 @@ void Expression::addComponent(Component *component) {
 }
 
 void Expression::visit(ExpressionVisitor &v) {
+    // the visitor may change the expression
+    program.reset();
     _visit(v);
     for(auto &c : components)
         c->visit(v);
@@ -1138,6 +1143,9 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    ExpressionProgram::Value value;
+    if (ExpressionProgram::get(this).run(value))
+        return value.toExpression(owner);
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
@@ -2407,6 +2415,35 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         v3 = pyToQuantity(e3,expr,"Invalid third argument.");
     }
 
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            v1.getValue() * M_PI / 180.0)));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    default:
+        break;
+    }
+
+    Quantity values[] = {v1, v2, v3};
+    Quantity res = evaluateQuantity(expr, f, values, args.size());
+    return Py::asObject(new QuantityPy(new Quantity(res)));
+}
+
+Base::Quantity FunctionExpression::evaluateQuantity(const Expression *expr, int f,
+        const Base::Quantity *args, std::size_t count)
+{
+    const Quantity &v1 = args[0];
+    Quantity v2 = count > 1 ? args[1] : Quantity();
+    Quantity v3 = count > 2 ? args[2] : Quantity();
+
     double output;
     Unit unit;
     double scaler = 1;
@@ -2418,9 +2455,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2460,7 +2494,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         unit = v1.getUnit().cbrt();
         break;
     case ATAN2:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2469,12 +2503,12 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / M_PI;
         break;
     case MOD:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         unit = v1.getUnit() / v2.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2492,23 +2526,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (count > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
@@ -2573,11 +2601,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (count > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (count > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2592,19 +2620,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
@@ -3468,6 +3488,616 @@ void RangeExpression::_offsetCells(int rowOffset, int colOffset, ExpressionVisit
 }
 
 
+//
+// ExpressionProgram class
+//
+
+namespace {
+
+using Value = ExpressionProgram::Value;
+
+// the largest magnitude of an integer that a double holds exactly
+constexpr long long exactIntegerLimit = 1LL << 53;
+
+bool isExactInDouble(const Value &v) {
+    return !v.isInteger() || (v.integer <= exactIntegerLimit && v.integer >= -exactIntegerLimit);
+}
+
+// true if the product may not fit into a long, Python switches to big integers then
+bool mayOverflow(long a, long b) {
+    return std::fabs(static_cast<double>(a) * static_cast<double>(b))
+        >= static_cast<double>(LONG_MAX);
+}
+
+// remainder with the sign of the divisor like Python's float
+double floatMod(double a, double b) {
+    double mod = std::fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0))
+            mod += b;
+    }
+    else
+        mod = std::copysign(0.0, b);
+    return mod;
+}
+
+bool integerPow(long base, long exponent, long &res) {
+    if (base == 0 || base == 1) {
+        res = exponent == 0 ? 1 : base;
+        return true;
+    }
+    if (base == -1) {
+        res = exponent % 2 ? -1 : 1;
+        return true;
+    }
+    res = 1;
+    for (; exponent > 0; --exponent) {
+        if (mayOverflow(res, base))
+            return false;
+        res *= base;
+    }
+    return true;
+}
+
+bool floatPow(double a, double b, double &res) {
+    // Python raises an error or returns a complex number in these cases
+    if (a == 0.0 && b < 0.0)
+        return false;
+    if (a < 0.0 && std::isfinite(b) && b != std::floor(b))
+        return false;
+    res = std::pow(a, b);
+    return std::isfinite(res) || !std::isfinite(a) || !std::isfinite(b);
+}
+
+bool compare(int op, const Value &l, const Value &r, Value &res) {
+    bool eq, lt;
+    if (l.type == Value::Quant && r.type == Value::Quant) {
+        // same as QuantityPy::richCompare()
+        eq = l.quantity == r.quantity;
+        if (op != OperatorExpression::EQ && op != OperatorExpression::NEQ)
+            lt = l.quantity < r.quantity;
+        else
+            lt = false;
+        switch (op) {
+        case OperatorExpression::LTE:
+            res = Value::fromBool(lt || eq);
+            return true;
+        case OperatorExpression::GT:
+            res = Value::fromBool(!lt && !eq);
+            return true;
+        case OperatorExpression::GTE:
+            res = Value::fromBool(!lt);
+            return true;
+        default:
+            break;
+        }
+    }
+    else if (l.isInteger() && r.isInteger()) {
+        eq = l.integer == r.integer;
+        lt = l.integer < r.integer;
+    }
+    else {
+        if ((l.type == Value::Float || r.type == Value::Float)
+                && (!isExactInDouble(l) || !isExactInDouble(r)))
+            return false;
+        double a = l.toDouble();
+        double b = r.toDouble();
+        switch (op) {
+        case OperatorExpression::LTE:
+            res = Value::fromBool(a <= b);
+            return true;
+        case OperatorExpression::GT:
+            res = Value::fromBool(a > b);
+            return true;
+        case OperatorExpression::GTE:
+            res = Value::fromBool(a >= b);
+            return true;
+        default:
+            eq = a == b;
+            lt = a < b;
+            break;
+        }
+    }
+    switch (op) {
+    case OperatorExpression::EQ:
+        res = Value::fromBool(eq);
+        return true;
+    case OperatorExpression::NEQ:
+        res = Value::fromBool(!eq);
+        return true;
+    case OperatorExpression::LT:
+        res = Value::fromBool(lt);
+        return true;
+    case OperatorExpression::LTE:
+        res = Value::fromBool(lt || eq);
+        return true;
+    case OperatorExpression::GT:
+        res = Value::fromBool(!lt && !eq);
+        return true;
+    case OperatorExpression::GTE:
+        res = Value::fromBool(!lt);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns false where Python would fail or leave the numeric types
+bool binary(int op, const Value &l, const Value &r, Value &res) {
+    switch (op) {
+    case OperatorExpression::EQ:
+    case OperatorExpression::NEQ:
+    case OperatorExpression::LT:
+    case OperatorExpression::LTE:
+    case OperatorExpression::GT:
+    case OperatorExpression::GTE:
+        return compare(op, l, r, res);
+    default:
+        break;
+    }
+
+    if (l.type == Value::Quant || r.type == Value::Quant) {
+        // same as the number handlers of QuantityPy
+        switch (op) {
+        case OperatorExpression::ADD:
+            res = Value::fromQuantity(l.toQuantity() + r.toQuantity());
+            return true;
+        case OperatorExpression::SUB:
+            res = Value::fromQuantity(l.toQuantity() - r.toQuantity());
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            res = Value::fromQuantity(l.toQuantity() * r.toQuantity());
+            return true;
+        case OperatorExpression::DIV:
+            res = Value::fromQuantity(l.toQuantity() / r.toQuantity());
+            return true;
+        case OperatorExpression::MOD:
+            if (l.type != Value::Quant || r.toDouble() == 0.0)
+                return false;
+            res = Value::fromQuantity(Quantity(floatMod(l.quantity.getValue(), r.toDouble()),
+                                               l.quantity.getUnit()));
+            return true;
+        case OperatorExpression::POW:
+            if (l.type != Value::Quant)
+                return false;
+            if (r.type == Value::Quant)
+                res = Value::fromQuantity(l.quantity.pow(r.quantity));
+            else
+                res = Value::fromQuantity(l.quantity.pow(r.toDouble()));
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    if (l.isInteger() && r.isInteger()) {
+        long a = l.integer;
+        long b = r.integer;
+        switch (op) {
+        case OperatorExpression::ADD:
+            if ((b > 0 && a > LONG_MAX - b) || (b < 0 && a < LONG_MIN - b))
+                return false;
+            res = Value::fromInteger(a + b);
+            return true;
+        case OperatorExpression::SUB:
+            if ((b < 0 && a > LONG_MAX + b) || (b > 0 && a < LONG_MIN + b))
+                return false;
+            res = Value::fromInteger(a - b);
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            if (mayOverflow(a, b))
+                return false;
+            res = Value::fromInteger(a * b);
+            return true;
+        case OperatorExpression::DIV:
+            if (b == 0 || !isExactInDouble(l) || !isExactInDouble(r))
+                return false;
+            res = Value::fromFloat(static_cast<double>(a) / static_cast<double>(b));
+            return true;
+        case OperatorExpression::MOD: {
+            if (b == 0)
+                return false;
+            long mod = b == -1 ? 0 : a % b;
+            if (mod != 0 && ((mod < 0) != (b < 0)))
+                mod += b;
+            res = Value::fromInteger(mod);
+            return true;
+        }
+        case OperatorExpression::POW:
+            if (b < 0) {
+                double v;
+                if (!isExactInDouble(l)
+                        || !floatPow(static_cast<double>(a), static_cast<double>(b), v))
+                    return false;
+                res = Value::fromFloat(v);
+                return true;
+            }
+            long v;
+            if (!integerPow(a, b, v))
+                return false;
+            res = Value::fromInteger(v);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    double a = l.toDouble();
+    double b = r.toDouble();
+    switch (op) {
+    case OperatorExpression::ADD:
+        res = Value::fromFloat(a + b);
+        return true;
+    case OperatorExpression::SUB:
+        res = Value::fromFloat(a - b);
+        return true;
+    case OperatorExpression::MUL:
+    case OperatorExpression::UNIT:
+        res = Value::fromFloat(a * b);
+        return true;
+    case OperatorExpression::DIV:
+        if (b == 0.0)
+            return false;
+        res = Value::fromFloat(a / b);
+        return true;
+    case OperatorExpression::MOD:
+        if (b == 0.0)
+            return false;
+        res = Value::fromFloat(floatMod(a, b));
+        return true;
+    case OperatorExpression::POW: {
+        double v;
+        if (!floatPow(a, b, v))
+            return false;
+        res = Value::fromFloat(v);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool unary(int op, Value &v) {
+    switch (v.type) {
+    case Value::Quant:
+        // same as QuantityPy
+        if (op == OperatorExpression::NEG)
+            v.quantity = v.quantity * -1.0;
+        return true;
+    case Value::Float:
+        if (op == OperatorExpression::NEG)
+            v.quantity = Quantity(-v.quantity.getValue());
+        return true;
+    default:
+        if (op == OperatorExpression::NEG) {
+            if (v.integer == LONG_MIN)
+                return false;
+            v.integer = -v.integer;
+        }
+        // a bool becomes an int
+        v.type = Value::Int;
+        return true;
+    }
+}
+
+bool readVariable(const ObjectIdentifier &path, Value &value) {
+    auto prop = path.getWholeProperty();
+    if (!prop)
+        return false;
+    // check the quantity first, it is derived from PropertyFloat
+    if (auto quantity = freecad_dynamic_cast<PropertyQuantity>(prop))
+        value = Value::fromQuantity(quantity->getQuantityValue());
+    else if (auto number = freecad_dynamic_cast<PropertyFloat>(prop))
+        value = Value::fromFloat(number->getValue());
+    else if (auto integer = freecad_dynamic_cast<PropertyInteger>(prop))
+        value = Value::fromInteger(integer->getValue());
+    else if (auto boolean = freecad_dynamic_cast<PropertyBool>(prop))
+        value = Value::fromBool(boolean->getValue());
+    else
+        return false;
+    return true;
+}
+
+} // anonymous namespace
+
+ExpressionProgram::Value ExpressionProgram::Value::fromInteger(long value) {
+    Value res;
+    res.type = Int;
+    res.integer = value;
+    return res;
+}
+
+ExpressionProgram::Value ExpressionProgram::Value::fromFloat(double value) {
+    Value res;
+    res.type = Float;
+    res.quantity = Quantity(value);
+    return res;
+}
+
+ExpressionProgram::Value ExpressionProgram::Value::fromBool(bool value) {
+    Value res;
+    res.type = Bool;
+    res.integer = value ? 1 : 0;
+    return res;
+}
+
+ExpressionProgram::Value ExpressionProgram::Value::fromQuantity(const Quantity &value) {
+    Value res;
+    res.type = Quant;
+    res.quantity = value;
+    return res;
+}
+
+ExpressionProgram::Value ExpressionProgram::Value::fromNumber(const Quantity &value) {
+    // same as pyFromQuantity()
+    if(!value.getUnit().isEmpty())
+        return fromQuantity(value);
+    long l;
+    int i;
+    switch(essentiallyInteger(value.getValue(),l,i)) {
+    case 1:
+    case 2:
+        return fromInteger(l);
+    default:
+        return fromFloat(value.getValue());
+    }
+}
+
+bool ExpressionProgram::Value::isTrue() const {
+    if (isInteger())
+        return integer != 0;
+    return quantity.getValue() != 0.0;
+}
+
+double ExpressionProgram::Value::toDouble() const {
+    if (isInteger())
+        return static_cast<double>(integer);
+    return quantity.getValue();
+}
+
+Quantity ExpressionProgram::Value::toQuantity() const {
+    if (isInteger())
+        return Quantity(static_cast<double>(integer));
+    return quantity;
+}
+
+App::any ExpressionProgram::Value::toAny() const {
+    // same as pyObjectToAny()
+    switch (type) {
+    case Quant:
+        return App::any(quantity);
+    case Float:
+        return App::any(quantity.getValue());
+    default:
+        return App::any(integer);
+    }
+}
+
+Expression *ExpressionProgram::Value::toExpression(const DocumentObject *owner) const {
+    // same as expressionFromPy()
+    if (type == Bool) {
+        if (integer)
+            return new ConstantExpression(owner,"True",Quantity(1.0));
+        else
+            return new ConstantExpression(owner,"False",Quantity(0.0));
+    }
+    return new NumberExpression(owner,toQuantity());
+}
+
+const ExpressionProgram &ExpressionProgram::get(const Expression *expr) {
+    if (!expr->program) {
+        std::unique_ptr<ExpressionProgram> program(new ExpressionProgram);
+        program->valid = program->add(expr);
+        if (!program->valid) {
+            program->instructions.clear();
+            program->constants.clear();
+            program->variables.clear();
+        }
+        expr->program = std::move(program);
+    }
+    return *expr->program;
+}
+
+bool ExpressionProgram::run(Value &result) const {
+    return valid && run(0, instructions.size(), result);
+}
+
+bool ExpressionProgram::run(std::size_t begin, std::size_t end, Value &result) const {
+    std::vector<Value> stack(maxDepth);
+    std::size_t top = 0;
+    try {
+        for (std::size_t i = begin; i < end; ++i) {
+            const Instruction &instr = instructions[i];
+            switch (instr.code) {
+            case PushConstant:
+                stack[top++] = constants[instr.arg];
+                break;
+            case PushVariable:
+                if (!readVariable(*variables[instr.arg], stack[top++]))
+                    return false;
+                break;
+            case Unary:
+                if (!unary(instr.op, stack[top - 1]))
+                    return false;
+                break;
+            case Binary: {
+                Value value;
+                if (!binary(instr.op, stack[top - 2], stack[top - 1], value))
+                    return false;
+                stack[--top - 1] = value;
+                break;
+            }
+            case Call: {
+                Quantity args[3];
+                top -= instr.arg;
+                for (int j = 0; j < instr.arg; ++j)
+                    args[j] = stack[top + j].toQuantity();
+                stack[top++] = Value::fromQuantity(
+                        FunctionExpression::evaluateQuantity(nullptr, instr.op, args, instr.arg));
+                break;
+            }
+            case JumpIfFalse:
+                if (!stack[--top].isTrue())
+                    i = static_cast<std::size_t>(instr.arg) - 1;
+                break;
+            case Jump:
+                i = static_cast<std::size_t>(instr.arg) - 1;
+                break;
+            }
+        }
+    }
+    catch (...) {
+        // evaluated again in Python, which reports the error
+        return false;
+    }
+    if (top != 1)
+        return false;
+    result = stack[0];
+    return true;
+}
+
+bool ExpressionProgram::add(const Expression *expr) {
+    if (expr->hasComponent())
+        return false;
+
+    std::size_t begin = instructions.size();
+    std::size_t numConstants = constants.size();
+    std::size_t numVariables = variables.size();
+    std::size_t startDepth = depth;
+    if (!expr->_compile(*this))
+        return false;
+
+    // fold constant sub-expressions, which also checks their units
+    if (variables.size() == numVariables && instructions.size() - begin > 1) {
+        Value value;
+        if (!run(begin, instructions.size(), value))
+            return false;
+        instructions.resize(begin);
+        constants.resize(numConstants);
+        depth = startDepth;
+        addConstant(value);
+    }
+    return true;
+}
+
+void ExpressionProgram::addConstant(const Value &value) {
+    constants.push_back(value);
+    addInstruction(PushConstant, 0, static_cast<int>(constants.size() - 1));
+}
+
+void ExpressionProgram::addVariable(const ObjectIdentifier &path) {
+    variables.push_back(&path);
+    addInstruction(PushVariable, 0, static_cast<int>(variables.size() - 1));
+}
+
+std::size_t ExpressionProgram::addInstruction(OpCode code, int op, int arg) {
+    switch (code) {
+    case PushConstant:
+    case PushVariable:
+        ++depth;
+        break;
+    case Binary:
+    case JumpIfFalse:
+        --depth;
+        break;
+    case Call:
+        depth -= arg - 1;
+        break;
+    case Jump:
+        // the other branch starts without the value of this one
+        --depth;
+        break;
+    case Unary:
+        break;
+    }
+    maxDepth = std::max(maxDepth, depth);
+    instructions.push_back({code, op, arg});
+    return instructions.size() - 1;
+}
+
+void ExpressionProgram::setJumpTarget(std::size_t index) {
+    instructions[index].arg = static_cast<int>(instructions.size());
+}
+
+bool UnitExpression::_compile(ExpressionProgram &program) const {
+    program.addConstant(ExpressionProgram::Value::fromNumber(quantity));
+    return true;
+}
+
+bool ConstantExpression::_compile(ExpressionProgram &program) const {
+    if(strcmp(name,"None")==0)
+        return false;
+    if(strcmp(name,"True")==0)
+        program.addConstant(ExpressionProgram::Value::fromBool(true));
+    else if(strcmp(name,"False")==0)
+        program.addConstant(ExpressionProgram::Value::fromBool(false));
+    else
+        return NumberExpression::_compile(program);
+    return true;
+}
+
+bool OperatorExpression::_compile(ExpressionProgram &program) const {
+    if (!program.add(left))
+        return false;
+    switch (op) {
+    case NEG:
+    case POS:
+        program.addInstruction(ExpressionProgram::Unary, op);
+        return true;
+    case ADD:
+    case SUB:
+    case MUL:
+    case DIV:
+    case MOD:
+    case POW:
+    case EQ:
+    case NEQ:
+    case LT:
+    case GT:
+    case LTE:
+    case GTE:
+    case UNIT:
+        if (!program.add(right))
+            return false;
+        program.addInstruction(ExpressionProgram::Binary, op);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ConditionalExpression::_compile(ExpressionProgram &program) const {
+    if (!program.add(condition))
+        return false;
+    std::size_t jumpToFalse = program.addInstruction(ExpressionProgram::JumpIfFalse);
+    if (!program.add(trueExpr))
+        return false;
+    std::size_t jumpToEnd = program.addInstruction(ExpressionProgram::Jump);
+    program.setJumpTarget(jumpToFalse);
+    if (!program.add(falseExpr))
+        return false;
+    program.setJumpTarget(jumpToEnd);
+    return true;
+}
+
+bool FunctionExpression::_compile(ExpressionProgram &program) const {
+    if (!owner || f < ABS || f > TRUNC || args.empty() || args.size() > 3)
+        return false;
+    for (auto arg : args) {
+        if (!program.add(arg))
+            return false;
+    }
+    program.addInstruction(ExpressionProgram::Call, f, static_cast<int>(args.size()));
+    return true;
+}
+
+bool VariableExpression::_compile(ExpressionProgram &program) const {
+    program.addVariable(var);
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 
 static Base::XMLReader *_Reader = nullptr;
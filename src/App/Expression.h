@@ -43,6 +43,7 @@ namespace App  {
 
 class DocumentObject;
 class Expression;
+class ExpressionProgram;
 class Document;
 
 using ExpressionPtr = std::unique_ptr<Expression>;
@@ -188,6 +189,7 @@ public:
     bool isSame(const Expression &other, bool checkComment=true) const;
 
     friend class ExpressionVisitor;
+    friend class ExpressionProgram;
 
 protected:
     virtual bool _isIndexable() const {return false;}
@@ -211,6 +213,8 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    /// Adds the instructions evaluating the expression, returns false if it is not numeric
+    virtual bool _compile(ExpressionProgram &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
@@ -222,6 +226,9 @@ protected:
 public:
     std::string comment;
     // clang-format on
+
+private:
+    mutable std::unique_ptr<ExpressionProgram> program;
 };
 
 }
@@ -118,6 +118,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -168,6 +169,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -237,6 +239,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _compile(ExpressionProgram& program) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -275,6 +279,7 @@ protected:
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
 
 protected:
     Expression* condition; /**< Condition */
@@ -392,6 +397,11 @@ public:
 
     static Py::Object
     evaluate(const Expression* owner, int type, const std::vector<Expression*>& args);
+    /// Evaluates the functions from ABS to TRUNC for up to three arguments
+    static Base::Quantity evaluateQuantity(const Expression* owner,
+                                           int type,
+                                           const Base::Quantity* args,
+                                           std::size_t count);
 
     Function getFunction() const
     {
@@ -421,6 +431,7 @@ protected:
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -471,6 +482,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
@@ -594,6 +606,101 @@ protected:
     std::string end;
 };
 
+/**
+ * Class implementing the evaluation of expressions without Python.
+ *
+ * The numeric part of the expressions, i.e. numbers, quantities, the operators and functions
+ * working on them, conditionals and references to properties holding them, is compiled into
+ * a sequence of instructions. The values are computed like the Python objects they stand for,
+ * but without creating them and without holding the GIL. Constant sub-expressions are computed
+ * once when compiling, which also checks their units. If a property holds something else or
+ * the evaluation fails, the expression is evaluated in Python instead, which also reports the
+ * error.
+ */
+
+class AppExport ExpressionProgram
+{
+public:
+    struct Value
+    {
+        enum Type
+        {
+            Int,
+            Float,
+            Bool,
+            Quant
+        };
+        Type type {Float};
+        long integer {0};
+        Base::Quantity quantity;
+
+        static Value fromInteger(long value);
+        static Value fromFloat(double value);
+        static Value fromBool(bool value);
+        static Value fromQuantity(const Base::Quantity& value);
+        /// like the Python object of a number expression, i.e. an int, float or Quantity
+        static Value fromNumber(const Base::Quantity& value);
+
+        bool isNumber() const
+        {
+            return type != Quant;
+        }
+        bool isInteger() const
+        {
+            return type == Int || type == Bool;
+        }
+        bool isTrue() const;
+        double toDouble() const;
+        Base::Quantity toQuantity() const;
+        App::any toAny() const;
+        Expression* toExpression(const App::DocumentObject* owner) const;
+    };
+
+    enum OpCode
+    {
+        PushConstant,
+        PushVariable,
+        Unary,
+        Binary,
+        Call,
+        JumpIfFalse,
+        Jump
+    };
+
+    /// The program of \a expr, it is compiled when called the first time
+    static const ExpressionProgram& get(const Expression* expr);
+
+    /// Evaluates the program, returns false if the expression must be evaluated in Python
+    bool run(Value& result) const;
+
+    /// Compiles \a expr, returns false if it is not in the numeric subset
+    bool add(const Expression* expr);
+    void addConstant(const Value& value);
+    void addVariable(const ObjectIdentifier& path);
+    /// Adds an instruction and returns its index
+    std::size_t addInstruction(OpCode code, int op = 0, int arg = 0);
+    /// Lets the jump at \a index continue after the last instruction
+    void setJumpTarget(std::size_t index);
+
+private:
+    struct Instruction
+    {
+        OpCode code;
+        int op;
+        int arg;
+    };
+
+    bool run(std::size_t begin, std::size_t end, Value& result) const;
+
+private:
+    std::vector<Instruction> instructions;
+    std::vector<Value> constants;
+    std::vector<const ObjectIdentifier*> variables;
+    std::size_t depth {0};
+    std::size_t maxDepth {0};
+    bool valid {false};
+};
+
 namespace ExpressionParser
 {
 AppExport Expression* parse(const App::DocumentObject* owner, const char* buffer);
@@ -371,3 +371,18 @@ DocumentObjectExecReturn* FeatureTestAttribute::execute()
     }
     return StdReturn;
 }
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(App::FeatureTestRestoring, App::DocumentObject)
+
+
+FeatureTestRestoring::FeatureTestRestoring() = default;
+
+void FeatureTestRestoring::onChanged(const Property* prop)
+{
+    if (isRestoring()) {
+        return;
+    }
+    DocumentObject::onChanged(prop);
+}
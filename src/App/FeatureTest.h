@@ -218,6 +218,18 @@ public:
     App::PropertyString Attribute;
 };
 
+class FeatureTestRestoring: public DocumentObject
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(App::FeatureTestRestoring);
+
+public:
+    FeatureTestRestoring();
+
+protected:
+    /// ignores the changes while restoring, without calling the base class
+    void onChanged(const Property* prop) override;
+};
+
 
 }  // namespace App
 
@@ -952,17 +952,15 @@ App::DocumentObject* ObjectIdentifier::getDocumentObject(const App::Document* do
         }
     }
 
-    std::vector<DocumentObject*> docObjects = doc->getObjects();
-    for (auto docObject : docObjects) {
-        if (strcmp(docObject->Label.getValue(), static_cast<const char*>(name)) == 0) {
-            // Found object with matching label
-            if (objectByLabel) {
-                FC_WARN("duplicate object label " << doc->getName() << '#'
-                                                  << static_cast<const char*>(name));
-                return nullptr;
-            }
-            objectByLabel = docObject;
-        }
+    std::vector<DocumentObject*> objectsByLabel = doc->getObjectsByLabel(name.getString());
+    if (objectsByLabel.size() > 1) {
+        FC_WARN("duplicate object label " << doc->getName() << '#'
+                                          << static_cast<const char*>(name));
+        return nullptr;
+    }
+    if (!objectsByLabel.empty()) {
+        // Found object with matching label
+        objectByLabel = objectsByLabel.front();
     }
 
     if (!objectByLabel && !objectById) {  // Not found at all
@@ -1412,6 +1410,17 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getWholeProperty() const
+{
+    ResolveResults result(*this);
+    if (!result.resolvedDocumentObject || result.propertyType != PseudoNone
+        || (!subObjectName.getString().empty() && !result.resolvedSubObject)
+        || result.propertyIndex + 1 != static_cast<int>(components.size())) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
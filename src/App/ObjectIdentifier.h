@@ -420,6 +420,11 @@ public:
 
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /** Returns the property if the identifier refers to its value as a whole, i.e. it is no
+     * pseudo property and has no sub-path, otherwise null
+     */
+    App::Property* getWholeProperty() const;
+
     App::ObjectIdentifier canonicalPath() const;
 
     // Document-centric functions
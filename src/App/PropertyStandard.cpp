@@ -1449,23 +1449,18 @@ void PropertyString::setValue(const char* newLabel)
         }
         App::Document* doc = obj->getDocument();
         if (doc && !_hPGrp->GetBool("DuplicateLabels") && !obj->allowDuplicateLabel()) {
-            std::vector<std::string> objectLabels;
-            std::vector<App::DocumentObject*>::const_iterator it;
-            std::vector<App::DocumentObject*> objs = doc->getObjects();
-            bool match = false;
-            for (it = objs.begin(); it != objs.end(); ++it) {
-                if (*it == obj) {
-                    continue;  // don't compare object with itself
-                }
-                std::string objLabel = (*it)->Label.getValue();
-                if (!match && objLabel == newLabel) {
-                    match = true;
+            // don't compare object with itself
+            auto usedByOthers = [doc, obj](const std::string& label) {
+                for (auto other : doc->getObjectsByLabel(label)) {
+                    if (other != obj) {
+                        return true;
+                    }
                 }
-                objectLabels.push_back(objLabel);
-            }
+                return false;
+            };
 
             // make sure that there is a name conflict otherwise we don't have to do anything
-            if (match && *newLabel) {
+            if (*newLabel && usedByOthers(newLabel)) {
                 label = newLabel;
                 // remove number from end to avoid lengthy names
                 size_t lastpos = label.length() - 1;
@@ -1492,17 +1487,13 @@ void PropertyString::setValue(const char* newLabel)
                             break;
                         }
                     }
-                    if (*c == 0
-                        && std::find(objectLabels.begin(),
-                                     objectLabels.end(),
-                                     obj->getNameInDocument())
-                            == objectLabels.end()) {
+                    if (*c == 0 && !usedByOthers(obj->getNameInDocument())) {
                         label = obj->getNameInDocument();
                         changed = true;
                     }
                 }
                 if (!changed) {
-                    label = Base::Tools::getUniqueName(label, objectLabels, 3);
+                    label = doc->getUniqueObjectLabel(label, obj);
                 }
             }
         }
@@ -1532,9 +1523,7 @@ void PropertyString::setValue(const char* newLabel)
         }
     }
 
-    aboutToSetValue();
-    _cValue = newLabel;
-    hasSetValue();
+    assignValue(newLabel);
 
     for (auto& change : propChanges) {
         change.first->Paste(*change.second.get());
@@ -1545,6 +1534,23 @@ void PropertyString::setValue(const char* newLabel)
     }
 }
 
+void PropertyString::assignValue(const char* newValue)
+{
+    // The document indexes the objects by their label. It is updated here and not in
+    // DocumentObject::onChanged(), which some objects skip while they are restored.
+    auto obj = dynamic_cast<DocumentObject*>(getContainer());
+    App::Document* doc = obj && this == &obj->Label ? obj->getDocument() : nullptr;
+    if (doc) {
+        doc->_removeObjectLabel(obj);
+    }
+    aboutToSetValue();
+    _cValue = newValue;
+    if (doc) {
+        doc->_addObjectLabel(obj);
+    }
+    hasSetValue();
+}
+
 void PropertyString::setValue(const std::string& sString)
 {
     setValue(sString.c_str());
@@ -1612,9 +1618,7 @@ void PropertyString::Restore(Base::XMLReader& reader)
         if (reader.hasAttribute("restore")) {
             int restore = reader.getAttributeAsInteger("restore");
             if (restore == 1) {
-                aboutToSetValue();
-                _cValue = reader.getAttribute("value");
-                hasSetValue();
+                assignValue(reader.getAttribute("value"));
             }
             else {
                 setValue(reader.getName(reader.getAttribute("value")));
@@ -795,6 +795,10 @@ public:
 
 protected:
     std::string _cValue;
+
+private:
+    /// sets the value, and the label of the object in the document index if this is its label
+    void assignValue(const char* newValue);
 };
 
 /** UUID properties
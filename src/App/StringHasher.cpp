@@ -24,15 +24,16 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <algorithm>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/split.hpp>
 #include <boost/bimap.hpp>
 #include <boost/bimap/set_of.hpp>
 #include <boost/bimap/unordered_set_of.hpp>
@@ -82,8 +83,13 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+    /// Shared by the lookups of existing IDs, held exclusively to add or remove IDs
+    mutable std::shared_mutex Mutex;
 };
 
+using ReadLock = std::shared_lock<std::shared_mutex>;
+using WriteLock = std::unique_lock<std::shared_mutex>;
+
 ///////////////////////////////////////////////////////////
 
 TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
@@ -91,6 +97,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
+        WriteLock lock(_hasher->_hashes->Mutex);
         _hasher->_hashes->right.erase(_id);
     }
 }
@@ -195,6 +202,8 @@ void StringHasher::compact()
         return;
     }
 
+    WriteLock lock(_hashes->Mutex);
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
@@ -251,6 +260,24 @@ long StringHasher::lastID() const
     return it->first;
 }
 
+StringID* StringHasher::find(long id) const
+{
+    auto it = _hashes->right.find(id);
+    if (it == _hashes->right.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+StringID* StringHasher::insertNew(const StringIDRef& sid)
+{
+    WriteLock lock(_hashes->Mutex);
+    // Another thread may have added the same string since the lookup, then insert() returns
+    // that ID instead and the next ID stays unused
+    sid._sid->_id = lastID() + 1;
+    return insert(sid);
+}
+
 StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
 {
     if (len < 0) {
@@ -259,43 +286,94 @@ StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
     return getID(QByteArray::fromRawData(text, len), hashable ? Option::Hashable : Option::None);
 }
 
-StringIDRef StringHasher::getID(const QByteArray& data, Options options)
+bool StringHasher::prepareData(QByteArray& data, Options options) const
 {
-    bool binary = options.testFlag(Option::Binary);
     bool hashable = options.testFlag(Option::Hashable);
-    bool nocopy = options.testFlag(Option::NoCopy);
-
     bool hashed = hashable && _hashes->Threshold > 0 && (int)data.size() > _hashes->Threshold;
-
-    StringID dataID;
     if (hashed) {
         QCryptographicHash hasher(QCryptographicHash::Sha1);
         hasher.addData(data);
-        dataID._data = hasher.result();
+        data = hasher.result();
     }
-    else {
-        dataID._data = data;
+    return hashed;
+}
+
+StringIDRef StringHasher::newID(const QByteArray& data, bool hashed, Options options) const
+{
+    StringID::Flags flags(StringID::Flag::None);
+    if (options.testFlag(Option::Binary)) {
+        flags.setFlag(StringID::Flag::Binary);
+    }
+    if (hashed) {
+        flags.setFlag(StringID::Flag::Hashed);
+        return {new StringID(0, data, flags)};
+    }
+    if (options.testFlag(Option::NoCopy)) {
+        return {new StringID(0, data, flags)};
     }
+    // if not hashed, make a deep copy of the data
+    return {new StringID(0, QByteArray(data.constData(), data.size()), flags)};
+}
+
+StringIDRef StringHasher::getID(const QByteArray& data, Options options)
+{
+    StringID dataID;
+    dataID._data = data;
+    bool hashed = prepareData(dataID._data, options);
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    {
+        ReadLock lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&dataID);
+        if (it != _hashes->left.end()) {
+            return {it->first};
+        }
     }
 
-    if (!hashed && !nocopy) {
-        // if not hashed, make a deep copy of the data
-        dataID._data = QByteArray(data.constData(), data.size());
+    return {insertNew(newID(dataID._data, hashed, options))};
+}
+
+std::vector<StringIDRef> StringHasher::getIDs(const std::vector<QByteArray>& data,
+                                              Options options)
+{
+    std::vector<StringIDRef> res(data.size());
+    std::vector<StringID> dataIDs(data.size());
+    std::vector<bool> hashed(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        dataIDs[i]._data = data[i];
+        hashed[i] = prepareData(dataIDs[i]._data, options);
     }
 
-    StringID::Flags flags(StringID::Flag::None);
-    if (binary) {
-        flags.setFlag(StringID::Flag::Binary);
+    bool missing = false;
+    {
+        ReadLock lock(_hashes->Mutex);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            auto it = _hashes->left.find(&dataIDs[i]);
+            if (it != _hashes->left.end()) {
+                res[i] = it->first;
+            }
+            else {
+                missing = true;
+            }
+        }
     }
-    if (hashed) {
-        flags.setFlag(StringID::Flag::Hashed);
+    if (!missing) {
+        return res;
+    }
+
+    // Create the new IDs outside of the lock, and add them in the order of the input data
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        if (!res[i]) {
+            res[i] = newID(dataIDs[i]._data, hashed[i], options);
+        }
+    }
+    WriteLock lock(_hashes->Mutex);
+    for (auto& sid : res) {
+        if (sid._sid->_hasher != this) {
+            sid._sid->_id = lastID() + 1;
+            sid = insert(sid);
+        }
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    return res;
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -321,13 +399,16 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        ReadLock lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&tempID);
+        if (it != _hashes->left.end()) {
+            auto res = StringIDRef(it->first);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -348,8 +429,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert, its ID is assigned by insertNew()
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -429,7 +510,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
-    return {insert(newStringIDRef), indexed.getIndex()};
+    return {insertNew(newStringIDRef), indexed.getIndex()};
 }
 
 StringIDRef StringHasher::getID(long id, int index) const
@@ -437,11 +518,8 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
-    auto it = _hashes->right.find(id);
-    if (it == _hashes->right.end()) {
-        return {};
-    }
-    StringIDRef res(it->second);
+    ReadLock lock(_hashes->Mutex);
+    StringIDRef res(find(id));
     res._index = index;
     return res;
 }
@@ -496,6 +574,7 @@ void StringHasher::SaveDocFile(Base::Writer& writer) const
 
 void StringHasher::saveStream(std::ostream& stream) const
 {
+    ReadLock lock(_hashes->Mutex);
     Base::TextOutputStream textStreamWrapper(stream);
     boost::io::ios_flags_saver ifs(stream);
     stream << std::hex;
@@ -610,17 +689,37 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     restoreStream(reader, count);
 }
 
+namespace
+{
+// Reads the next hex number of a '.' separated string table entry and moves \a pos behind it
+bool nextNumber(const char*& pos, long& value)
+{
+    if (*pos == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtol(pos, &end, 16);
+    if (end == pos || (*end != '.' && *end != '\0')) {
+        FC_THROWM(Base::RuntimeError, "Invalid string table");
+    }
+    pos = *end == '.' ? end + 1 : end;
+    return true;
+}
+}  // namespace
+
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
+    WriteLock lock(_hashes->Mutex);
     _hashes->clear();
+    _hashes->left.rehash(count);
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
-    std::vector<std::string> tokens;
     long lastid = 0;
     const StringID* last = nullptr;
 
+    // The entries are parsed in place, as the table of a large document has millions of them
     std::string tmp;
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -628,55 +727,40 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
             FC_THROWM(Base::RuntimeError, "Invalid string table");
         }
 
-        tokens.clear();
-        boost::split(tokens, tmp, boost::is_any_of("."));
-        if (tokens.size() < 2) {
-            FC_THROWM(Base::RuntimeError, "Invalid string table");
-        }
-
+        const char* pos = tmp.c_str();
+        bool relative = *pos == '-';
         long id = 0;
-        bool relative = false;
-        if (tokens[0][0] == '-') {
-            relative = true;
-            id = lastid + strtol(tokens[0].c_str() + 1, nullptr, 16);
+        long flag = 0;
+        if (!nextNumber(pos, id) || !nextNumber(pos, flag)) {
+            FC_THROWM(Base::RuntimeError, "Invalid string table");
         }
-        else {
-            id = strtol(tokens[0].c_str(), nullptr, 16);
+        if (relative) {
+            id = lastid - id;
         }
 
         lastid = id;
 
-        unsigned long flag = strtol(tokens[1].c_str(), nullptr, 16);
         StringIDRef sid(new StringID(id, QByteArray(), static_cast<StringID::Flag>(flag)));
 
         StringID& d = *sid._sid;
-        d._sids.reserve(tokens.size() - 2);
+        d._sids.reserve(static_cast<int>(std::count(pos, tmp.c_str() + tmp.size(), '.')) + 1);
 
-        int j = 2;
+        auto addRelated = [&d](StringID* related) {
+            if (!related) {
+                FC_THROWM(Base::RuntimeError, "Invalid string id reference");
+            }
+            d._sids.push_back(related);
+        };
+
+        long n = 0;
+        int j = 0;
         if (relative && last) {
-            for (; j < (int)tokens.size() && j - 2 < last->_sids.size(); ++j) {
-                long m = last->_sids[j - 2].value();
-                long n;
-                if (tokens[j][0] == '-') {
-                    n = -strtol(&tokens[j][1], nullptr, 16);
-                }
-                else {
-                    n = strtol(&tokens[j][0], nullptr, 16);
-                }
-                StringIDRef sid = getID(m + n);
-                if (!sid) {
-                    FC_THROWM(Base::RuntimeError, "Invalid string id reference");
-                }
-                d._sids.push_back(sid);
+            for (; j < last->_sids.size() && nextNumber(pos, n); ++j) {
+                addRelated(find(last->_sids[j].value() + n));
             }
         }
-        for (; j < (int)tokens.size(); ++j) {
-            long n = strtol(tokens[j].data(), nullptr, 16);
-            StringIDRef sid = getID(relative ? id - n : n);
-            if (!sid) {
-                FC_THROWM(Base::RuntimeError, "Invalid string id reference");
-            }
-            d._sids.push_back(sid);
+        while (nextNumber(pos, n)) {
+            addRelated(find(relative ? id - n : n));
         }
 
         if (!d.isPostfixed()) {
@@ -743,6 +827,7 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
+    WriteLock lock(_hashes->Mutex);
     _hashes->clear();
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
@@ -762,6 +847,7 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
+    WriteLock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
@@ -771,11 +857,13 @@ void StringHasher::clear()
 
 size_t StringHasher::size() const
 {
+    ReadLock lock(_hashes->Mutex);
     return _hashes->size();
 }
 
 size_t StringHasher::count() const
 {
+    ReadLock lock(_hashes->Mutex);
     size_t count = 0;
     for (auto& hasher : _hashes->right) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
@@ -822,6 +910,7 @@ void StringHasher::Restore(Base::XMLReader& reader)
         restoreStream(reader.beginCharStream(), count);
     }
     else {
+        WriteLock lock(_hashes->Mutex);
         for (std::size_t i = 0; i < count; ++i) {
             reader.readElement("Item");
             StringIDRef sid;
@@ -853,6 +942,7 @@ PyObject* StringHasher::getPyObject()
 
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
+    ReadLock lock(_hashes->Mutex);
     std::map<long, StringIDRef> ret;
     for (auto& hasher : _hashes->right) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
@@ -862,6 +952,7 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
+    ReadLock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
@@ -27,6 +27,7 @@
 
 #include <bitset>
 #include <memory>
+#include <vector>
 
 #include <QByteArray>
 #include <QVector>
@@ -630,6 +631,9 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// The hasher may be used from several threads. Lookups of existing strings and IDs run
+/// concurrently, only adding and removing IDs is serialized.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
@@ -703,6 +707,20 @@ public:
      */
     StringIDRef getID(const QByteArray& data, Options options = Option::Hashable);
 
+    /** Map a list of text or binary data to integers
+     *
+     * @param data: input data.
+     * @param options: options describing how to store the data.
+     * @return The StringIDs of the data in the same order.
+     *
+     * Same as calling getID(const QByteArray&, Options) for each entry, but the table is locked
+     * only once for all lookups and once for all new entries. It is meant for data that is known
+     * up front, e.g. a list of names to restore. TopoShape::makeShapeWithElementMap() still uses
+     * getID(), because each ID is part of the name it computes next.
+     */
+    std::vector<StringIDRef> getIDs(const std::vector<QByteArray>& data,
+                                    Options options = Option::Hashable);
+
     /** Map geometry element name to an integer */
     StringIDRef getID(const Data::MappedName& name, const QVector<StringIDRef>& sids);
 
@@ -771,12 +789,23 @@ public:
     friend class StringID;
 
 protected:
+    /// Adds \a sid to the table, or returns the existing ID of the same string.
+    /// The caller must lock the table for writing, as for lastID().
     StringID* insert(const StringIDRef& sid);
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
     void restoreStreamNew(std::istream& stream, std::size_t count);
 
+private:
+    /// Looks up the ID without locking the table
+    StringID* find(long id) const;
+    /// Assigns the next free ID to \a sid and adds it to the table
+    StringID* insertNew(const StringIDRef& sid);
+    /// Replaces \a data with its hash if needed, returns true if it was hashed
+    bool prepareData(QByteArray& data, Options options) const;
+    StringIDRef newID(const QByteArray& data, bool hashed, Options options) const;
+
 private:
     std::unique_ptr<HashMap>
         _hashes;  ///< Bidirectional map of StringID and its index (a long int).
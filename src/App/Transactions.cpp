@@ -30,13 +30,19 @@
 
 #include <atomic>
 #include <Base/Console.h>
+#include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
+#include <zipios++/zipinputstream.h>
 
 #include "Transactions.h"
+#include "ComplexGeoData.h"
 #include "Document.h"
 #include "DocumentObject.h"
 #include "Property.h"
+#include "PropertyGeo.h"
+#include "PropertyLinks.h"
 
 
 FC_LOG_LEVEL_INIT("App", true, true)
@@ -95,6 +101,10 @@ Transaction::~Transaction()
         }
         delete It.second;
     }
+
+    if (!swapFile.empty()) {
+        Base::FileInfo(swapFile).deleteFile();
+    }
 }
 
 static std::atomic<int> _TransactionID;
@@ -116,7 +126,15 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->getMemSize();
+        // an object removed from the document is only kept by the transaction
+        if (It.second->status == TransactionObject::New && !It.first->isAttachedToDocument()) {
+            size += It.first->getMemSize();
+        }
+    }
+    return size;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -171,6 +189,9 @@ void Transaction::apply(Document& Doc, bool forward)
 {
     std::string errMsg;
     try {
+        // do not apply an incomplete transaction
+        swapIn();
+
         auto& index = _Objects.get<0>();
         for (auto& info : index) {
             info.second->applyDel(Doc, const_cast<TransactionalObject*>(info.first));
@@ -197,6 +218,163 @@ void Transaction::apply(Document& Doc, bool forward)
     }
 }
 
+namespace
+{
+// property values smaller than this are kept in memory when a transaction is swapped out
+constexpr unsigned int swapOutSize = 0x10000;
+
+bool canSwapOut(const Property* prop)
+{
+    if (!prop || prop->getMemSize() < swapOutSize) {
+        return false;
+    }
+    // links cannot be restored without their container
+    if (prop->isDerivedFrom<PropertyLinkBase>()) {
+        return false;
+    }
+    // mapped element names refer to the string hasher of the document
+    auto geoProp = Base::freecad_dynamic_cast<const PropertyComplexGeoData>(prop);
+    if (geoProp) {
+        auto data = geoProp->getComplexData();
+        if (data && data->getElementMapSize(false) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+void Transaction::swapOut(const std::string& fileName)
+{
+    if (!swapFile.empty()) {
+        return;
+    }
+
+    auto& index = _Objects.get<0>();
+    int count = 0;
+    for (auto& info : index) {
+        for (auto& v : info.second->_PropChangeMap) {
+            if (canSwapOut(v.second.property)) {
+                v.second.swapped = true;
+                ++count;
+            }
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+
+    auto release = [&index](bool swapped) {
+        for (auto& info : index) {
+            for (auto& v : info.second->_PropChangeMap) {
+                if (v.second.swapped && swapped) {
+                    delete v.second.property;
+                    v.second.property = nullptr;
+                }
+                else {
+                    v.second.swapped = false;
+                }
+            }
+        }
+    };
+
+    Base::FileInfo fi(fileName);
+    try {
+        Base::ofstream file(fi, std::ios::out | std::ios::binary);
+        Base::ZipWriter writer(file);
+        writer.putNextEntry("Transaction.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>\n"
+                        << "<Transaction Count=\"" << count << "\">\n";
+        writer.incInd();
+        int object = 0;
+        for (auto& info : index) {
+            for (auto& v : info.second->_PropChangeMap) {
+                if (!v.second.swapped) {
+                    continue;
+                }
+                auto prop = v.second.property;
+                writer.Stream() << writer.ind() << "<Property Object=\"" << object << "\" Id=\""
+                                << v.first << "\" type=\"" << prop->getTypeId().getName()
+                                << "\" status=\"" << prop->getStatus() << "\">\n";
+                writer.incInd();
+                prop->Save(writer);
+                writer.decInd();
+                writer.Stream() << writer.ind() << "</Property>\n";
+            }
+            ++object;
+        }
+        writer.decInd();
+        writer.Stream() << "</Transaction>\n";
+        writer.writeFiles();
+        if (writer.hasErrors()) {
+            throw Base::FileException("Failed to write all data to file", fi);
+        }
+    }
+    catch (...) {
+        release(false);
+        fi.deleteFile();
+        throw;
+    }
+
+    release(true);
+    swapFile = fileName;
+}
+
+void Transaction::swapIn()
+{
+    if (swapFile.empty()) {
+        return;
+    }
+
+    std::vector<TransactionObject*> objects;
+    for (auto& info : _Objects.get<0>()) {
+        objects.push_back(info.second);
+    }
+
+    Base::FileInfo fi(swapFile);
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    zipios::ZipInputStream zipstream(file);
+    Base::XMLReader reader(swapFile.c_str(), zipstream);
+    if (!reader.isValid()) {
+        throw Base::FileException("Error reading compression file", fi);
+    }
+
+    reader.readElement("Transaction");
+    long count = reader.getAttributeAsInteger("Count");
+    for (long i = 0; i < count; ++i) {
+        reader.readElement("Property");
+        auto object = objects.at(reader.getAttributeAsUnsigned("Object"));
+        auto& data = object->_PropChangeMap.at(std::stoll(reader.getAttribute("Id")));
+        const char* type = reader.getAttribute("type");
+        auto prop = static_cast<Property*>(Base::Type::createInstanceByName(type));
+        if (!prop) {
+            throw Base::TypeError(std::string("Cannot create property of type ") + type);
+        }
+        prop->setStatusValue(reader.getAttributeAsUnsigned("status"));
+        delete data.property;
+        data.property = prop;
+        prop->Restore(reader);
+        reader.readEndElement("Property");
+    }
+    reader.readEndElement("Transaction");
+    reader.readFiles(zipstream);
+
+    for (auto object : objects) {
+        for (auto& v : object->_PropChangeMap) {
+            v.second.swapped = false;
+        }
+    }
+
+    file.close();
+    fi.deleteFile();
+    swapFile.clear();
+}
+
+bool Transaction::isSwappedOut() const
+{
+    return !swapFile.empty();
+}
+
 void Transaction::addObjectNew(TransactionalObject* Obj)
 {
     auto& index = _Objects.get<1>();
@@ -424,7 +602,15 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    // Note: Properties sharing their data with the document, e.g. a mesh that has not been
+    // modified since, are counted with their full size
+    unsigned int size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -62,6 +62,15 @@ public:
     /// apply the content to the document
     void apply(Document& Doc, bool forward);
 
+    /** Writes the large property values to the compressed file \a fileName and releases them to
+     * save memory. They are read back when the transaction is applied.
+     */
+    void swapOut(const std::string& fileName);
+    /// Reads back the property values written by swapOut()
+    void swapIn();
+    /// Returns true if property values are stored in a file
+    bool isSwappedOut() const;
+
     // the utf-8 name of the transaction
     std::string Name;
 
@@ -89,6 +98,7 @@ public:
 
 private:
     int transID;
+    std::string swapFile;
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -136,6 +146,7 @@ protected:
     {
         Base::Type propertyType;
         const Property* propertyOrig = nullptr;
+        bool swapped = false;
     };
     std::unordered_map<int64_t, PropData> _PropChangeMap;
 
@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -58,6 +59,80 @@ namespace App
 using HasherMap = boost::bimap<StringHasherRef, int>;
 class Transaction;
 
+/// The names of a collection by their base name, i.e. without the number at their end, so that
+/// a unique name is made without going through all names
+class NameIndex
+{
+public:
+    /// Splits \a name into its base and the number at its end
+    static std::pair<std::string, std::string> split(const std::string& name)
+    {
+        auto pos = name.find_last_not_of("0123456789");
+        if (pos == std::string::npos) {
+            return {name, {}};
+        }
+        return {name.substr(0, pos + 1), name.substr(pos + 1)};
+    }
+
+    void add(const std::string& name)
+    {
+        auto parts = split(name);
+        bases[parts.first].insert(parts.second);
+    }
+
+    void remove(const std::string& name)
+    {
+        auto parts = split(name);
+        auto it = bases.find(parts.first);
+        if (it == bases.end()) {
+            return;
+        }
+        auto number = it->second.find(parts.second);
+        if (number != it->second.end()) {
+            it->second.erase(number);
+        }
+        if (it->second.empty()) {
+            bases.erase(it);
+        }
+    }
+
+    /// Returns the name with the highest number for \a base, or \a base if there is none.
+    /// One occurrence of \a exclude is skipped, e.g. the old name of a renamed object.
+    std::string highest(const std::string& base, const std::string& exclude = {}) const
+    {
+        auto it = bases.find(base);
+        if (it == bases.end()) {
+            return base;
+        }
+        auto excluded = split(exclude);
+        bool skip = !exclude.empty() && excluded.first == base;
+        for (auto number = it->second.rbegin(); number != it->second.rend(); ++number) {
+            if (skip && *number == excluded.second) {
+                skip = false;
+                continue;
+            }
+            return base + *number;
+        }
+        return base;
+    }
+
+    void clear()
+    {
+        bases.clear();
+    }
+
+private:
+    // orders numbers given as strings, like Base::Tools::getUniqueName()
+    struct NumberLess
+    {
+        bool operator()(const std::string& s1, const std::string& s2) const
+        {
+            return s1.size() < s2.size() || (s1.size() == s2.size() && s1 < s2);
+        }
+    };
+    std::unordered_map<std::string, std::multiset<std::string, NumberLess>> bases;
+};
+
 // Pimpl class
 struct DocumentP
 {
@@ -66,6 +141,16 @@ struct DocumentP
     std::unordered_set<App::DocumentObject*> touchedObjs;
     std::unordered_map<std::string, DocumentObject*> objectMap;
     std::unordered_map<long, DocumentObject*> objectIdMap;
+    // indices of the object names and labels, kept up to date while objects are added, removed
+    // and relabeled
+    NameIndex objectNames;
+    NameIndex objectLabels;
+    std::unordered_multimap<std::string, DocumentObject*> objectLabelMap;
+    // the changed properties by object ID in the order of their first change while a batch is
+    // open, the ID is used because the object may be deleted meanwhile
+    int batchLevel {0};
+    std::vector<std::pair<long, const Property*>> batchChanges;
+    std::set<std::pair<long, const Property*>> batchChangeSet;
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
     long lastObjectId;
@@ -137,6 +222,17 @@ struct DocumentP
         }
         objectMap.clear();
         objectIdMap.clear();
+        clearObjectIndex();
+    }
+
+    // the IDs of the objects are reused, so the changes of a batch are dropped, too
+    void clearObjectIndex()
+    {
+        objectNames.clear();
+        objectLabels.clear();
+        objectLabelMap.clear();
+        batchChanges.clear();
+        batchChangeSet.clear();
     }
 
     const char* findRecomputeLog(const App::DocumentObject* obj)
@@ -157,6 +253,10 @@ struct DocumentP
     static std::vector<App::DocumentObject*>
     partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
     static void checkStringHasher(const Base::XMLReader& reader);
+    // the label after the highest numbered label of the objects other than exclude that share
+    // the base of the given label
+    std::string
+    nextObjectLabel(const std::string& label, const DocumentObject* exclude, int digits) const;
 };
 
 }  // namespace App
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#endif
+
+#include "BoundBoxTree.h"
+
+
+using namespace Base;
+
+namespace
+{
+// the number of primitives a leaf refers to at most
+constexpr int leafSize = 4;
+}  // namespace
+
+void BoundBoxTree::build(std::vector<BoundBox3f> primitiveBoxes)
+{
+    clear();
+    if (primitiveBoxes.empty()) {
+        return;
+    }
+    boxes = std::move(primitiveBoxes);
+
+    std::vector<Vector3f> centers;
+    centers.reserve(boxes.size());
+    primitives.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        centers.push_back(box.GetCenter());
+        primitives.push_back(static_cast<int>(primitives.size()));
+    }
+    // a binary tree with full leaves has less than twice as many nodes as leaves
+    nodes.reserve(2 * (boxes.size() / leafSize + 1));
+
+    // the first child of a node is added right after it and the second one when the first one
+    // has got all its descendants
+    struct Range
+    {
+        int node;
+        int parent;
+        int first;
+        int last;
+    };
+    std::vector<Range> stack {{0, -1, 0, static_cast<int>(boxes.size())}};
+    nodes.emplace_back();
+    while (!stack.empty()) {
+        Range range = stack.back();
+        stack.pop_back();
+        if (range.node < 0) {
+            range.node = static_cast<int>(nodes.size());
+            nodes.emplace_back();
+            nodes[range.parent].first = range.node;
+        }
+
+        BoundBox3f box;
+        for (int i = range.first; i < range.last; ++i) {
+            box.Add(boxes[primitives[i]]);
+        }
+        nodes[range.node].box = box;
+        if (range.last - range.first <= leafSize) {
+            nodes[range.node].first = range.first;
+            nodes[range.node].count = range.last - range.first;
+            continue;
+        }
+
+        // split at the median along the longest side of the box
+        float lengths[3] = {box.LengthX(), box.LengthY(), box.LengthZ()};
+        int axis = static_cast<int>(std::max_element(lengths, lengths + 3) - lengths);
+        int middle = (range.first + range.last) / 2;
+        std::nth_element(primitives.begin() + range.first,
+                         primitives.begin() + middle,
+                         primitives.begin() + range.last,
+                         [&centers, axis](int p1, int p2) {
+                             return centers[p1][axis] < centers[p2][axis];
+                         });
+
+        int child = static_cast<int>(nodes.size());
+        nodes.emplace_back();
+        nodes[range.node].count = 0;
+        stack.push_back({-1, range.node, middle, range.last});
+        stack.push_back({child, -1, range.first, middle});
+    }
+}
+
+void BoundBoxTree::clear()
+{
+    nodes.clear();
+    primitives.clear();
+    boxes.clear();
+}
+
+std::vector<int>
+BoundBoxTree::findAlongLine(const Vector3f& base, const Vector3f& dir, float tolerance) const
+{
+    std::vector<int> result;
+    search(
+        [&](const BoundBox3f& box) {
+            BoundBox3f enlarged(box);
+            enlarged.Enlarge(tolerance);
+            return isCutByLine(enlarged, base, dir);
+        },
+        [&result](int index) {
+            result.push_back(index);
+        });
+    return result;
+}
+
+bool BoundBoxTree::isCutByLine(const BoundBox3f& box, const Vector3f& base, const Vector3f& dir)
+{
+    const float mins[3] = {box.MinX, box.MinY, box.MinZ};
+    const float maxs[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    float tmin = -std::numeric_limits<float>::max();
+    float tmax = std::numeric_limits<float>::max();
+    for (int i = 0; i < 3; ++i) {
+        if (std::fabs(dir[i]) < std::numeric_limits<float>::epsilon()) {
+            // the line is parallel to the slab
+            if (base[i] < mins[i] || base[i] > maxs[i]) {
+                return false;
+            }
+            continue;
+        }
+        float t1 = (mins[i] - base[i]) / dir[i];
+        float t2 = (maxs[i] - base[i]) / dir[i];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+        if (tmin > tmax) {
+            return false;
+        }
+    }
+    return true;
+}
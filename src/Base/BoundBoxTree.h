@@ -0,0 +1,120 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef BASE_BOUNDBOXTREE_H
+#define BASE_BOUNDBOXTREE_H
+
+#ifndef FC_GLOBAL_H
+#include <FCGlobal.h>
+#endif
+#include <vector>
+
+#include "BoundBox.h"
+
+
+namespace Base
+{
+
+/** A bounding volume hierarchy over primitives like triangles or line segments, given by their
+ * bounding boxes. A search, e.g. for the primitives cut by a pick ray, only visits the branches
+ * whose box passes the test, so that its cost grows with the logarithm of the number of
+ * primitives.
+ */
+class BaseExport BoundBoxTree
+{
+public:
+    /// Builds the tree, the primitives are identified by the index of their box in
+    /// \a primitiveBoxes
+    void build(std::vector<BoundBox3f> primitiveBoxes);
+    void clear();
+    bool empty() const
+    {
+        return nodes.empty();
+    }
+    /// Returns the number of primitives
+    std::size_t size() const
+    {
+        return primitives.size();
+    }
+
+    /** Calls \a visit with the index of each primitive whose box passes \a test. The box of a
+     * branch contains the boxes of all its primitives and is tested first, so \a test must accept
+     * it if it accepts any of them.
+     */
+    template<typename Test, typename Visit>
+    void search(Test test, Visit visit) const;
+
+    /// Returns the primitives whose box enlarged by \a tolerance is cut by the line through
+    /// \a base in the direction \a dir
+    std::vector<int>
+    findAlongLine(const Vector3f& base, const Vector3f& dir, float tolerance = 0.0F) const;
+
+    /// True if the line through \a base in the direction \a dir cuts \a box
+    static bool isCutByLine(const BoundBox3f& box, const Vector3f& base, const Vector3f& dir);
+
+private:
+    struct Node
+    {
+        BoundBox3f box;
+        // a leaf refers to count primitives starting at first, the first child of an inner node
+        // follows it and first is the index of the second child
+        int first {0};
+        int count {0};
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> primitives;
+    std::vector<BoundBox3f> boxes;
+};
+
+template<typename Test, typename Visit>
+void BoundBoxTree::search(Test test, Visit visit) const
+{
+    if (nodes.empty()) {
+        return;
+    }
+
+    std::vector<int> stack {0};
+    while (!stack.empty()) {
+        int index = stack.back();
+        stack.pop_back();
+        const Node& node = nodes[index];
+        if (!test(node.box)) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                if (test(boxes[primitives[i]])) {
+                    visit(primitives[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+        }
+    }
+}
+
+}  // namespace Base
+
+#endif  // BASE_BOUNDBOXTREE_H
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cctype>
 # include <mutex>
 # include <QApplication>
@@ -507,6 +508,10 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // set the memory limit in MB, the data of older steps is moved to files
+        unsigned long undoMemory = hGrp->GetUnsigned("MaxUndoMemory", 0);
+        undoMemory = std::min<unsigned long>(undoMemory, 4095);
+        d->_pcDocument->setUndoLimit(static_cast<unsigned int>(undoMemory << 20));
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
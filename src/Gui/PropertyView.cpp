@@ -104,8 +104,9 @@ PropertyView::PropertyView(QWidget *parent)
     connect(tabs, &QTabWidget::currentChanged, this, &PropertyView::tabChanged);
 
     //NOLINTBEGIN
+    // a batch of changes, e.g. from a script, updates the editor only once per property
     this->connectPropData =
-    App::GetApplication().signalChangedObject.connect(std::bind
+    App::GetApplication().signalChangedObjectCoalesced.connect(std::bind
         (&PropertyView::slotChangePropertyData, this, sp::_2));
     this->connectPropView =
     Gui::Application::Instance->signalChangedObject.connect(std::bind
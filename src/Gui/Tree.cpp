@@ -332,6 +332,12 @@ public:
                     auto childVp = docItem->getViewProvider(child);
                     if (childVp && child->getDocument() == obj->getDocument())
                         childVp->setShowable(docItem->isObjectShowable(child));
+
+                    // The child may have no item yet because it was left to this parent
+                    auto it = docItem->ObjectMap.find(child);
+                    if (it != docItem->ObjectMap.end() && it->second->items.empty()
+                            && !docItem->isItemDeferred(child))
+                        docItem->createNewItem(*it->second->viewObject);
                 }
             }
         }
@@ -3027,6 +3033,7 @@ void TreeWidget::onUpdateStatus()
         auto docItem = getDocumentItem(gdoc);
         if (!docItem)
             continue;
+        std::vector<ViewProviderDocumentObject*> newViews;
         for (auto id : v.second) {
             auto obj = doc->getObjectByID(id);
             if (!obj)
@@ -3036,7 +3043,15 @@ void TreeWidget::onUpdateStatus()
             if (docItem->ObjectMap.count(obj))
                 continue;
             auto vpd = Base::freecad_dynamic_cast<ViewProviderDocumentObject>(gdoc->getViewProvider(obj));
-            if (vpd)
+            if (vpd && docItem->createObjectData(*vpd))
+                newViews.push_back(vpd);
+        }
+
+        // Now that the parents of all new objects are known, only create the items that
+        // are not left to a collapsed parent item. This avoids building items for the
+        // content of groups or link arrays of huge documents that nobody looks at.
+        for (auto vpd : newViews) {
+            if (!docItem->isItemDeferred(vpd->getObject()))
                 docItem->createNewItem(*vpd);
         }
     }
@@ -3115,8 +3130,8 @@ void TreeWidget::onUpdateStatus()
                     continue;
                 if (iter->second->rootItem)
                     docItem->restoreItemExpansion(entry.second, iter->second->rootItem);
-                else if (legacy && !iter->second->items.empty()) {
-                    auto item = *iter->second->items.begin();
+                else if (legacy && docItem->populateDeferredItem(obj)) {
+                    auto item = *docItem->ObjectMap[obj]->items.begin();
                     item->setExpanded(true);
                 }
             }
@@ -3879,28 +3894,14 @@ void DocumentItem::slotNewObject(const Gui::ViewProviderDocumentObject& obj) {
 bool DocumentItem::createNewItem(const Gui::ViewProviderDocumentObject& obj,
     QTreeWidgetItem* parent, int index, DocumentObjectDataPtr data)
 {
-    if (!obj.getObject() ||
-        !obj.getObject()->isAttachedToDocument() ||
-        obj.getObject()->testStatus(App::PartialObject))
-        return false;
-
     if (!data) {
-        auto& pdata = ObjectMap[obj.getObject()];
-        if (!pdata) {
-            pdata = std::make_shared<DocumentObjectData>(
-                this, const_cast<ViewProviderDocumentObject*>(&obj));
-            auto& entry = getTree()->ObjectTable[obj.getObject()];
-            if (!entry.empty())
-                pdata->updateChildren(*entry.begin());
-            else
-                pdata->updateChildren(true);
-            entry.insert(pdata);
-        }
-        else if (pdata->rootItem && !parent) {
+        data = createObjectData(obj);
+        if (!data)
+            return false;
+        if (data->rootItem && !parent) {
             Base::Console().Warning("DocumentItem::slotNewObject: Cannot add view provider twice.\n");
             return false;
         }
-        data = pdata;
     }
 
     auto item = new DocumentObjectItem(this, data);
@@ -3927,6 +3928,111 @@ bool DocumentItem::createNewItem(const Gui::ViewProviderDocumentObject& obj,
     return true;
 }
 
+DocumentObjectDataPtr DocumentItem::createObjectData(const Gui::ViewProviderDocumentObject& obj)
+{
+    if (!obj.getObject() ||
+        !obj.getObject()->isAttachedToDocument() ||
+        obj.getObject()->testStatus(App::PartialObject))
+        return {};
+
+    auto& pdata = ObjectMap[obj.getObject()];
+    if (!pdata) {
+        pdata = std::make_shared<DocumentObjectData>(
+            this, const_cast<ViewProviderDocumentObject*>(&obj));
+        auto& entry = getTree()->ObjectTable[obj.getObject()];
+        if (!entry.empty())
+            pdata->updateChildren(*entry.begin());
+        else
+            pdata->updateChildren(true);
+        entry.insert(pdata);
+    }
+    return pdata;
+}
+
+bool DocumentItem::isItemDeferred(App::DocumentObject* obj)
+{
+    std::set<App::DocumentObject*> visited;
+    visited.insert(obj);
+    auto itParents = _ParentMap.find(obj);
+    if (itParents == _ParentMap.end())
+        return false;
+    for (auto parent : itParents->second) {
+        auto it = ObjectMap.find(parent);
+        if (it != ObjectMap.end() && it->second->removeChildrenFromRoot
+                && hasParentItem(parent, visited))
+            return true;
+    }
+    return false;
+}
+
+bool DocumentItem::hasParentItem(App::DocumentObject* obj, std::set<App::DocumentObject*>& visited)
+{
+    // Checks whether the object has or will get an item, either at the root level or below a
+    // parent that has one. A cyclic dependency doesn't count.
+    auto it = ObjectMap.find(obj);
+    if (it == ObjectMap.end())
+        return false;
+    if (!it->second->items.empty())
+        return true;
+    if (!visited.insert(obj).second)
+        return false;
+
+    bool deferred = false;
+    auto itParents = _ParentMap.find(obj);
+    if (itParents != _ParentMap.end()) {
+        for (auto parent : itParents->second) {
+            auto itParent = ObjectMap.find(parent);
+            if (itParent == ObjectMap.end() || !itParent->second->removeChildrenFromRoot)
+                continue;
+            deferred = true;
+            if (hasParentItem(parent, visited))
+                return true;
+        }
+    }
+    return !deferred;
+}
+
+bool DocumentItem::populateDeferredItem(App::DocumentObject* obj)
+{
+    std::set<App::DocumentObject*> visited;
+    return populateDeferredItem(obj, visited);
+}
+
+bool DocumentItem::populateDeferredItem(App::DocumentObject* obj,
+                                        std::set<App::DocumentObject*>& visited)
+{
+    auto it = ObjectMap.find(obj);
+    if (it == ObjectMap.end())
+        return false;
+    // keep the data, populating items may add to the map
+    auto data = it->second;
+    if (!data->items.empty())
+        return true;
+    if (!visited.insert(obj).second)
+        return false;
+
+    auto itParents = _ParentMap.find(obj);
+    if (itParents == _ParentMap.end())
+        return false;
+    std::vector<App::DocumentObject*> parents(itParents->second.begin(), itParents->second.end());
+    for (auto parent : parents) {
+        if (!populateDeferredItem(parent, visited))
+            continue;
+        auto itParent = ObjectMap.find(parent);
+        if (itParent == ObjectMap.end() || itParent->second->items.empty())
+            continue;
+        auto item = *itParent->second->items.begin();
+        if (!item->populated) {
+            TREE_LOG("populate deferred object " << obj->getFullName());
+            item->populated = true;
+            populateItem(item, true);
+        }
+        if (!data->items.empty())
+            return true;
+    }
+    return false;
+}
+
 ViewProviderDocumentObject* DocumentItem::getViewProvider(App::DocumentObject* obj) {
     return Base::freecad_dynamic_cast<ViewProviderDocumentObject>(
             Application::Instance->getViewProvider(obj));
@@ -4006,7 +4112,7 @@ void TreeWidget::_slotDeleteObject(const Gui::ViewProviderDocumentObject& view,
             docItem->_ParentMap[child].erase(obj);
             auto cit = docItem->ObjectMap.find(child);
             if (cit == docItem->ObjectMap.end() || cit->second->items.empty()) {
-                if (docItem->createNewItem(*childVp))
+                if (!docItem->isItemDeferred(child) && docItem->createNewItem(*childVp))
                     needUpdate = true;
             }
             else {
@@ -4072,6 +4178,9 @@ void DocumentItem::populateItem(DocumentObjectItem* item, bool refresh, bool del
         for (auto child : item->myData->children) {
             auto it = ObjectMap.find(child);
             if (it == ObjectMap.end() || it->second->items.empty()) {
+                // the item of a child removed from the root level is created on expansion
+                if (it != ObjectMap.end() && item->myData->removeChildrenFromRoot)
+                    continue;
                 auto vp = getViewProvider(child);
                 if (!vp) continue;
                 doPopulate = true;
@@ -4547,6 +4656,7 @@ void DocumentItem::Restore(Base::XMLReader& reader) {
 
 void DocumentItem::restoreItemExpansion(const ExpandInfoPtr& info, DocumentObjectItem* item) {
     item->setExpanded(true);
+    populateItem(item);
     if (!info)
         return;
     for (int i = 0, count = item->childCount(); i < count; ++i) {
@@ -4583,6 +4693,9 @@ void DocumentItem::slotExpandObject(const Gui::ViewProviderDocumentObject& obj,
         return;
     }
 
+    if (mode == TreeItemMode::ExpandItem || mode == TreeItemMode::ExpandPath)
+        populateDeferredItem(obj.getObject());
+
     FOREACH_ITEM(item, obj)
         // All document object items must always have a parent, either another
         // object item or document item. If not, then there is a bug somewhere
@@ -4644,6 +4757,7 @@ void DocumentItem::slotScrollToObject(const Gui::ViewProviderDocumentObject& obj
 {
     if (!obj.getObject() || !obj.getObject()->isAttachedToDocument())
         return;
+    populateDeferredItem(obj.getObject());
     auto it = ObjectMap.find(obj.getObject());
     if (it == ObjectMap.end() || it->second->items.empty())
         return;
@@ -4720,6 +4834,17 @@ void DocumentItem::clearSelection(DocumentObjectItem* exclude)
 }
 
 void DocumentItem::updateSelection(QTreeWidgetItem* ti, bool unselect) {
+    if (unselect && ti->type() == TreeWidget::ObjectType) {
+        // The children of a collapsed item may not have items yet but still be selected,
+        // so create them to unselect them together with their parent
+        auto item = static_cast<DocumentObjectItem*>(ti);
+        if (!item->populated && !item->myData->children.empty()
+                && Selection().hasSelection(document()->getDocument()->getName())) {
+            item->populated = true;
+            populateItem(item, true);
+        }
+    }
+
     for (int i = 0, count = ti->childCount(); i < count; ++i) {
         auto child = ti->child(i);
         if (child && child->type() == TreeWidget::ObjectType) {
@@ -4820,6 +4945,7 @@ void DocumentItem::updateItemSelection(DocumentObjectItem* item)
 }
 
 App::DocumentObject* DocumentItem::getTopParent(App::DocumentObject* obj, std::string& subname) {
+    populateDeferredItem(obj);
     auto it = ObjectMap.find(obj);
     if (it == ObjectMap.end() || it->second->items.empty())
         return nullptr;
@@ -4902,6 +5028,10 @@ DocumentObjectItem* DocumentItem::findItemByObject(
     if (!subname)
         subname = "";
 
+    // the object may be inside a collapsed branch whose items are not created yet
+    if (!populateDeferredItem(obj))
+        return nullptr;
+
     auto it = ObjectMap.find(obj);
     if (it == ObjectMap.end() || it->second->items.empty())
         return nullptr;
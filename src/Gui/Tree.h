@@ -357,6 +357,17 @@ protected:
     bool createNewItem(const Gui::ViewProviderDocumentObject&,
                     QTreeWidgetItem *parent=nullptr, int index=-1,
                     DocumentObjectDataPtr ptrs = DocumentObjectDataPtr());
+    DocumentObjectDataPtr createObjectData(const Gui::ViewProviderDocumentObject&);
+
+    /** Checks whether the item of an object can be left to the items of its parents.
+     * This is the case if a parent removes its children from the root level and is itself
+     * shown in the tree. The item is then only created once the parent item gets populated,
+     * e.g. when it is expanded or the object is selected.
+     */
+    bool isItemDeferred(App::DocumentObject *obj);
+    /// Populates the parent items of an object whose item was deferred, returns true if the
+    /// object has an item afterwards
+    bool populateDeferredItem(App::DocumentObject *obj);
 
     int findRootIndex(App::DocumentObject *childObj);
 
@@ -371,6 +382,10 @@ protected:
     using ViewParentMap = std::unordered_map<const ViewProvider *, std::vector<ViewProviderDocumentObject*> >;
     void populateParents(const ViewProvider *vp, ViewParentMap &);
 
+private:
+    bool hasParentItem(App::DocumentObject *obj, std::set<App::DocumentObject*> &visited);
+    bool populateDeferredItem(App::DocumentObject *obj, std::set<App::DocumentObject*> &visited);
+
 private:
     const char *treeName; // for debugging purpose
     Gui::Document* pDocument;
@@ -26,7 +26,16 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cfloat>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <tuple>
 
 #include <boost_geometry.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -53,6 +62,7 @@
 #include <GCPnts_UniformDeflection.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <gp_Circ.hxx>
+#include <gp_Quaternion.hxx>
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
@@ -560,59 +570,29 @@ void Area::add(const TopoDS_Shape& shape, short op)
     myShapes.emplace_back(op, shape);
 }
 
-class ClearedAreaSegmentVisitor: public PathSegmentVisitor
+namespace
 {
-private:
-    CArea pathSegments;
-    CArea holes;
-    double maxZ;
-    double radius;
-    Base::BoundBox3d bbox;
-
-    void point(const Base::Vector3d& p)
-    {
-        if (p.z <= maxZ) {
-            if (bbox.MinX <= p.x && p.x <= bbox.MaxX && bbox.MinY <= p.y && p.y <= bbox.MaxY) {
-                CCurve curve;
-                curve.append(CVertex {{p.x + radius, p.y}});
-                curve.append(CVertex {1, {p.x - radius, p.y}, {p.x, p.y}});
-                curve.append(CVertex {1, {p.x + radius, p.y}, {p.x, p.y}});
-                holes.append(curve);
-            }
-        }
-    }
 
-    void line(const Base::Vector3d& last, const Base::Vector3d& next)
+// A tool path reduced to what getClearedArea() needs: its linear moves, arcs and drill points
+struct ClearedPathItem
+{
+    enum Type
     {
-        if (last.z <= maxZ && next.z <= maxZ) {
-            Base::BoundBox2d segBox = {};
-            segBox.Add({last.x, last.y});
-            segBox.Add({next.x, next.y});
-            if (bbox.Intersect(segBox)) {
-                CCurve curve;
-                curve.append(CVertex {{last.x, last.y}});
-                curve.append(CVertex {{next.x, next.y}});
-                pathSegments.append(curve);
-            }
-        }
-    }
+        Line,
+        Arc,
+        Point,
+    };
+    Type type;
+    bool ccw;
+    Base::Vector3d last;
+    Base::Vector3d next;
+    Base::Vector3d center;
+};
 
+class ClearedPathSegmentVisitor: public PathSegmentVisitor
+{
 public:
-    ClearedAreaSegmentVisitor(double maxZ, double radius, Base::BoundBox3d bbox)
-        : maxZ(maxZ)
-        , radius(radius)
-        , bbox(bbox)
-    {
-        bbox.Enlarge(radius);
-    }
-
-    CArea getClearedArea()
-    {
-        CArea result {pathSegments};
-        result.Thicken(radius);
-        result.Union(holes);
-        return result;
-    }
+    std::vector<ClearedPathItem> items;
 
     void g0(int id,
             const Base::Vector3d& last,
@@ -641,18 +621,12 @@ public:
              const Base::Vector3d& center) override
     {
         (void)id;
-        (void)center;
 
         // Compute cw vs ccw
         const Base::Vector3d vdirect = next - last;
         const Base::Vector3d vstep = pts[0] - last;
         const bool ccw = vstep.x * vdirect.y - vstep.y * vdirect.x > 0;
-
-        // Add an arc
-        CCurve curve;
-        curve.append(CVertex {{last.x, last.y}});
-        curve.append(CVertex {ccw ? 1 : -1, {next.x, next.y}, {center.x, center.y}});
-        pathSegments.append(curve);
+        items.push_back({ClearedPathItem::Arc, ccw, last, next, center});
     }
 
     void g8x(int id,
@@ -667,14 +641,15 @@ public:
         (void)qlist;  // pecks are always within the bounds of plist
 
         point(last);
-        for (const auto p : pts) {
+        for (const auto& p : pts) {
             point(p);
         }
-        for (const auto p : plist) {
+        for (const auto& p : plist) {
             point(p);
         }
         point(next);
     }
+
     void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next) override
     {
         // probe operation; clears nothing
@@ -682,8 +657,172 @@ public:
         (void)last;
         (void)next;
     }
+
+private:
+    void line(const Base::Vector3d& last, const Base::Vector3d& next)
+    {
+        items.push_back({ClearedPathItem::Line, false, last, next, Base::Vector3d()});
+    }
+
+    void point(const Base::Vector3d& p)
+    {
+        items.push_back({ClearedPathItem::Point, false, p, p, p});
+    }
+};
+
+// Spatial index of the items of a tool path. It is built once per tool path and kept in
+// ClearedPathCache, so that getClearedArea() for the many sections and the many following
+// operations of a job only has to look at the items close to the queried region.
+class ClearedPathIndex
+{
+public:
+    using Box = bg::model::box<gp_Pnt>;
+    using RValue = std::pair<Box, std::size_t>;
+
+    explicit ClearedPathIndex(const Toolpath& path)
+    {
+        // Start far above the stock, so that the moves before the first Z are never counted as
+        // cutting, whatever height is queried later
+        ClearedPathSegmentVisitor visitor;
+        PathSegmentWalker walker(path);
+        walker.walk(visitor, Base::Vector3d(0, 0, 1e10));
+        items = std::move(visitor.items);
+
+        std::vector<RValue> values;
+        values.reserve(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            values.emplace_back(itemBox(items[i]), i);
+        }
+        // bulk loading gives a much better tree than inserting one by one
+        rtree = bgi::rtree<RValue, RParameters>(values.begin(), values.end());
+    }
+
+    template<class Func>
+    void query(const Base::BoundBox3d& bbox, Func func) const
+    {
+        Box box(gp_Pnt(bbox.MinX, bbox.MinY, -DBL_MAX), gp_Pnt(bbox.MaxX, bbox.MaxY, DBL_MAX));
+        std::vector<RValue> found;
+        rtree.query(bgi::intersects(box), std::back_inserter(found));
+        // keep the order of the tool path, so the result does not depend on the tree layout
+        std::sort(found.begin(), found.end(), [](const RValue& a, const RValue& b) {
+            return a.second < b.second;
+        });
+        for (const auto& v : found) {
+            func(items[v.second]);
+        }
+    }
+
+private:
+    static Box itemBox(const ClearedPathItem& item)
+    {
+        Base::BoundBox3d bound;
+        bound.Add(item.last);
+        bound.Add(item.next);
+        if (item.type == ClearedPathItem::Arc) {
+            // the full circle, good enough for finding candidates
+            double radius = Base::Vector3d(item.last.x - item.center.x,
+                                           item.last.y - item.center.y,
+                                           0)
+                                .Length();
+            bound.Add(Base::Vector3d(item.center.x - radius, item.center.y - radius, item.last.z));
+            bound.Add(Base::Vector3d(item.center.x + radius, item.center.y + radius, item.last.z));
+        }
+        return Box(gp_Pnt(bound.MinX, bound.MinY, bound.MinZ),
+                   gp_Pnt(bound.MaxX, bound.MaxY, bound.MaxZ));
+    }
+
+private:
+    std::vector<ClearedPathItem> items;
+    bgi::rtree<RValue, RParameters> rtree;
+};
+
+class ClearedPathCache
+{
+public:
+    static ClearedPathCache& instance()
+    {
+        static ClearedPathCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const ClearedPathIndex> get(const Toolpath& path)
+    {
+        std::size_t hash = pathHash(path);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& entry : entries) {
+                if (entry.hash == hash && samePath(entry.path, path)) {
+                    return entry.index;
+                }
+            }
+        }
+
+        auto index = std::make_shared<const ClearedPathIndex>(path);
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.push_back({hash, path, index});
+        while (entries.size() > maxEntries) {
+            entries.pop_front();
+        }
+        return index;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+    }
+
+private:
+    static std::size_t pathHash(const Toolpath& path)
+    {
+        std::size_t hash = path.getSize();
+        auto combine = [&hash](std::size_t h) {
+            hash ^= h + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        };
+        const Base::Vector3d& center = path.getCenter();
+        combine(std::hash<double>()(center.x));
+        combine(std::hash<double>()(center.y));
+        combine(std::hash<double>()(center.z));
+        for (const Command* cmd : path.getCommands()) {
+            combine(std::hash<std::string>()(cmd->Name));
+            for (const auto& param : cmd->Parameters) {
+                combine(std::hash<std::string>()(param.first));
+                combine(std::hash<double>()(param.second));
+            }
+        }
+        return hash;
+    }
+
+    static bool samePath(const Toolpath& a, const Toolpath& b)
+    {
+        if (a.getSize() != b.getSize() || a.getCenter() != b.getCenter()) {
+            return false;
+        }
+        for (unsigned int i = 0; i < a.getSize(); ++i) {
+            const Command& ca = a.getCommand(i);
+            const Command& cb = b.getCommand(i);
+            if (ca.Name != cb.Name || ca.Parameters != cb.Parameters) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct Entry
+    {
+        std::size_t hash;
+        Toolpath path;
+        std::shared_ptr<const ClearedPathIndex> index;
+    };
+
+    static constexpr std::size_t maxEntries = 64;
+
+    std::mutex mutex;
+    std::deque<Entry> entries;
 };
 
+}  // namespace
+
 std::shared_ptr<Area>
 Area::getClearedArea(const Toolpath* path, double diameter, double zmax, Base::BoundBox3d bbox)
 {
@@ -700,19 +839,57 @@ Area::getClearedArea(const Toolpath* path, double diameter, double zmax, Base::B
     params.SubjectFill = ClipperLib::pftNonZero;
     params.ClipFill = ClipperLib::pftNonZero;
     const double buffer = myParams.Accuracy * 3;
+    const double radius = diameter / 2 + buffer;
 
     // Do not fit arcs after these offsets; it introduces unnecessary approximation error, and all
     // off those arcs will be converted back to segments again for clipper differencing in
     // getRestArea anyway
     CAreaConfig conf(params, /*no_fit_arcs*/ true);
 
-    ClearedAreaSegmentVisitor visitor(zmax, diameter / 2 + buffer, bbox);
-    PathSegmentWalker walker(*path);
-    walker.walk(visitor, Base::Vector3d(0, 0, zmax + 1));
+    // Only the moves whose swept area can reach into bbox matter
+    bbox.Enlarge(radius);
+    CArea pathSegments;
+    CArea holes;
+    ClearedPathCache::instance().get(*path)->query(bbox, [&](const ClearedPathItem& item) {
+        switch (item.type) {
+            case ClearedPathItem::Line:
+                if (item.last.z <= zmax && item.next.z <= zmax) {
+                    CCurve curve;
+                    curve.append(CVertex {{item.last.x, item.last.y}});
+                    curve.append(CVertex {{item.next.x, item.next.y}});
+                    pathSegments.append(curve);
+                }
+                break;
+            case ClearedPathItem::Arc: {
+                CCurve curve;
+                curve.append(CVertex {{item.last.x, item.last.y}});
+                curve.append(CVertex {item.ccw ? 1 : -1,
+                                      {item.next.x, item.next.y},
+                                      {item.center.x, item.center.y}});
+                pathSegments.append(curve);
+                break;
+            }
+            case ClearedPathItem::Point: {
+                const Base::Vector3d& p = item.last;
+                if (p.z <= zmax && bbox.MinX <= p.x && p.x <= bbox.MaxX && bbox.MinY <= p.y
+                    && p.y <= bbox.MaxY) {
+                    CCurve curve;
+                    curve.append(CVertex {{p.x + radius, p.y}});
+                    curve.append(CVertex {1, {p.x - radius, p.y}, {p.x, p.y}});
+                    curve.append(CVertex {1, {p.x + radius, p.y}, {p.x, p.y}});
+                    holes.append(curve);
+                }
+                break;
+            }
+        }
+    });
+
+    CArea ca {pathSegments};
+    ca.Thicken(radius);
+    ca.Union(holes);
 
     std::shared_ptr<Area> clearedArea = make_shared<Area>(&params);
     clearedArea->myTrsf = {};
-    const CArea ca = visitor.getClearedArea();
     if (ca.m_curves.size() > 0) {
         TopoDS_Shape clearedAreaShape = Area::toShape(ca, false);
         clearedArea->add(clearedAreaShape, OperationCompound);
@@ -745,6 +922,27 @@ std::shared_ptr<Area> Area::getRestArea(std::vector<std::shared_ptr<Area>> clear
     const double buffer = myParams.Accuracy * 3;
     const double roundPrecision = params.Accuracy;
 
+    CArea clearable(*myArea);
+    clearable.OffsetWithClipper(-diameter / 2,
+                                JoinType,
+                                EndType,
+                                params.MiterLimit,
+                                roundPrecision);
+    clearable.OffsetWithClipper(diameter / 2, JoinType, EndType, params.MiterLimit, roundPrecision);
+
+    // Cleared curves away from the clearable region do not change the result, so only the
+    // overlapping ones take part in the boolean operations below. A hole lies within the box
+    // of its outer curve, so both are either kept or dropped together.
+    CBox2D clearableBox;
+    clearable.GetBox(clearableBox);
+    auto overlapping = [&clearableBox](CCurve& curve) {
+        CBox2D box;
+        curve.GetBox(box);
+        return clearableBox.m_valid && box.m_valid && box.m_minxy.x <= clearableBox.m_maxxy.x
+            && box.m_maxxy.x >= clearableBox.m_minxy.x && box.m_minxy.y <= clearableBox.m_maxxy.y
+            && box.m_maxxy.y >= clearableBox.m_minxy.y;
+    };
+
     // transform all clearedAreas into our workplane
     Area clearedAreasInPlane(&params);
     clearedAreasInPlane.myArea.reset(new CArea());
@@ -756,21 +954,38 @@ std::shared_ptr<Area> Area::getRestArea(std::vector<std::shared_ptr<Area>> clear
             trsf.TranslationPart().Y(),
             -myTrsf.TranslationPart()
                  .Z()});  // discard z-height of cleared workplane, set to myWorkPlane's height
-        TopoDS_Shape clearedShape = Area::toShape(*clearedArea->myArea, false, &trsf);
-        Area::addShape(*(clearedAreasInPlane.myArea),
-                       clearedShape,
-                       &myTrsf,
-                       .01 /*default value*/,
-                       &myWorkPlane);
-    }
 
-    CArea clearable(*myArea);
-    clearable.OffsetWithClipper(-diameter / 2,
-                                JoinType,
-                                EndType,
-                                params.MiterLimit,
-                                roundPrecision);
-    clearable.OffsetWithClipper(diameter / 2, JoinType, EndType, params.MiterLimit, roundPrecision);
+        CArea inPlane;
+        gp_Trsf total = myTrsf.Multiplied(trsf);
+        if (fabs(total.ScaleFactor() - 1.0) < Precision::Confusion()
+            && total.GetRotation().GetRotationAngle() < Precision::Angular()) {
+            // The usual case of both workplanes having the same orientation. Move the curves
+            // directly instead of going through an OCC shape.
+            const gp_XYZ offset = total.TranslationPart();
+            for (const CCurve& curve : clearedArea->myArea->m_curves) {
+                CCurve moved(curve);
+                for (CVertex& vertex : moved.m_vertices) {
+                    vertex.m_p.x += offset.X();
+                    vertex.m_p.y += offset.Y();
+                    vertex.m_c.x += offset.X();
+                    vertex.m_c.y += offset.Y();
+                }
+                if (overlapping(moved)) {
+                    inPlane.append(moved);
+                }
+            }
+            inPlane.Reorder();
+        }
+        else {
+            TopoDS_Shape clearedShape = Area::toShape(*clearedArea->myArea, false, &trsf);
+            Area::addShape(inPlane, clearedShape, &myTrsf, .01 /*default value*/, &myWorkPlane);
+            inPlane.m_curves.remove_if([&overlapping](CCurve& curve) {
+                return !overlapping(curve);
+            });
+        }
+        clearedAreasInPlane.myArea->m_curves.splice(clearedAreasInPlane.myArea->m_curves.end(),
+                                                    inPlane.m_curves);
+    }
 
     // remaining = clearable - prevCleared
     CArea remaining(clearable);
@@ -1709,6 +1924,145 @@ int Area::project(TopoDS_Shape& shape_out,
     return skips;
 }
 
+/** Identifies the shapes and parameters a section is sliced from
+ *
+ * Source shapes are identified by their underlying TShape and placement, so
+ * that re-running an operation on an unchanged model finds the sections of
+ * the previous run.
+ */
+struct SectionCacheKey
+{
+    using Placement = std::array<double, 12>;
+
+    struct Source
+    {
+        short op;
+        const Standard_Transient* tshape;
+        int orientation;
+        Placement placement;
+
+        bool operator<(const Source& other) const
+        {
+            return std::tie(op, tshape, orientation, placement)
+                < std::tie(other.op, other.tshape, other.orientation, other.placement);
+        }
+    };
+
+    std::vector<Source> sources;
+    Placement trsf {};
+    bool fill = false;
+    double tolerance = 0.0;
+    double height = 0.0;
+
+    static Placement toPlacement(const gp_Trsf& trsf)
+    {
+        Placement res;
+        for (int r = 1; r <= 3; ++r) {
+            for (int c = 1; c <= 4; ++c) {
+                res[(r - 1) * 4 + c - 1] = trsf.Value(r, c);
+            }
+        }
+        return res;
+    }
+
+    void init(const std::list<Area::Shape>& shapes, const gp_Trsf& t, bool f, double tol)
+    {
+        sources.clear();
+        sources.reserve(shapes.size());
+        for (const auto& s : shapes) {
+            sources.push_back({s.op,
+                               s.shape.TShape().get(),
+                               static_cast<int>(s.shape.Orientation()),
+                               toPlacement(s.shape.Location().Transformation())});
+        }
+        trsf = toPlacement(t);
+        fill = f;
+        tolerance = tol;
+    }
+
+    bool operator<(const SectionCacheKey& other) const
+    {
+        return std::tie(height, fill, tolerance, trsf, sources)
+            < std::tie(other.height, other.fill, other.tolerance, other.trsf, other.sources);
+    }
+};
+
+struct SectionCacheEntry
+{
+    /** Keeps the source TShapes alive, so that their addresses are not reused */
+    std::list<Area::Shape> sources;
+    TopoDS_Shape plane;
+    /** Sectioned shapes, empty if the section is discarded */
+    std::list<Area::Shape> shapes;
+};
+
+/** Thread safe cache of sliced sections, with first-in-first-out eviction */
+class SectionCache
+{
+public:
+    static SectionCache& instance()
+    {
+        static SectionCache cache;
+        return cache;
+    }
+
+    bool get(const SectionCacheKey& key, double height, SectionCacheEntry& entry)
+    {
+        SectionCacheKey k(key);
+        k.height = height;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(k);
+        if (it == entries.end()) {
+            return false;
+        }
+        entry = it->second;
+        return true;
+    }
+
+    void add(const SectionCacheKey& key,
+             double height,
+             const TopoDS_Shape& plane,
+             const std::list<Area::Shape>& shapes,
+             const std::list<Area::Shape>& sources)
+    {
+        SectionCacheKey k(key);
+        k.height = height;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto res = entries.emplace(std::move(k), SectionCacheEntry());
+        if (!res.second) {
+            return;
+        }
+        res.first->second.sources = sources;
+        res.first->second.plane = plane;
+        res.first->second.shapes = shapes;
+        order.push_back(res.first);
+        while (order.size() > maxEntries) {
+            entries.erase(order.front());
+            order.pop_front();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.clear();
+        entries.clear();
+    }
+
+private:
+    static constexpr std::size_t maxEntries = 1024;
+
+    std::mutex mutex;
+    std::map<SectionCacheKey, SectionCacheEntry> entries;
+    std::deque<std::map<SectionCacheKey, SectionCacheEntry>::iterator> order;
+};
+
+void Area::clearSectionCache()
+{
+    SectionCache::instance().clear();
+    ClearedPathCache::instance().clear();
+}
+
 std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PARAMS_SECTION_EXTRA),
                                                  const std::vector<double>& _heights,
                                                  const TopoDS_Shape& section_plane)
@@ -1727,7 +2081,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
         throw Base::ValueError("failed to obtain section plane");
     }
 
-    FC_TIME_INIT2(t, t1);
+    FC_TIME_INIT(t);
 
     TopLoc_Location loc(trsf);
 
@@ -1886,10 +2240,8 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
-        double z = heights[i];
-        bool retried = !can_retry;
-        while (true) {
+    if (project) {
+        for (double z : heights) {
             gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
             Standard_Real a, b, c, d;
             pln.Coefficients(a, b, c, d);
@@ -1900,16 +2252,75 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
             area->myParams.Outline = false;
             area->setPlane(face.Moved(locInverse));
 
-            if (project) {
-                for (const auto& s : projectedShapes) {
-                    gp_Trsf t;
-                    t.SetTranslation(gp_Vec(0, 0, -d));
-                    TopLoc_Location wloc(t);
-                    area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
-                }
-                sections.push_back(area);
-                break;
+            for (const auto& s : projectedShapes) {
+                gp_Trsf t;
+                t.SetTranslation(gp_Vec(0, 0, -d));
+                TopLoc_Location wloc(t);
+                area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
+            }
+            sections.push_back(area);
+        }
+        FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
+        return sections;
+    }
+
+    SectionCacheKey cacheKey;
+    if (myParams.SectionCache) {
+        cacheKey.init(myShapes, trsf, myParams.Fill != FillNone, tolerance);
+    }
+
+    // Console output is not thread safe, so the messages of each section are
+    // collected and reported in order once all sections are done.
+    struct SectionSlice
+    {
+        shared_ptr<Area> area;
+        std::vector<std::pair<int, std::string>> messages;
+        std::exception_ptr error;
+    };
+    std::vector<SectionSlice> slices(heights.size());
+
+#define AREA_SECTION_MSG(_level, _msg)                                                             \
+    do {                                                                                           \
+        if (FC_LOG_INSTANCE.isEnabled(_level)) {                                                   \
+            std::ostringstream _str;                                                               \
+            _str << _msg;                                                                          \
+            slice.messages.emplace_back(_level, _str.str());                                       \
+        }                                                                                          \
+    } while (0)
+
+    auto makeSection = [&](size_t i) {
+        SectionSlice& slice = slices[i];
+        double z = heights[i];
+
+        SectionCacheEntry cached;
+        if (myParams.SectionCache && SectionCache::instance().get(cacheKey, z, cached)) {
+            if (cached.shapes.empty()) {
+                AREA_SECTION_MSG(FC_LOGLEVEL_LOG, "Discard empty cached section " << z);
+                return;
+            }
+            shared_ptr<Area> area(std::make_shared<Area>(&myParams));
+            area->myParams.Outline = false;
+            area->setPlane(cached.plane);
+            for (const auto& s : cached.shapes) {
+                area->add(s.shape, s.op);
             }
+            slice.area = area;
+            return;
+        }
+
+        bool retried = !can_retry;
+        while (true) {
+            gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
+            Standard_Real a, b, c, d;
+            pln.Coefficients(a, b, c, d);
+            BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
+            const TopoDS_Shape& face = mkFace.Face();
+
+            const TopoDS_Shape& sectionPlane = face.Moved(locInverse);
+
+            shared_ptr<Area> area(std::make_shared<Area>(&myParams));
+            area->myParams.Outline = false;
+            area->setPlane(sectionPlane);
 
             for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
                 const auto& s = *it;
@@ -1924,7 +2335,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     wires = section.slice(-d);
                     showShapes(wires, nullptr, "section_%u_wire", i);
                     if (wires.empty()) {
-                        AREA_LOG("Section returns no wires");
+                        AREA_SECTION_MSG(FC_LOGLEVEL_LOG, "Section returns no wires");
                         continue;
                     }
 
@@ -1940,7 +2351,8 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                         mkFace.Build();
                         const TopoDS_Shape& shape = mkFace.Shape();
                         if (shape.IsNull()) {
-                            AREA_WARN("FaceMakerBullseye return null shape on section");
+                            AREA_SECTION_MSG(FC_LOGLEVEL_WARN,
+                                             "FaceMakerBullseye return null shape on section");
                         }
                         else {
                             showShape(shape, nullptr, "section_%u_face", i);
@@ -1961,7 +2373,8 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                         }
                     }
                     catch (Base::Exception& e) {
-                        AREA_WARN("FaceMakerBullseye failed on section: " << e.what());
+                        AREA_SECTION_MSG(FC_LOGLEVEL_WARN,
+                                         "FaceMakerBullseye failed on section: " << e.what());
                     }
                     for (const TopoDS_Wire& wire : wires) {
                         builder.Add(comp, wire);
@@ -1984,21 +2397,96 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
-                FC_TIME_LOG(t1, "makeSection " << z);
-                showShape(area->getShape(), nullptr, "section_%u_final", i);
+                slice.area = area;
+                AREA_SECTION_MSG(FC_LOGLEVEL_LOG, "makeSection " << z);
+                // getShape() builds the area with the global libarea settings, so it
+                // must only run when the sections are made in a single thread
+                if (FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+                    showShape(area->getShape(), nullptr, "section_%u_final", i);
+                }
+                if (myParams.SectionCache) {
+                    SectionCache::instance().add(cacheKey,
+                                                 heights[i],
+                                                 sectionPlane,
+                                                 area->myShapes,
+                                                 myShapes);
+                }
                 break;
             }
             if (retried) {
-                AREA_WARN("Discard empty section");
+                AREA_SECTION_MSG(FC_LOGLEVEL_WARN, "Discard empty section");
+                if (myParams.SectionCache) {
+                    SectionCache::instance().add(cacheKey,
+                                                 heights[i],
+                                                 TopoDS_Shape(),
+                                                 std::list<Shape>(),
+                                                 myShapes);
+                }
                 break;
             }
             else {
-                AREA_TRACE("retry section " << z << "->" << z + tolerance);
+                AREA_SECTION_MSG(FC_LOGLEVEL_TRACE,
+                                 "retry section " << z << "->" << z + tolerance);
                 z += tolerance;
                 retried = true;
             }
         }
+    };
+
+#undef AREA_SECTION_MSG
+
+    std::size_t threads = myParams.SectionThreads > 0
+        ? static_cast<std::size_t>(myParams.SectionThreads)
+        : static_cast<std::size_t>(std::thread::hardware_concurrency());
+    // showShape() adds debug features to the active document, which can only
+    // be done from the main thread
+    if (FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+        threads = 1;
+    }
+    threads = std::max<std::size_t>(1, std::min(threads, heights.size()));
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < heights.size(); i = next++) {
+            try {
+                makeSection(i);
+            }
+            catch (...) {
+                slices[i].error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    for (auto& slice : slices) {
+        for (const auto& msg : slice.messages) {
+            switch (msg.first) {
+                case FC_LOGLEVEL_WARN:
+                    AREA_WARN(msg.second);
+                    break;
+                case FC_LOGLEVEL_LOG:
+                    AREA_LOG(msg.second);
+                    break;
+                default:
+                    AREA_TRACE(msg.second);
+                    break;
+            }
+        }
+        if (slice.error) {
+            std::rethrow_exception(slice.error);
+        }
+        if (slice.area) {
+            sections.push_back(slice.area);
+        }
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -420,6 +420,10 @@ public:
     static void setDefaultParams(const AreaStaticParams& params);
     static const AreaStaticParams& getDefaultParams();
 
+    /** Release all sections cached by makeSections() and the tool path indices
+     * cached by getClearedArea() */
+    static void clearSectionCache();
+
     static void
     showShape(const TopoDS_Shape& shape, const char* name, const char* fmt = nullptr, ...);
 };
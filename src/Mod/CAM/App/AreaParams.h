@@ -281,7 +281,19 @@
          "When the section hits or over the shape boundary, a section with the height of that "    \
          "boundary\n"                                                                              \
          "will be created. A small offset is usually required to avoid the tangential cut.",       \
-         App::PropertyPrecision))AREA_PARAMS_SECTION_EXTRA
+         App::PropertyPrecision))(                                                                 \
+        (long,                                                                                     \
+         threads,                                                                                  \
+         SectionThreads,                                                                           \
+         0,                                                                                        \
+         "Number of threads used for slicing the sections. 0 means using all available\n"          \
+         "hardware threads, and 1 means slicing one section after another."))(                    \
+        (bool,                                                                                     \
+         cache,                                                                                    \
+         SectionCache,                                                                             \
+         true,                                                                                     \
+         "Reuse the sections previously sliced from the same shapes at the same heights,\n"        \
+         "e.g. when re-running an operation after changing the tool."))AREA_PARAMS_SECTION_EXTRA
 
 #ifdef AREA_OFFSET_ALGO
 #define AREA_PARAMS_OFFSET_ALGO ((enum, algo, Algo, 0, "Offset algorithm type", (Clipper)(libarea)))
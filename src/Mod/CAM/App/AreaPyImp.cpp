@@ -46,10 +46,21 @@ static PyObject* areaAbort(PyObject*, PyObject* args, PyObject* kwd)
     Py_Return;
 }
 
+static PyObject* areaClearSectionCache(PyObject*, PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    Area::clearSectionCache();
+
+    Py_Return;
+}
+
 static PyObject* areaSetParams(PyObject*, PyObject* args, PyObject* kwd)
 {
 
-    static const std::array<const char*, 43> kwlist {
+    static const std::array<const char*, 45> kwlist {
         PARAM_FIELD_STRINGS(NAME, AREA_PARAMS_STATIC_CONF),
         nullptr};
 
@@ -237,6 +248,13 @@ static const PyMethodDef areaOverrides[] = {
         "manually clear\n"
         "the aborting flag by calling abort(False) before starting a new operation.",
     },
+    {"clearSectionCache",
+     (PyCFunction)areaClearSectionCache,
+     METH_VARARGS | METH_STATIC,
+     "clearSectionCache(): Static method to release all sections cached by makeSections().\n"
+     "\nSections are cached when 'SectionCache' is enabled, so that re-running an operation on\n"
+     "the same shapes does not slice them again. The tool path indices built by\n"
+     "getClearedArea() for rest machining are released as well."},
     {"getParamsDesc",
      reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(areaGetParamsDesc)),
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
@@ -590,7 +608,7 @@ PyObject* AreaPy::setDefaultParams(PyObject*, PyObject*)
 
 PyObject* AreaPy::setParams(PyObject* args, PyObject* keywds)
 {
-    static const std::array<const char*, 43> kwlist {PARAM_FIELD_STRINGS(NAME, AREA_PARAMS_CONF),
+    static const std::array<const char*, 45> kwlist {PARAM_FIELD_STRINGS(NAME, AREA_PARAMS_CONF),
                                                      nullptr};
 
     // Declare variables defined in the NAME field of the CONF parameter list
@@ -645,6 +663,11 @@ PyObject* AreaPy::abort(PyObject*, PyObject*)
     return nullptr;
 }
 
+PyObject* AreaPy::clearSectionCache(PyObject*)
+{
+    return nullptr;
+}
+
 PyObject* AreaPy::getParamsDesc(PyObject*, PyObject*)
 {
     return nullptr;
@@ -27,6 +27,7 @@
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
+#include <Mod/CAM/App/PathCycleTime.h>
 #include <Mod/CAM/App/PathSegmentWalker.h>
 
 #include "Path.h"
@@ -216,6 +217,27 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
     return time;
 }
 
+double Toolpath::getCycleTime(const CycleTimeLimits& limits,
+                              std::vector<double>* commandTimes) const
+{
+    if (commandTimes) {
+        commandTimes->assign(getSize(), 0.0);
+    }
+
+    // check the feedrates are set
+    if ((limits.hFeed <= 0) || (limits.vFeed <= 0)) {
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/CAM");
+        if (!hGrp->GetBool("WarningsSuppressAllSpeeds", true)) {
+            Base::Console().Warning("Feed Rate Error: Check Tool Controllers have Feed Rates");
+        }
+        return 0;
+    }
+
+    CycleTimeEstimator estimator(limits);
+    return estimator.estimate(*this, commandTimes);
+}
+
 class BoundBoxSegmentVisitor: public PathSegmentVisitor
 {
 public:
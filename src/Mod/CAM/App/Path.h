@@ -33,6 +33,8 @@
 namespace Path
 {
 
+struct CycleTimeLimits;
+
 /** The representation of a CNC Toolpath */
 
 class PathExport Toolpath: public Base::Persistence
@@ -60,6 +62,8 @@ public:
     void deleteCommand(int);                              // deletes a command
     double getLength();                                   // return the Length (mm) of the Path
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
+    double getCycleTime(const CycleTimeLimits& limits,
+                        std::vector<double>* commandTimes = nullptr) const;  // with acceleration
     void recalculate();                                   // recalculates the points
     void
     setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
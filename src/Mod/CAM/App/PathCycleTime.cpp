@@ -0,0 +1,327 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#endif
+
+#include "PathCycleTime.h"
+
+
+using namespace Path;
+
+namespace
+{
+constexpr double minLength = 1e-9;
+constexpr double infinity = std::numeric_limits<double>::infinity();
+}  // namespace
+
+CycleTimeEstimator::CycleTimeEstimator(const CycleTimeLimits& lim)
+    : limits(lim)
+{
+    if (limits.hRapid <= 0) {
+        limits.hRapid = limits.hFeed;
+    }
+    if (limits.vRapid <= 0) {
+        limits.vRapid = limits.vFeed;
+    }
+    limits.lookAhead = std::max(limits.lookAhead, 1U);
+}
+
+double CycleTimeEstimator::estimate(const Toolpath& tp, std::vector<double>* commandTimes)
+{
+    blocks.clear();
+    frontEntry = 0.0;
+    hasPrevious = false;
+    total = 0.0;
+    times = commandTimes;
+    if (times) {
+        times->assign(tp.getSize(), 0.0);
+    }
+
+    PathSegmentWalker walker(tp);
+    walker.walk(*this, Base::Vector3d(0, 0, 0));
+
+    // the machine comes to a stop at the end of the path
+    plan();
+    flush(blocks.size());
+    times = nullptr;
+    return total;
+}
+
+void CycleTimeEstimator::setup(const Base::Vector3d& last)
+{
+    (void)last;
+}
+
+void CycleTimeEstimator::g0(int id,
+                            const Base::Vector3d& last,
+                            const Base::Vector3d& next,
+                            const std::deque<Base::Vector3d>& pts)
+{
+    addMoves(id, true, last, next, pts, infinity);
+}
+
+void CycleTimeEstimator::g1(int id,
+                            const Base::Vector3d& last,
+                            const Base::Vector3d& next,
+                            const std::deque<Base::Vector3d>& pts)
+{
+    addMoves(id, false, last, next, pts, infinity);
+}
+
+void CycleTimeEstimator::g23(int id,
+                             const Base::Vector3d& last,
+                             const Base::Vector3d& next,
+                             const std::deque<Base::Vector3d>& pts,
+                             const Base::Vector3d& center)
+{
+    // limit the speed by the centripetal acceleration the XY axes can provide
+    double maxSpeed = infinity;
+    double accel = infinity;
+    if (limits.acceleration.x > 0) {
+        accel = limits.acceleration.x;
+    }
+    if (limits.acceleration.y > 0) {
+        accel = std::min(accel, limits.acceleration.y);
+    }
+    Base::Vector3d radius(last.x - center.x, last.y - center.y, 0);
+    if (accel != infinity) {
+        maxSpeed = std::sqrt(accel * radius.Length());
+    }
+    addMoves(id, false, last, next, pts, maxSpeed);
+}
+
+void CycleTimeEstimator::g8x(int id,
+                             const Base::Vector3d& last,
+                             const Base::Vector3d& next,
+                             const std::deque<Base::Vector3d>& pts,
+                             const std::deque<Base::Vector3d>& p,
+                             const std::deque<Base::Vector3d>& q)
+{
+    // p holds the position above the hole, the retract plane and the final retract position
+    if (p.size() < 3) {
+        return;
+    }
+    addMoves(id, true, last, p[0], pts, infinity);
+    addMove(id, true, p[0], p[1], infinity);
+
+    // the first entry of q is the retract plane itself, the others are the peck depths
+    Base::Vector3d pos = p[1];
+    for (std::size_t i = 1; i < q.size(); ++i) {
+        addMove(id, false, pos, q[i], infinity);
+        addMove(id, true, q[i], p[1], infinity);
+        addMove(id, true, p[1], q[i], infinity);
+        pos = q[i];
+    }
+    addMove(id, false, pos, next, infinity);
+    addMove(id, true, next, p[2], infinity);
+}
+
+void CycleTimeEstimator::g38(int id, const Base::Vector3d& last, const Base::Vector3d& next)
+{
+    addMove(id, false, last, next, infinity);
+}
+
+void CycleTimeEstimator::addMoves(int id,
+                                  bool rapid,
+                                  const Base::Vector3d& last,
+                                  const Base::Vector3d& next,
+                                  const std::deque<Base::Vector3d>& pts,
+                                  double maxSpeed)
+{
+    Base::Vector3d from = last;
+    for (const auto& pt : pts) {
+        addMove(id, rapid, from, pt, maxSpeed);
+        from = pt;
+    }
+    addMove(id, rapid, from, next, maxSpeed);
+}
+
+void CycleTimeEstimator::addMove(int id,
+                                 bool rapid,
+                                 const Base::Vector3d& from,
+                                 const Base::Vector3d& to,
+                                 double maxSpeed)
+{
+    Base::Vector3d dir = to - from;
+    double length = dir.Length();
+    if (length < minLength) {
+        return;
+    }
+    dir /= length;
+
+    Block block;
+    block.id = id;
+    block.length = length;
+    block.nominal = std::min(nominalSpeed(dir, rapid), maxSpeed);
+    if (block.nominal <= 0 || block.nominal == infinity) {
+        return;
+    }
+    block.accel = maxAcceleration(dir);
+    block.maxEntry = hasPrevious ? junctionSpeed(dir, block.nominal, block.accel) : 0.0;
+    block.entry = block.maxEntry;
+
+    hasPrevious = true;
+    prevDir = dir;
+    prevNominal = block.nominal;
+    prevAccel = block.accel;
+
+    blocks.push_back(block);
+    if (blocks.size() >= 2 * limits.lookAhead) {
+        // the first half of the window has seen enough look-ahead to be final
+        plan();
+        flush(limits.lookAhead);
+    }
+}
+
+void CycleTimeEstimator::plan()
+{
+    if (blocks.empty()) {
+        return;
+    }
+
+    // backward pass: the last block has to be able to stop, every block has to be
+    // able to decelerate to the entry speed of its successor
+    double exit = 0.0;
+    for (std::size_t i = blocks.size() - 1; i > 0; --i) {
+        Block& block = blocks[i];
+        block.entry = std::min(block.maxEntry,
+                               std::sqrt(exit * exit + 2.0 * block.accel * block.length));
+        exit = block.entry;
+    }
+
+    // the entry of the first block was fixed when its predecessor was flushed
+    blocks.front().entry = frontEntry;
+
+    // forward pass: every block has to be able to accelerate to the entry speed
+    // of its successor
+    for (std::size_t i = 0; i + 1 < blocks.size(); ++i) {
+        const Block& block = blocks[i];
+        Block& nextBlock = blocks[i + 1];
+        nextBlock.entry = std::min(nextBlock.entry,
+                                   std::sqrt(block.entry * block.entry
+                                             + 2.0 * block.accel * block.length));
+    }
+}
+
+void CycleTimeEstimator::flush(std::size_t count)
+{
+    count = std::min(count, blocks.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        double exit = i + 1 < blocks.size() ? blocks[i + 1].entry : 0.0;
+        double t = blockTime(blocks[i], exit);
+        total += t;
+        if (times && blocks[i].id >= 0 && blocks[i].id < static_cast<int>(times->size())) {
+            (*times)[blocks[i].id] += t;
+        }
+    }
+    blocks.erase(blocks.begin(), blocks.begin() + count);
+    frontEntry = blocks.empty() ? 0.0 : blocks.front().entry;
+}
+
+double CycleTimeEstimator::nominalSpeed(const Base::Vector3d& dir, bool rapid) const
+{
+    double hSpeed = rapid ? limits.hRapid : limits.hFeed;
+    double vSpeed = rapid ? limits.vRapid : limits.vFeed;
+
+    // the horizontal and vertical components of the move must not exceed their limits
+    double speed = infinity;
+    double horizontal = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+    if (horizontal > minLength) {
+        speed = std::min(speed, hSpeed / horizontal);
+    }
+    if (std::fabs(dir.z) > minLength) {
+        speed = std::min(speed, vSpeed / std::fabs(dir.z));
+    }
+    return speed;
+}
+
+double CycleTimeEstimator::maxAcceleration(const Base::Vector3d& dir) const
+{
+    double accel = infinity;
+    const double axisLimits[3] = {limits.acceleration.x,
+                                  limits.acceleration.y,
+                                  limits.acceleration.z};
+    const double components[3] = {dir.x, dir.y, dir.z};
+    for (int i = 0; i < 3; ++i) {
+        if (axisLimits[i] > 0 && std::fabs(components[i]) > minLength) {
+            accel = std::min(accel, axisLimits[i] / std::fabs(components[i]));
+        }
+    }
+    return accel;
+}
+
+double CycleTimeEstimator::junctionSpeed(const Base::Vector3d& dir,
+                                         double nominal,
+                                         double accel) const
+{
+    double speed = std::min(nominal, prevNominal);
+    double cosTheta = -(prevDir * dir);
+    if (cosTheta < -0.999999) {
+        // straight continuation
+        return speed;
+    }
+    if (cosTheta > 0.999999 || limits.junctionDeviation <= 0) {
+        // reversal or exact stop mode
+        return 0.0;
+    }
+
+    // The corner is approximated by a circle that deviates junctionDeviation from the
+    // programmed corner, the speed is the one reaching the acceleration limit on it.
+    accel = std::min(accel, prevAccel);
+    if (accel == infinity) {
+        return speed;
+    }
+    double sinHalfTheta = std::sqrt(0.5 * (1.0 - cosTheta));
+    double vSquared =
+        accel * limits.junctionDeviation * sinHalfTheta / (1.0 - sinHalfTheta);
+    return std::min(speed, std::sqrt(vSquared));
+}
+
+double CycleTimeEstimator::blockTime(const Block& block, double exit)
+{
+    double entry = std::min(block.entry, block.nominal);
+    exit = std::min(exit, block.nominal);
+    if (block.accel == infinity) {
+        return block.length / block.nominal;
+    }
+
+    double accelDist = (block.nominal * block.nominal - entry * entry) / (2.0 * block.accel);
+    double decelDist = (block.nominal * block.nominal - exit * exit) / (2.0 * block.accel);
+    if (accelDist + decelDist <= block.length) {
+        // trapezoid, the nominal speed is reached
+        double cruise = block.length - accelDist - decelDist;
+        return (block.nominal - entry) / block.accel + (block.nominal - exit) / block.accel
+            + cruise / block.nominal;
+    }
+
+    // triangle, the block is too short to reach the nominal speed
+    double peak = std::sqrt(
+        std::max(0.0, block.accel * block.length + 0.5 * (entry * entry + exit * exit)));
+    peak = std::max(peak, std::max(entry, exit));
+    return (peak - entry) / block.accel + (peak - exit) / block.accel;
+}
@@ -0,0 +1,136 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef PATH_CYCLETIME_H
+#define PATH_CYCLETIME_H
+
+#include <deque>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "PathSegmentWalker.h"
+
+
+namespace Path
+{
+
+/**
+ * Machine limits used by the cycle time estimation. All speeds are in mm/s and all
+ * accelerations in mm/s^2. An acceleration of 0 means the axis is not limited.
+ */
+struct PathExport CycleTimeLimits
+{
+    double hFeed = 0.0;
+    double vFeed = 0.0;
+    double hRapid = 0.0;
+    double vRapid = 0.0;
+    /// per axis acceleration limit
+    Base::Vector3d acceleration;
+    /// allowed deviation from the programmed corner, determines the cornering speed
+    double junctionDeviation = 0.01;
+    /// number of segments the planner looks ahead
+    unsigned int lookAhead = 1000;
+};
+
+/**
+ * CycleTimeEstimator walks a tool path and plans the motion with a trapezoidal velocity
+ * profile, similar to what a machine controller does. Every move is split into straight
+ * segments by PathSegmentWalker, the speed at each junction is limited by the junction
+ * deviation and the planner only keeps a bounded look-ahead window of segments, so the
+ * path is processed in a single pass.
+ */
+class PathExport CycleTimeEstimator: public PathSegmentVisitor
+{
+public:
+    explicit CycleTimeEstimator(const CycleTimeLimits& lim);
+
+    /// Estimates the cycle time of the tool path in seconds. If \a commandTimes is given it is
+    /// filled with the time spent in each command of the path.
+    double estimate(const Toolpath& tp, std::vector<double>* commandTimes = nullptr);
+
+    void setup(const Base::Vector3d& last) override;
+    void g0(int id,
+            const Base::Vector3d& last,
+            const Base::Vector3d& next,
+            const std::deque<Base::Vector3d>& pts) override;
+    void g1(int id,
+            const Base::Vector3d& last,
+            const Base::Vector3d& next,
+            const std::deque<Base::Vector3d>& pts) override;
+    void g23(int id,
+             const Base::Vector3d& last,
+             const Base::Vector3d& next,
+             const std::deque<Base::Vector3d>& pts,
+             const Base::Vector3d& center) override;
+    void g8x(int id,
+             const Base::Vector3d& last,
+             const Base::Vector3d& next,
+             const std::deque<Base::Vector3d>& pts,
+             const std::deque<Base::Vector3d>& p,
+             const std::deque<Base::Vector3d>& q) override;
+    void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next) override;
+
+private:
+    struct Block
+    {
+        int id;
+        double length;
+        double nominal;
+        double accel;
+        double maxEntry;
+        double entry;
+    };
+
+    void addMoves(int id,
+                  bool rapid,
+                  const Base::Vector3d& last,
+                  const Base::Vector3d& next,
+                  const std::deque<Base::Vector3d>& pts,
+                  double maxSpeed);
+    void addMove(int id,
+                 bool rapid,
+                 const Base::Vector3d& from,
+                 const Base::Vector3d& to,
+                 double maxSpeed);
+    void plan();
+    void flush(std::size_t count);
+    double nominalSpeed(const Base::Vector3d& dir, bool rapid) const;
+    double maxAcceleration(const Base::Vector3d& dir) const;
+    double junctionSpeed(const Base::Vector3d& dir, double nominal, double accel) const;
+    static double blockTime(const Block& block, double exit);
+
+private:
+    CycleTimeLimits limits;
+    std::deque<Block> blocks;
+    double frontEntry = 0.0;
+    bool hasPrevious = false;
+    Base::Vector3d prevDir;
+    double prevNominal = 0.0;
+    double prevAccel = 0.0;
+    double total = 0.0;
+    std::vector<double>* times = nullptr;
+};
+
+}  // namespace Path
+
+#endif  // PATH_CYCLETIME_H
@@ -23,12 +23,15 @@
 #include "PreCompiled.h"
 
 #include "Base/GeometryPyCXX.h"
+#include "Base/PyWrapParseTupleAndKeywords.h"
+#include "Base/VectorPy.h"
 
 // inclusion of the generated files (generated out of PathPy.xml)
 #include "PathPy.h"
 #include "PathPy.cpp"
 
 #include "CommandPy.h"
+#include "PathCycleTime.h"
 
 
 using namespace Path;
@@ -192,13 +195,81 @@ PyObject* PathPy::deleteCommand(PyObject* args)
     Py_Error(PyExc_TypeError, "Wrong parameters - expected an integer (optional)");
 }
 
-PyObject* PathPy::getCycleTime(PyObject* args)
+PyObject* PathPy::getCycleTime(PyObject* args, PyObject* kwd)
 {
-    double hFeed, vFeed, hRapid, vRapid;
-    if (PyArg_ParseTuple(args, "dddd", &hFeed, &vFeed, &hRapid, &vRapid)) {
-        return PyFloat_FromDouble(getToolpathPtr()->getCycleTime(hFeed, vFeed, hRapid, vRapid));
+    static const std::array<const char*, 9> kwlist {"hFeed",
+                                                    "vFeed",
+                                                    "hRapid",
+                                                    "vRapid",
+                                                    "acceleration",
+                                                    "junctionDeviation",
+                                                    "lookAhead",
+                                                    "commandTimes",
+                                                    nullptr};
+    CycleTimeLimits limits;
+    PyObject* pAccel = Py_None;
+    unsigned int lookAhead = limits.lookAhead;
+    PyObject* pTimes = Py_False;
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwd,
+                                             "dddd|OdIO!",
+                                             kwlist,
+                                             &limits.hFeed,
+                                             &limits.vFeed,
+                                             &limits.hRapid,
+                                             &limits.vRapid,
+                                             &pAccel,
+                                             &limits.junctionDeviation,
+                                             &lookAhead,
+                                             &PyBool_Type,
+                                             &pTimes)) {
+        return nullptr;
     }
-    return nullptr;
+
+    bool withTimes = Base::asBoolean(pTimes);
+    if (pAccel == Py_None && !withTimes) {
+        // the plain length / feed rate estimation
+        return PyFloat_FromDouble(getToolpathPtr()->getCycleTime(limits.hFeed,
+                                                                 limits.vFeed,
+                                                                 limits.hRapid,
+                                                                 limits.vRapid));
+    }
+
+    PY_TRY
+    {
+        if (pAccel != Py_None) {
+            // a vector passes PyNumber_Check() but cannot be converted to a float, and the
+            // characters of a string would be taken as vector components
+            if (PyObject_TypeCheck(pAccel, &Base::VectorPy::Type) || PyTuple_Check(pAccel)
+                || PyList_Check(pAccel)) {
+                limits.acceleration = Py::Vector(pAccel, false).toVector();
+            }
+            else if (PyFloat_Check(pAccel) || PyLong_Check(pAccel)) {
+                double accel = PyFloat_AsDouble(pAccel);
+                if (PyErr_Occurred()) {
+                    return nullptr;
+                }
+                limits.acceleration = Base::Vector3d(accel, accel, accel);
+            }
+            else {
+                throw Py::TypeError("acceleration must be a number or a vector");
+            }
+        }
+        limits.lookAhead = lookAhead;
+
+        std::vector<double> times;
+        double total = getToolpathPtr()->getCycleTime(limits, withTimes ? &times : nullptr);
+        if (!withTimes) {
+            return PyFloat_FromDouble(total);
+        }
+
+        Py::List list(times.size());
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            list.setItem(i, Py::Float(times[i]));
+        }
+        return Py::new_reference_to(Py::TupleN(Py::Float(total), list));
+    }
+    PY_CATCH
 }
 
 // GCode methods
@@ -43,11 +43,22 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cinttypes>
+#include <cmath>
+#include <deque>
+#include <functional>
 #include <iomanip>
+#include <iterator>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 // Boost
@@ -81,6 +92,7 @@
 #include <gp_Circ.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Quaternion.hxx>
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
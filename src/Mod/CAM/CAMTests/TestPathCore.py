@@ -134,3 +134,26 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def test60(self):
+        """Test Path.getCycleTime with accelerations"""
+        path = Path.Path([Path.Command("G1", {"X": 10})])
+
+        # accelerate to the feed rate in 0.5 mm, cruise for 9 mm and decelerate in 0.5 mm
+        self.assertAlmostEqual(path.getCycleTime(10, 10, 20, 20), 1.0)
+        self.assertAlmostEqual(path.getCycleTime(10, 10, 20, 20, acceleration=100), 1.1)
+        self.assertAlmostEqual(path.getCycleTime(10, 10, 20, 20, acceleration=100.0), 1.1)
+        self.assertAlmostEqual(
+            path.getCycleTime(10, 10, 20, 20, acceleration=FreeCAD.Vector(100, 1, 1)), 1.1
+        )
+        self.assertAlmostEqual(path.getCycleTime(10, 10, 20, 20, acceleration=(100, 1, 1)), 1.1)
+
+        total, times = path.getCycleTime(10, 10, 20, 20, acceleration=100, commandTimes=True)
+        self.assertAlmostEqual(total, 1.1)
+        self.assertEqual(len(times), 1)
+        self.assertAlmostEqual(times[0], 1.1)
+
+        with self.assertRaises(TypeError):
+            path.getCycleTime(10, 10, 20, 20, acceleration="100")
+        with self.assertRaises(TypeError):
+            path.getCycleTime(10, 10, 20, 20, acceleration=(100, 1))
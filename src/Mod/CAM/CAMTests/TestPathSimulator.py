@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2024 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import FreeCAD
+import Part
+import Path
+import PathSimulator
+
+from CAMTests.PathTestUtils import PathTestBase
+
+# The stock is 40mm wide with a resolution of 0.25mm, the borders of the default 64 pixel tiles
+# are at 16mm and 32mm. All cuts are at constant depths, the flat bottom of the tool then gives
+# the same heights however the stock is split into tiles.
+Commands = [
+    Path.Command("G1", {"X": 10, "Y": 10, "Z": 8}),
+    Path.Command("G1", {"X": 22, "Y": 22, "Z": 8}),
+    Path.Command("G1", {"X": 22, "Y": 10, "Z": 8}),
+    Path.Command("G0", {"X": 22, "Y": 10, "Z": 20}),
+    Path.Command("G0", {"X": 5, "Y": 30, "Z": 20}),
+    Path.Command("G1", {"X": 5, "Y": 30, "Z": 6}),
+    Path.Command("G1", {"X": 35, "Y": 30, "Z": 6}),
+]
+
+
+def volume(meshes):
+    vol = 0.0
+    for mesh in meshes:
+        for facet in mesh.Facets:
+            p1, p2, p3 = (FreeCAD.Vector(p) for p in facet.Points)
+            vol += p1.dot(p2.cross(p3)) / 6.0
+    return vol
+
+
+def area(meshes):
+    return sum(mesh.Area for mesh in meshes)
+
+
+def bounds(meshes):
+    return [
+        (bb.XMin, bb.YMin, bb.ZMin, bb.XMax, bb.YMax, bb.ZMax)
+        for bb in (mesh.BoundBox for mesh in meshes)
+    ]
+
+
+def facets(meshes):
+    return [
+        sorted(tuple(tuple(p) for p in facet.Points) for facet in mesh.Facets) for mesh in meshes
+    ]
+
+
+class TestPathSimulator(PathTestBase):
+    def simulate(self, tileSize, commands=Commands, meshEachCommand=False):
+        sim = PathSimulator.PathSim()
+        sim.BeginSimulation(Part.makeBox(40, 40, 10), 0.25, tileSize)
+        sim.SetToolShape(Part.makeCylinder(2, 10), 0.25)
+        pos = FreeCAD.Placement(FreeCAD.Vector(10, 10, 20), FreeCAD.Rotation())
+        for cmd in commands:
+            pos = sim.ApplyCommand(pos, cmd)
+            if meshEachCommand:
+                sim.GetResultMesh()
+        return sim.GetResultMesh()
+
+    def test00(self):
+        """Test cutting across tile borders gives the mesh of the untiled stock"""
+        uncut = self.simulate(0, [])
+        untiled = self.simulate(0)
+        self.assertLess(volume(untiled), volume(uncut) - 1.0)
+
+        for tileSize in (64, 16):
+            tiled = self.simulate(tileSize)
+            self.assertRoughly(volume(tiled), volume(untiled), 0.0001)
+            self.assertRoughly(area(tiled), area(untiled), 0.001)
+            self.assertEqual(bounds(tiled), bounds(untiled))
+
+    def test01(self):
+        """Test re-meshing only the changed tiles gives the mesh of a full re-mesh"""
+        incremental = self.simulate(64, meshEachCommand=True)
+        full = self.simulate(64)
+        self.assertEqual(facets(incremental), facets(full))
@@ -740,6 +740,7 @@ def Execute(op, obj):
             a2d.forceInsideOut = obj.ForceInsideOut
             a2d.finishingProfile = obj.FinishingProfile
             a2d.opType = opType
+            a2d.threads = 0
 
             # EXECUTE
             results = a2d.Execute(stockPath2d, path2d, progressFn)
@@ -36,7 +36,7 @@ PathSim::PathSim()
 PathSim::~PathSim()
 {}
 
-void PathSim::BeginSimulation(Part::TopoShape* stock, float resolution)
+void PathSim::BeginSimulation(Part::TopoShape* stock, float resolution, int tileSize)
 {
     Base::BoundBox3d bbox = stock->getBoundBox();
     m_stock = std::make_unique<cStock>(bbox.MinX,
@@ -45,7 +45,8 @@ void PathSim::BeginSimulation(Part::TopoShape* stock, float resolution)
                                        bbox.LengthX(),
                                        bbox.LengthY(),
                                        bbox.LengthZ(),
-                                       resolution);
+                                       resolution,
+                                       tileSize);
 }
 
 void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
@@ -48,7 +48,7 @@ public:
     PathSim();
     ~PathSim();
 
-    void BeginSimulation(Part::TopoShape* stock, float resolution);
+    void BeginSimulation(Part::TopoShape* stock, float resolution, int tileSize = SIM_TILE_SIZE);
     void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
     Base::Placement* ApplyCommand(Base::Placement* pos, Command* cmd);
 
@@ -58,21 +58,23 @@ int PathSimPy::PyInit(PyObject* /*args*/, PyObject* /*kwd*/)
 
 PyObject* PathSimPy::BeginSimulation(PyObject* args, PyObject* kwds)
 {
-    static const std::array<const char*, 3> kwlist {"stock", "resolution", nullptr};
+    static const std::array<const char*, 4> kwlist {"stock", "resolution", "tileSize", nullptr};
     PyObject* pObjStock;
     float resolution;
+    int tileSize = SIM_TILE_SIZE;
     if (!Base::Wrapped_ParseTupleAndKeywords(args,
                                              kwds,
-                                             "O!f",
+                                             "O!f|i",
                                              kwlist,
                                              &(Part::TopoShapePy::Type),
                                              &pObjStock,
-                                             &resolution)) {
+                                             &resolution,
+                                             &tileSize)) {
         return nullptr;
     }
     PathSim* sim = getPathSimPtr();
     Part::TopoShape* stock = static_cast<Part::TopoShapePy*>(pObjStock)->getTopoShapePtr();
-    sim->BeginSimulation(stock, resolution);
+    sim->BeginSimulation(stock, resolution, tileSize);
     Py_IncRef(Py_None);
     return Py_None;
 }
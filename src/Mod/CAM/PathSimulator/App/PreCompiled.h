@@ -34,6 +34,7 @@
 
 // STL
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <list>
 #include <map>
@@ -42,6 +43,7 @@
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Boost
@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #endif
 
 #include <BRepBndLib.hxx>
@@ -36,7 +38,14 @@
 //************************************************************************************************************
 // stock
 //************************************************************************************************************
-cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float res)
+cStock::cStock(float px,
+               float py,
+               float pz,
+               float lx,
+               float ly,
+               float lz,
+               float res,
+               int tileSize)
     : m_px(px)
     , m_py(py)
     , m_pz(pz)
@@ -56,13 +65,31 @@ cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float
             m_attr[x][y] = 0;
         }
     }
+
+    m_tileSize = tileSize > 0 ? tileSize : std::max(m_x, m_y);
+    m_tx = (m_x + m_tileSize - 1) / m_tileSize;
+    m_ty = (m_y + m_tileSize - 1) / m_tileSize;
+    m_tiles.reserve(m_tx * m_ty);
+    for (int ty = 0; ty < m_ty; ty++) {
+        for (int tx = 0; tx < m_tx; tx++) {
+            m_tiles.emplace_back(tx * m_tileSize,
+                                 ty * m_tileSize,
+                                 std::min(m_x, (tx + 1) * m_tileSize),
+                                 std::min(m_y, (ty + 1) * m_tileSize));
+        }
+    }
 }
 
 cStock::~cStock()
 {}
 
 
-float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+float cStock::FindRectTop(cStockTile& tile,
+                          int& xp,
+                          int& yp,
+                          int& x_size,
+                          int& y_size,
+                          bool scanHoriz)
 {
     float z = m_stock[xp][yp];
     bool xr_ok = true;
@@ -75,7 +102,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -94,7 +121,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -114,7 +141,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -133,7 +160,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -153,21 +180,21 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
     return z;
 }
 
-int cStock::TesselTop(int xp, int yp)
+int cStock::TesselTop(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    float z = FindRectTop(xp, yp, x_size, y_size, true);
+    float z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
-    while (y_size / x_size > 5) {
+    while (y_size / x_size > 5 && yp + x_size * 5 < tile.y1) {
         farRect = true;
         yp += x_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, true);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
-    while (x_size / y_size > 5) {
+    while (x_size / y_size > 5 && xp + y_size * 5 < tile.x1) {
         farRect = true;
         xp += y_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, false);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -184,10 +211,10 @@ int cStock::TesselTop(int xp, int yp)
         Point3D ptl(xp, yp + y_size, z);
         Point3D ptr(xp + x_size, yp + y_size, z);
         if (fabs(m_pz + m_lz - z) < SIM_EPSILON) {
-            AddQuad(pbl, pbr, ptr, ptl, facetsOuter);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsOuter);
         }
         else {
-            AddQuad(pbl, pbr, ptr, ptl, facetsInner);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsInner);
         }
     }
 
@@ -199,7 +226,12 @@ int cStock::TesselTop(int xp, int yp)
 }
 
 
-void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+void cStock::FindRectBot(cStockTile& tile,
+                         int& xp,
+                         int& yp,
+                         int& x_size,
+                         int& y_size,
+                         bool scanHoriz)
 {
     bool xr_ok = true;
     bool xl_ok = scanHoriz;
@@ -211,7 +243,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -230,7 +262,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -250,7 +282,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -269,7 +301,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -289,21 +321,21 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
 }
 
 
-int cStock::TesselBot(int xp, int yp)
+int cStock::TesselBot(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    FindRectBot(xp, yp, x_size, y_size, true);
+    FindRectBot(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
-    while (y_size / x_size > 5) {
+    while (y_size / x_size > 5 && yp + x_size * 5 < tile.y1) {
         farRect = true;
         yp += x_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, true);
+        FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
-    while (x_size / y_size > 5) {
+    while (x_size / y_size > 5 && xp + y_size * 5 < tile.x1) {
         farRect = true;
         xp += y_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, false);
+        FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -318,7 +350,7 @@ int cStock::TesselBot(int xp, int yp)
     Point3D pbr(xp + x_size, yp, m_pz);
     Point3D ptl(xp, yp + y_size, m_pz);
     Point3D ptr(xp + x_size, yp + y_size, m_pz);
-    AddQuad(pbl, ptl, ptr, pbr, facetsOuter);
+    AddQuad(pbl, ptl, ptr, pbr, tile.facetsOuter);
 
     if (farRect) {
         return -1;
@@ -328,25 +360,25 @@ int cStock::TesselBot(int xp, int yp)
 }
 
 
-int cStock::TesselSidesX(int yp)
+int cStock::TesselSidesX(cStockTile& tile, int yp)
 {
     float lastz1 = m_pz;
     if (yp < m_y) {
-        lastz1 = std::max(m_stock[0][yp], m_pz);
+        lastz1 = std::max(m_stock[tile.x0][yp], m_pz);
     }
     float lastz2 = m_pz;
     if (yp > 0) {
-        lastz2 = std::max(m_stock[0][yp - 1], m_pz);
+        lastz2 = std::max(m_stock[tile.x0][yp - 1], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (yp == 0 || yp == m_y) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int x = 1; x <= m_x; x++) {
+    int lastpoint = tile.x0;
+    for (int x = tile.x0 + 1; x <= tile.x1; x++) {
         float newz1 = m_pz;
         if (yp < m_y && x < m_x) {
             newz1 = std::max(m_stock[x][yp], m_pz);
@@ -357,7 +389,8 @@ int cStock::TesselSidesX(int yp)
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the wall is always closed at the tile border
+            if (x < tile.x1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbl(lastpoint, yp, lastz1);
@@ -373,25 +406,25 @@ int cStock::TesselSidesX(int yp)
     return 0;
 }
 
-int cStock::TesselSidesY(int xp)
+int cStock::TesselSidesY(cStockTile& tile, int xp)
 {
     float lastz1 = m_pz;
     if (xp < m_x) {
-        lastz1 = std::max(m_stock[xp][0], m_pz);
+        lastz1 = std::max(m_stock[xp][tile.y0], m_pz);
     }
     float lastz2 = m_pz;
     if (xp > 0) {
-        lastz2 = std::max(m_stock[xp - 1][0], m_pz);
+        lastz2 = std::max(m_stock[xp - 1][tile.y0], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (xp == 0 || xp == m_x) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int y = 1; y <= m_y; y++) {
+    int lastpoint = tile.y0;
+    for (int y = tile.y0 + 1; y <= tile.y1; y++) {
         float newz1 = m_pz;
         if (xp < m_x && y < m_y) {
             newz1 = std::max(m_stock[xp][y], m_pz);
@@ -402,7 +435,8 @@ int cStock::TesselSidesY(int xp)
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the wall is always closed at the tile border
+            if (y < tile.y1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbr(xp, lastpoint, lastz1);
@@ -445,46 +479,102 @@ void cStock::AddQuad(Point3D& p1,
     facets.push_back(facet);
 }
 
-void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+void cStock::TessellateTile(cStockTile& tile)
 {
     // reset attribs
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             m_attr[x][y] = 0;
         }
     }
 
-    facetsOuter.clear();
-    facetsInner.clear();
+    tile.facetsOuter.clear();
+    tile.facetsInner.clear();
 
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             int attr = m_attr[x][y];
             if ((attr & SIM_TESSEL_TOP) == 0) {
-                x += TesselTop(x, y);
+                x += TesselTop(tile, x, y);
             }
         }
     }
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             if ((m_stock[x][y] - m_pz) < m_res) {
                 m_attr[x][y] |= SIM_TESSEL_BOT;
             }
             if ((m_attr[x][y] & SIM_TESSEL_BOT) == 0) {
-                x += TesselBot(x, y);
+                x += TesselBot(tile, x, y);
             }
         }
     }
-    for (int y = 0; y <= m_y; y++) {
-        TesselSidesX(y);
+
+    // each tile owns the walls along its lower and left border, the last
+    // tiles also own the outer walls of the stock
+    int yEnd = tile.y1 == m_y ? m_y : tile.y1 - 1;
+    for (int y = tile.y0; y <= yEnd; y++) {
+        TesselSidesX(tile, y);
+    }
+    int xEnd = tile.x1 == m_x ? m_x : tile.x1 - 1;
+    for (int x = tile.x0; x <= xEnd; x++) {
+        TesselSidesY(tile, x);
     }
-    for (int x = 0; x <= m_x; x++) {
-        TesselSidesY(x);
+}
+
+void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+{
+    // Only re-mesh the tiles touched since the last call. The walls along the
+    // lower and left border of a tile depend on the pixels of the neighbour
+    // tile, so a tile is also re-meshed if its left or lower neighbour changed.
+    std::vector<cStockTile*> tiles;
+    for (int ty = 0; ty < m_ty; ty++) {
+        for (int tx = 0; tx < m_tx; tx++) {
+            if (m_tiles[ty * m_tx + tx].dirty || (tx > 0 && m_tiles[ty * m_tx + tx - 1].dirty)
+                || (ty > 0 && m_tiles[(ty - 1) * m_tx + tx].dirty)) {
+                tiles.push_back(&m_tiles[ty * m_tx + tx]);
+            }
+        }
+    }
+    for (auto& tile : m_tiles) {
+        tile.dirty = false;
+    }
+
+    // Tiles only write to their own pixel attributes and facets, so they can
+    // be meshed concurrently
+    std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    threads = std::min(threads, tiles.size());
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < tiles.size(); i = next++) {
+            TessellateTile(*tiles[i]);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (std::size_t i = 1; i < threads; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    std::size_t countOuter = 0;
+    std::size_t countInner = 0;
+    for (const auto& tile : m_tiles) {
+        countOuter += tile.facetsOuter.size();
+        countInner += tile.facetsInner.size();
+    }
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    facetsOuter.reserve(countOuter);
+    facetsInner.reserve(countInner);
+    for (const auto& tile : m_tiles) {
+        facetsOuter.insert(facetsOuter.end(), tile.facetsOuter.begin(), tile.facetsOuter.end());
+        facetsInner.insert(facetsInner.end(), tile.facetsInner.begin(), tile.facetsInner.end());
     }
     meshOuter.addFacets(facetsOuter);
     meshInner.addFacets(facetsInner);
-    facetsOuter.clear();
-    facetsInner.clear();
 }
 
 
@@ -501,9 +591,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     for (int y = ys; y < ye; y++) {
         for (int x = xs; x < xe; x++) {
             if (((x - cx) * (x - cx) + (y - cy) * (y - cy)) < drad) {
-                if (m_stock[x][y] > height) {
-                    m_stock[x][y] = height;
-                }
+                CutAt(x, y, height);
             }
         }
     }
@@ -540,11 +628,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
             for (int i = 0; i < lenSteps; i++) {
                 int x = (int)p.x;
                 int y = (int)p.y;
-                if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
-                    }
-                }
+                CutAt(x, y, z);
                 p.Add(mainWay);
                 z += zstep;
             }
@@ -565,11 +649,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
         for (float a = 0; a < cupAngle; a += rotang) {
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            CutAt(x, y, z);
             cupCirc.Rotate();
         }
     }
@@ -627,11 +707,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
         for (int i = 0; i < ndivs; i++) {
             int x = (int)(cpx + cupCirc.x);
             int y = (int)(cpy + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            CutAt(x, y, z);
             z += zstep;
             cupCirc.Rotate();
         }
@@ -653,11 +729,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
         for (int i = 0; i < ndivs; i++) {
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            CutAt(x, y, z);
             cupCirc.Rotate();
         }
     }
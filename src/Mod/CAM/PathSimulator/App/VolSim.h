@@ -36,6 +36,7 @@
 #define SIM_TESSEL_BOT 2
 #define SIM_WALK_RES                                                                               \
     0.6  // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_TILE_SIZE 64  // stock tile size in pixels, tessellation is cached per tile
 
 struct toolShapePoint
 {
@@ -218,10 +219,34 @@ private:
     int height;
 };
 
+struct cStockTile
+{
+    cStockTile(int xs, int ys, int xe, int ye)
+        : x0(xs)
+        , y0(ys)
+        , x1(xe)
+        , y1(ye)
+        , dirty(true)
+    {}
+    int x0, y0;  // first pixel of the tile
+    int x1, y1;  // one past the last pixel of the tile
+    bool dirty;  // stock changed since the tile was last tessellated
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+};
+
 class cStock
 {
 public:
-    cStock(float px, float py, float pz, float lx, float ly, float lz, float res);
+    // tileSize < 1 makes a single tile of the whole stock
+    cStock(float px,
+           float py,
+           float pz,
+           float lx,
+           float ly,
+           float lz,
+           float res,
+           int tileSize = SIM_TILE_SIZE);
     ~cStock();
     void Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner);
     void CreatePocket(float x, float y, float rad, float height);
@@ -233,18 +258,32 @@ public:
     }
 
 private:
-    float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
-    void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
+    inline void CutAt(int x, int y, float z)
+    {
+        if (x >= 0 && y >= 0 && x < m_x && y < m_y && m_stock[x][y] > z) {
+            m_stock[x][y] = z;
+            m_tiles[(y / m_tileSize) * m_tx + x / m_tileSize].dirty = true;
+        }
+    }
+    void TessellateTile(cStockTile& tile);
+    float FindRectTop(cStockTile& tile,
+                      int& xp,
+                      int& yp,
+                      int& x_size,
+                      int& y_size,
+                      bool scanHoriz);
+    void
+    FindRectBot(cStockTile& tile, int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
     void AddQuad(Point3D& p1,
                  Point3D& p2,
                  Point3D& p3,
                  Point3D& p4,
                  std::vector<MeshCore::MeshGeomFacet>& facets);
-    int TesselTop(int x, int y);
-    int TesselBot(int x, int y);
-    int TesselSidesX(int yp);
-    int TesselSidesY(int xp);
+    int TesselTop(cStockTile& tile, int x, int y);
+    int TesselBot(cStockTile& tile, int x, int y);
+    int TesselSidesX(cStockTile& tile, int yp);
+    int TesselSidesY(cStockTile& tile, int xp);
     Array2D<float> m_stock;
     Array2D<char> m_attr;
     float m_px, m_py, m_pz;  // stock zero position
@@ -252,8 +291,9 @@ private:
     float m_res;             // resoulution
     float m_plane;           // stock plane height
     int m_x, m_y;            // stock array size
-    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
-    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    int m_tileSize;          // tile size in pixels
+    int m_tx, m_ty;          // tile array size
+    std::vector<cStockTile> m_tiles;
 };
 
 class cVolSim
@@ -26,6 +26,13 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -246,7 +253,7 @@ public:
     }
 
     // bounds check - intersection
-    inline bool CollidesWith(const BoundBox& bb2)
+    inline bool CollidesWith(const BoundBox& bb2) const
     {
         return minX <= bb2.maxX && maxX >= bb2.minX && minY <= bb2.maxY && maxY >= bb2.minY;
     }
@@ -974,6 +981,7 @@ public:
         clearedPaths = paths;
         bboxPathsInvalid = true;
         bboxClippedInvalid = true;
+        pathBoundsInvalid = true;
     }
     void ExpandCleared(const Path toClearToolPath)
     {
@@ -992,6 +1000,7 @@ public:
         CleanPolygons(clearedPaths);
         bboxPathsInvalid = true;
         bboxClippedInvalid = true;
+        pathBoundsInvalid = true;
         Perf_ExpandCleared.Stop();
     }
 
@@ -1008,8 +1017,10 @@ public:
 
         BoundBox bb(toolPos, focusBBFactor2 * toolRadiusScaled);
         clearedBoundedPaths.clear();
-        for (const auto& pth : clearedPaths) {
-            if (pth.size() < 2) {
+        const vector<BoundBox>& bounds = GetClearedPathsBounds();
+        for (size_t j = 0; j < clearedPaths.size(); j++) {
+            const Path& pth = clearedPaths[j];
+            if (pth.size() < 2 || !bounds[j].CollidesWith(bb)) {
                 continue;
             }
             Path bPath;
@@ -1058,9 +1069,16 @@ public:
         bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y - delta2));
         bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y + delta2));
         bbPath.push_back(IntPoint(toolPos.X - delta2, toolPos.Y + delta2));
+        // only the cleared paths touching the focus box can contribute to the intersection
+        BoundBox bb(toolPos, delta2);
+        const vector<BoundBox>& bounds = GetClearedPathsBounds();
         clip.Clear();
         clip.AddPath(bbPath, PolyType::ptSubject, true);
-        clip.AddPaths(clearedPaths, PolyType::ptClip, true);
+        for (size_t j = 0; j < clearedPaths.size(); j++) {
+            if (bounds[j].CollidesWith(bb)) {
+                clip.AddPath(clearedPaths[j], PolyType::ptClip, true);
+            }
+        }
         clip.Execute(ClipType::ctIntersection, clearedBoundedClipped);
         bboxClippedInvalid = false;
         return clearedBoundedClipped;
@@ -1073,11 +1091,34 @@ public:
     }
 
 private:
+    // bound boxes of the cleared paths, used to skip the paths away from the tool
+    vector<BoundBox>& GetClearedPathsBounds()
+    {
+        if (!pathBoundsInvalid) {
+            return clearedPathsBounds;
+        }
+        clearedPathsBounds.clear();
+        clearedPathsBounds.reserve(clearedPaths.size());
+        for (const auto& pth : clearedPaths) {
+            BoundBox bb;
+            if (!pth.empty()) {
+                bb.SetFirstPoint(pth.front());
+                for (const auto& pt : pth) {
+                    bb.AddPoint(pt);
+                }
+            }
+            clearedPathsBounds.push_back(bb);
+        }
+        pathBoundsInvalid = false;
+        return clearedPathsBounds;
+    }
+
     Clipper clip;
     ClipperOffset clipof;
     Paths clearedPaths;
     Paths clearedBoundedClipped;
     Paths clearedBoundedPaths;
+    vector<BoundBox> clearedPathsBounds;
 
     ClipperLib::cInt toolRadiusScaled;
     BoundBox clearedBBClippedInFocus;
@@ -1085,6 +1126,7 @@ private:
 
     bool bboxClippedInvalid = false;
     bool bboxPathsInvalid = false;
+    bool pathBoundsInvalid = true;
     // size of the focus BB
     const ClipperLib::cInt focusBBFactor1 = 8;
     const ClipperLib::cInt focusBBFactor2 = 9;
@@ -1155,9 +1197,13 @@ public:
         return angle;
     }
 
+    // uses its own generator instead of rand(), so that the result of a region does not
+    // depend on the other regions processed before or in parallel
     double getRandomAngle()
     {
-        return MIN_ANGLE + (MAX_ANGLE - MIN_ANGLE) * double(rand()) / double(RAND_MAX);
+        double r = double(randomGenerator() - minstd_rand::min())
+            / double(minstd_rand::max() - minstd_rand::min());
+        return MIN_ANGLE + (MAX_ANGLE - MIN_ANGLE) * r;
     }
     size_t getPointCount()
     {
@@ -1167,6 +1213,7 @@ public:
 private:
     vector<double> angles;
     vector<double> areas;
+    minstd_rand randomGenerator;
 };
 
 //***************************************
@@ -1428,7 +1475,7 @@ double Adaptive2d::CalcCutArea(Clipper& clip,
         for (const auto& pt : path) {
             pathBB.AddPoint(pt);
         }
-        if (!c2BB.CollidesWith(c2)) {
+        if (!pathBB.CollidesWith(c2BB)) {
             continue;  // this path cannot colide with tool
         }
         //** end of BB check
@@ -1824,6 +1871,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
     //***************************************
     //	Resolve hierarchy and run processing
     //***************************************
+    vector<pair<Paths, Paths>> regions;  // bound paths and tool bound paths of each region
     double cornerRoundingOffset = 0.15 * toolRadiusScaled / 2;
     if (opType == OperationType::otClearingInside || opType == OperationType::otClearingOutside) {
 
@@ -1876,7 +1924,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                 clipof.Clear();
                 clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                 clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-                ProcessPolyNode(boundPaths, toolBoundPaths);
+                regions.emplace_back(boundPaths, toolBoundPaths);
             }
         }
     }
@@ -1933,14 +1981,109 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                     clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                     clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-                    ProcessPolyNode(boundPaths, toolBoundPaths);
+                    regions.emplace_back(boundPaths, toolBoundPaths);
                 }
             }
         }
     }
+
+    ProcessRegions(regions);
     return results;
 }
 
+void Adaptive2d::ProcessRegions(const vector<pair<Paths, Paths>>& regions)
+{
+    size_t threadCount = threads > 0 ? size_t(threads) : size_t(thread::hardware_concurrency());
+#ifdef DEV_MODE
+    threadCount = 1;  // debug drawing and perf counters are not thread safe
+#endif
+    threadCount = max(size_t(1), min(threadCount, regions.size()));
+
+    if (threadCount == 1) {
+        for (const auto& region : regions) {
+            ProcessPolyNode(region.first, region.second);
+        }
+        return;
+    }
+
+    // The regions are independent of each other, and each of them is processed by
+    // a copy of this object. The progress callback may call into Python, so the
+    // workers only queue their progress paths, which are reported by this thread.
+    mutex progressMutex;
+    condition_variable progressCondition;
+    TPaths pendingProgress;
+    size_t finishedThreads = 0;
+    atomic<bool> stop(stopProcessing);
+    atomic<size_t> nextRegion(0);
+    vector<list<AdaptiveOutput>> regionResults(regions.size());
+    vector<exception_ptr> regionErrors(regions.size());
+
+    function<bool(TPaths)> queueProgress = [&](TPaths progressPaths) {
+        lock_guard<mutex> lock(progressMutex);
+        pendingProgress.insert(pendingProgress.end(), progressPaths.begin(), progressPaths.end());
+        return stop.load();
+    };
+
+    auto worker = [&]() {
+        for (size_t i = nextRegion++; i < regions.size(); i = nextRegion++) {
+            try {
+                Adaptive2d regionProcessor(*this);
+                regionProcessor.results.clear();
+                regionProcessor.current_region = int(i);
+                regionProcessor.stopProcessing = stop;
+                regionProcessor.progressCallback = &queueProgress;
+                regionProcessor.ProcessPolyNode(regions[i].first, regions[i].second);
+                regionResults[i] = std::move(regionProcessor.results);
+            }
+            catch (...) {
+                regionErrors[i] = current_exception();
+            }
+        }
+        lock_guard<mutex> lock(progressMutex);
+        finishedThreads++;
+        progressCondition.notify_one();
+    };
+
+    vector<thread> pool;
+    pool.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        pool.emplace_back(worker);
+    }
+
+    {
+        unique_lock<mutex> lock(progressMutex);
+        while (finishedThreads < threadCount || !pendingProgress.empty()) {
+            if (pendingProgress.empty()) {
+                progressCondition.wait_for(
+                    lock,
+                    chrono::milliseconds(1000 * PROGRESS_TICKS / CLOCKS_PER_SEC));
+                continue;
+            }
+            TPaths progressPaths;
+            progressPaths.swap(pendingProgress);
+            lock.unlock();
+            if (progressCallback && (*progressCallback)(progressPaths)) {
+                stop = true;  // signal the workers to stop processing
+            }
+            lock.lock();
+        }
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+
+    for (auto& error : regionErrors) {
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+    // keep the results in the region order, regardless of the thread timing
+    for (auto& regionResult : regionResults) {
+        results.splice(results.end(), regionResult);
+    }
+    stopProcessing = stop;
+}
+
 bool Adaptive2d::FindEntryPoint(TPaths& progressPaths,
                                 const Paths& toolBoundPaths,
                                 const Paths& boundPaths,
@@ -2210,16 +2353,16 @@ bool Adaptive2d::ResolveLinkPath(const IntPoint& startPoint,
     size_t sindex;
     double par;
 
-    // put a time limit on the resolving the link path
-    clock_t time_limit = (clock_t)(max(keepToolDownDistRatio, 3.0) * CLOCKS_PER_SEC / 6);
-
-    clock_t time_out = clock() + time_limit;
+    // put a time limit on the resolving the link path, measured in wall time, as
+    // clock() counts the CPU time of all threads when regions are processed in parallel
+    auto time_out = chrono::steady_clock::now()
+        + chrono::milliseconds(long(max(keepToolDownDistRatio, 3.0) * 1000 / 6));
 
     while (!queue.empty()) {
         if (stopProcessing) {
             return false;
         }
-        if (clock() > time_out) {
+        if (chrono::steady_clock::now() > time_out) {
             cout << "Unable to resolve tool down linking path (limit reached)." << endl;
             return false;
         }
@@ -21,6 +21,7 @@
  ***************************************************************************/
 
 #include "clipper.hpp"
+#include <functional>
 #include <vector>
 #include <list>
 #include <time.h>
@@ -97,6 +98,7 @@ public:
     bool finishingProfile = true;
     double keepToolDownDistRatio = 3.0;  // keep tool down distance ratio
     OperationType opType = OperationType::otClearingInside;
+    int threads = 1;  // number of regions processed in parallel, 0 means all hardware threads
 
     std::list<AdaptiveOutput> Execute(const DPaths& stockPaths,
                                       const DPaths& paths,
@@ -128,6 +130,7 @@ private:
     std::function<bool(TPaths)>* progressCallback = NULL;
     Path toolGeometry;  // tool geometry at coord 0,0, should not be modified
 
+    void ProcessRegions(const std::vector<std::pair<Paths, Paths>>& regions);
     void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
     bool FindEntryPoint(TPaths& progressPaths,
                         const Paths& toolBoundPaths,
@@ -421,7 +421,8 @@ void init_pyarea(py::module& m)
         //.def_readwrite("polyTreeNestingLimit", &Adaptive2d::polyTreeNestingLimit)
         .def_readwrite("tolerance", &Adaptive2d::tolerance)
         .def_readwrite("keepToolDownDistRatio", &Adaptive2d::keepToolDownDistRatio)
-        .def_readwrite("opType", &Adaptive2d::opType);
+        .def_readwrite("opType", &Adaptive2d::opType)
+        .def_readwrite("threads", &Adaptive2d::threads);
 }
 
 PYBIND11_MODULE(area, m)
@@ -60,6 +60,7 @@
 #include "FemSetNodesObject.h"
 #include "FemSolverObject.h"
 #include "HypothesisPy.h"
+#include "PropertyResultArray.h"
 
 #ifdef FC_USE_VTK
 #include "FemPostFilter.h"
@@ -169,6 +170,7 @@ PyMOD_INIT_FUNC(Fem)
 
     Fem::FemResultObject                      ::init();
     Fem::FemResultObjectPython                ::init();
+    Fem::PropertyResultArray                  ::init();
 
     Fem::FemSetObject                         ::init();
     Fem::FemSetElementNodesObject             ::init();
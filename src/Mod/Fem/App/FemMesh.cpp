@@ -57,7 +57,6 @@
 #include <gp_Pnt.hxx>
 
 #include <boost/assign/list_of.hpp>
-#include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
 #endif
 
 #include <App/Application.h>
@@ -71,6 +70,7 @@
 #include <Mod/Mesh/App/Core/Iterator.h>
 
 #include "FemMesh.h"
+#include "FemMeshReader.h"
 #include <FemMeshPy.h>
 
 #ifdef FC_USE_VTK
@@ -888,410 +888,6 @@ std::set<int> FemMesh::getFacesOnly() const
     return resultIDs;
 }
 
-namespace
-{
-class NastranElement
-{
-public:
-    virtual ~NastranElement() = default;
-    bool isValid() const
-    {
-        return element_id >= 0;
-    }
-    virtual void read(const std::string& str1, const std::string& str2) = 0;
-    virtual void addToMesh(SMESHDS_Mesh* meshds) = 0;
-
-protected:
-    int element_id = -1;
-    std::vector<int> elements;
-};
-
-using NastranElementPtr = std::shared_ptr<NastranElement>;
-
-class GRIDElement: public NastranElement
-{
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddNodeWithID(node.x, node.y, node.z, element_id);
-    }
-
-protected:
-    Base::Vector3d node;
-};
-
-class GRIDFreeFieldElement: public GRIDElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        char_separator<char> sep(",");
-        tokenizer<char_separator<char>> tokens(str, sep);
-        std::vector<std::string> token_results;
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() < 6) {
-            return;  // Line does not include Nodal coordinates
-        }
-
-        element_id = atoi(token_results[1].c_str());
-        node.x = atof(token_results[3].c_str());
-        node.y = atof(token_results[4].c_str());
-        node.z = atof(token_results[5].c_str());
-    }
-};
-
-class GRIDLongFieldElement: public GRIDElement
-{
-    void read(const std::string& str1, const std::string& str2) override
-    {
-        element_id = atoi(str1.substr(8, 24).c_str());
-        node.x = atof(str1.substr(40, 56).c_str());
-        node.y = atof(str1.substr(56, 72).c_str());
-        node.z = atof(str2.substr(8, 24).c_str());
-    }
-};
-
-class GRIDSmallFieldElement: public GRIDElement
-{
-    void read(const std::string&, const std::string&) override
-    {}
-};
-
-class CTRIA3Element: public NastranElement
-{
-public:
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        const SMDS_MeshNode* n0 = meshds->FindNode(elements[0]);
-        const SMDS_MeshNode* n1 = meshds->FindNode(elements[1]);
-        const SMDS_MeshNode* n2 = meshds->FindNode(elements[2]);
-        if (n0 && n1 && n2) {
-            meshds->AddFaceWithID(n0, n1, n2, element_id);
-        }
-        else {
-            Base::Console().Warning("NASTRAN: Failed to add face %d from nodes: (%d, %d, %d,)\n",
-                                    element_id,
-                                    elements[0],
-                                    elements[1],
-                                    elements[2]);
-        }
-    }
-};
-
-class CTRIA3FreeFieldElement: public CTRIA3Element
-{
-public:
-    void read(const std::string& str, const std::string&) override
-    {
-        char_separator<char> sep(",");
-        tokenizer<char_separator<char>> tokens(str, sep);
-        std::vector<std::string> token_results;
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() < 6) {
-            return;  // Line does not include enough nodal IDs
-        }
-
-        element_id = atoi(token_results[1].c_str());
-        elements.push_back(atoi(token_results[3].c_str()));
-        elements.push_back(atoi(token_results[4].c_str()));
-        elements.push_back(atoi(token_results[5].c_str()));
-    }
-};
-
-class CTRIA3LongFieldElement: public CTRIA3Element
-{
-public:
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-    }
-};
-
-class CTRIA3SmallFieldElement: public CTRIA3Element
-{
-public:
-    void read(const std::string&, const std::string&) override
-    {}
-};
-
-class CTETRAElement: public NastranElement
-{
-public:
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        const SMDS_MeshNode* n0 = meshds->FindNode(elements[1]);
-        const SMDS_MeshNode* n1 = meshds->FindNode(elements[0]);
-        const SMDS_MeshNode* n2 = meshds->FindNode(elements[2]);
-        const SMDS_MeshNode* n3 = meshds->FindNode(elements[3]);
-        const SMDS_MeshNode* n4 = meshds->FindNode(elements[4]);
-        const SMDS_MeshNode* n5 = meshds->FindNode(elements[6]);
-        const SMDS_MeshNode* n6 = meshds->FindNode(elements[5]);
-        const SMDS_MeshNode* n7 = meshds->FindNode(elements[8]);
-        const SMDS_MeshNode* n8 = meshds->FindNode(elements[7]);
-        const SMDS_MeshNode* n9 = meshds->FindNode(elements[9]);
-        if (n0 && n1 && n2 && n3 && n4 && n5 && n6 && n7 && n8 && n9) {
-            meshds->AddVolumeWithID(n0, n1, n2, n3, n4, n5, n6, n7, n8, n9, element_id);
-        }
-        else {
-            Base::Console().Warning("NASTRAN: Failed to add volume %d from nodes: (%d, %d, %d, %d, "
-                                    "%d, %d, %d, %d, %d, %d)\n",
-                                    element_id,
-                                    elements[1],
-                                    elements[0],
-                                    elements[2],
-                                    elements[3],
-                                    elements[4],
-                                    elements[6],
-                                    elements[5],
-                                    elements[8],
-                                    elements[7],
-                                    elements[9]);
-        }
-    }
-};
-
-class CTETRAFreeFieldElement: public CTETRAElement
-{
-public:
-    void read(const std::string& str, const std::string&) override
-    {
-        char_separator<char> sep(",");
-        tokenizer<char_separator<char>> tokens(str, sep);
-        std::vector<std::string> token_results;
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() < 14) {
-            return;  // Line does not include enough nodal IDs
-        }
-
-        element_id = atoi(token_results[1].c_str());
-        elements.push_back(atoi(token_results[3].c_str()));
-        elements.push_back(atoi(token_results[4].c_str()));
-        elements.push_back(atoi(token_results[5].c_str()));
-        elements.push_back(atoi(token_results[6].c_str()));
-        elements.push_back(atoi(token_results[7].c_str()));
-        elements.push_back(atoi(token_results[8].c_str()));
-        elements.push_back(atoi(token_results[10].c_str()));
-        elements.push_back(atoi(token_results[11].c_str()));
-        elements.push_back(atoi(token_results[12].c_str()));
-        elements.push_back(atoi(token_results[13].c_str()));
-    }
-};
-
-class CTETRALongFieldElement: public CTETRAElement
-{
-public:
-    void read(const std::string& str1, const std::string& str2) override
-    {
-        int id = atoi(str1.substr(8, 16).c_str());
-        int offset = 0;
-
-        if (id < 1000000) {
-            offset = 0;
-        }
-        else if (id < 10000000) {
-            offset = 1;
-        }
-        else if (id < 100000000) {
-            offset = 2;
-        }
-
-
-        element_id = id;
-        elements.push_back(atoi(str1.substr(24, 32).c_str()));
-        elements.push_back(atoi(str1.substr(32, 40).c_str()));
-        elements.push_back(atoi(str1.substr(40, 48).c_str()));
-        elements.push_back(atoi(str1.substr(48, 56).c_str()));
-        elements.push_back(atoi(str1.substr(56, 64).c_str()));
-        elements.push_back(atoi(str1.substr(64, 72).c_str()));
-        elements.push_back(atoi(str2.substr(8 + offset, 16 + offset).c_str()));
-        elements.push_back(atoi(str2.substr(16 + offset, 24 + offset).c_str()));
-        elements.push_back(atoi(str2.substr(24 + offset, 32 + offset).c_str()));
-        elements.push_back(atoi(str2.substr(32 + offset, 40 + offset).c_str()));
-    }
-};
-
-
-class CTETRASmallFieldElement: public CTETRAElement
-{
-public:
-    void read(const std::string&, const std::string&) override
-    {}
-};
-
-// NASTRAN-95
-
-class GRIDNastran95Element: public GRIDElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        node.x = atof(str.substr(24, 32).c_str());
-        node.y = atof(str.substr(32, 40).c_str());
-        node.z = atof(str.substr(40, 48).c_str());
-    }
-};
-
-class CBARElement: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddEdgeWithID(elements[0], elements[1], element_id);
-    }
-};
-
-class CTRMEMElement: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddFaceWithID(elements[0], elements[1], elements[2], element_id);
-    }
-};
-
-class CTRIA1Element: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddFaceWithID(elements[0], elements[1], elements[2], element_id);
-    }
-};
-
-class CQUAD1Element: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-        elements.push_back(atoi(str.substr(48, 56).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddFaceWithID(elements[0], elements[1], elements[2], elements[3], element_id);
-    }
-};
-
-class CTETRANastran95Element: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-        elements.push_back(atoi(str.substr(48, 56).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddFaceWithID(elements[0], elements[1], elements[2], elements[3], element_id);
-    }
-};
-
-class CWEDGEElement: public NastranElement
-{
-    void read(const std::string& str, const std::string&) override
-    {
-        element_id = atoi(str.substr(8, 16).c_str());
-        elements.push_back(atoi(str.substr(24, 32).c_str()));
-        elements.push_back(atoi(str.substr(32, 40).c_str()));
-        elements.push_back(atoi(str.substr(40, 48).c_str()));
-        elements.push_back(atoi(str.substr(48, 56).c_str()));
-        elements.push_back(atoi(str.substr(56, 64).c_str()));
-        elements.push_back(atoi(str.substr(64, 72).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddVolumeWithID(elements[0],
-                                elements[1],
-                                elements[2],
-                                elements[3],
-                                elements[4],
-                                elements[5],
-                                element_id);
-    }
-};
-
-class CHEXA1Element: public NastranElement
-{
-    void read(const std::string& str1, const std::string& str2) override
-    {
-        element_id = atoi(str1.substr(8, 16).c_str());
-        elements.push_back(atoi(str1.substr(24, 32).c_str()));
-        elements.push_back(atoi(str1.substr(32, 40).c_str()));
-        elements.push_back(atoi(str1.substr(40, 48).c_str()));
-        elements.push_back(atoi(str1.substr(48, 56).c_str()));
-        elements.push_back(atoi(str1.substr(56, 64).c_str()));
-        elements.push_back(atoi(str1.substr(64, 72).c_str()));
-
-        elements.push_back(atoi(str2.substr(8, 16).c_str()));
-        elements.push_back(atoi(str2.substr(16, 24).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddVolumeWithID(elements[0],
-                                elements[1],
-                                elements[2],
-                                elements[3],
-                                elements[4],
-                                elements[5],
-                                elements[6],
-                                elements[7],
-                                element_id);
-    }
-};
-
-class CHEXA2Element: public NastranElement
-{
-    void read(const std::string& str1, const std::string& str2) override
-    {
-        element_id = atoi(str1.substr(8, 16).c_str());
-        elements.push_back(atoi(str1.substr(24, 32).c_str()));
-        elements.push_back(atoi(str1.substr(32, 40).c_str()));
-        elements.push_back(atoi(str1.substr(40, 48).c_str()));
-        elements.push_back(atoi(str1.substr(48, 56).c_str()));
-        elements.push_back(atoi(str1.substr(56, 64).c_str()));
-        elements.push_back(atoi(str1.substr(64, 72).c_str()));
-
-        elements.push_back(atoi(str2.substr(8, 16).c_str()));
-        elements.push_back(atoi(str2.substr(16, 24).c_str()));
-    }
-    void addToMesh(SMESHDS_Mesh* meshds) override
-    {
-        meshds->AddVolumeWithID(elements[0],
-                                elements[1],
-                                elements[2],
-                                elements[3],
-                                elements[4],
-                                elements[5],
-                                elements[6],
-                                elements[7],
-                                element_id);
-    }
-};
-
-}  // namespace
-
 void FemMesh::readNastran(const std::string& Filename)
 {
     Base::TimeElapsed Start;
@@ -1299,88 +895,15 @@ void FemMesh::readNastran(const std::string& Filename)
 
     _Mtrx = Base::Matrix4D();
 
-    Base::FileInfo fi(Filename);
-    Base::ifstream inputfile;
-    inputfile.open(fi);
-    inputfile.seekg(std::ifstream::beg);
-    std::string line1, line2;
-    std::vector<NastranElementPtr> mesh_elements;
-    enum Format
-    {
-        FreeField,
-        SmallField,
-        LongField
-    };
-    Format nastranFormat = Format::LongField;
-
-    do {
-        std::getline(inputfile, line1);
-        if (line1.empty()) {
-            continue;
-        }
-        if (line1.find(',') != std::string::npos) {
-            nastranFormat = Format::FreeField;
-        }
-
-        NastranElementPtr ptr;
-        if (line1.find("GRID*") != std::string::npos) {  // We found a Grid line
-            // Now lets extract the GRID Points = Nodes
-            // As each GRID Line consists of two subsequent lines we have to
-            // take care of that as well
-            if (nastranFormat == Format::LongField) {
-                std::getline(inputfile, line2);
-                ptr = std::make_shared<GRIDLongFieldElement>();
-                ptr->read(line1, line2);
-            }
-        }
-        else if (line1.find("GRID") != std::string::npos) {  // We found a Grid line
-            if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<GRIDFreeFieldElement>();
-                ptr->read(line1, "");
-            }
-        }
-        else if (line1.find("CTRIA3") != std::string::npos) {
-            if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<CTRIA3FreeFieldElement>();
-                ptr->read(line1, "");
-            }
-            else {
-                ptr = std::make_shared<CTRIA3LongFieldElement>();
-                ptr->read(line1, "");
-            }
-        }
-        else if (line1.find("CTETRA") != std::string::npos) {
-            // Lets extract the elements
-            // As each Element Line consists of two subsequent lines as well
-            // we have to take care of that
-            // At a first step we only extract Quadratic Tetrahedral Elements
-            std::getline(inputfile, line2);
-            if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<CTETRAFreeFieldElement>();
-                ptr->read(line1.append(line2), "");
-            }
-            else {
-                ptr = std::make_shared<CTETRALongFieldElement>();
-                ptr->read(line1, line2);
-            }
-        }
-
-        if (ptr && ptr->isValid()) {
-            mesh_elements.push_back(ptr);
-        }
-    } while (inputfile.good());
-    inputfile.close();
+    FemMeshData data;
+    FemMeshNastranReader reader;
+    reader.read(Filename, data);
 
     Base::Console().Log("    %f: File read, start building mesh\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // Now fill the SMESH datastructure
-    SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
-    meshds->ClearMesh();
-
-    for (auto it : mesh_elements) {
-        it->addToMesh(meshds);
-    }
+    data.build(this->myMesh->GetMeshDS());
 
     Base::Console().Log("    %f: Done \n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
@@ -1393,125 +916,15 @@ void FemMesh::readNastran95(const std::string& Filename)
 
     _Mtrx = Base::Matrix4D();
 
-    Base::FileInfo fi(Filename);
-    Base::ifstream inputfile;
-    inputfile.open(fi);
-    inputfile.seekg(std::ifstream::beg);
-    std::string line1, line2, tcard;
-
-    std::vector<NastranElementPtr> mesh_nodes;
-    std::vector<NastranElementPtr> mesh_elements;
-
-    do {
-        NastranElementPtr node;
-        NastranElementPtr elem;
-        std::getline(inputfile, line1);
-        // cout << line1 << endl;
-        if (line1.empty()) {
-            continue;
-        }
-
-        tcard = line1.substr(0, 8).c_str();
-        // boost::algorithm::trim(tcard);
-        if (line1.find("GRID*") != std::string::npos)  // We found a Grid line
-        {
-            // Now lets extract the GRID Points = Nodes
-            // As each GRID Line consists of two subsequent lines we have to
-            // take care of that as well
-            std::getline(inputfile, line2);
-            node = std::make_shared<GRIDLongFieldElement>();
-            node->read(line1, line2);
-        }
-        else if (line1.find("GRID") != std::string::npos)  // We found a Grid line
-        {
-            // Base::Console().Log("Found a GRID\n");
-            // D06.inp
-            // GRID    109             .9      .7
-            // Now lets extract the GRID Points = Nodes
-            // Get the Nodal ID
-            node = std::make_shared<GRIDNastran95Element>();
-            node->read(line1, "");
-        }
-
-        // 1D
-        else if (line1.substr(0, 6) == "CBAR") {
-            elem = std::make_shared<CBARElement>();
-            elem->read(line1, "");
-        }
-        // 2d
-        else if (line1.substr(0, 6) == "CTRMEM") {
-            // D06
-            // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CTRMEMElement>();
-            elem->read(line1, "");
-        }
-        else if (line1.substr(0, 6) == "CTRIA1") {
-            // D06
-            // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CTRIA1Element>();
-            elem->read(line1, "");
-        }
-        else if (line1.substr(0, 6) == "CQUAD1") {
-            // D06
-            // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CQUAD1Element>();
-            elem->read(line1, "");
-        }
-
-        // 3d element
-        else if (line1.find("CTETRA") != std::string::npos) {
-            // d011121a.inp
-            // CTETRA  3       200     104     114     3       103
-            elem = std::make_shared<CTETRANastran95Element>();
-            elem->read(line1, "");
-        }
-        else if (line1.find("CWEDGE") != std::string::npos) {
-            // d011121a.inp
-            // CWEDGE  11      200     6       17      16      106     117     116
-            elem = std::make_shared<CTETRANastran95Element>();
-            elem->read(line1, "");
-        }
-        else if (line1.find("CHEXA1") != std::string::npos) {
-            // d011121a.inp
-            // CHEXA1  1       200     1       2       13      12      101     102     +SOL1
-            //+SOL1   113     112
-            std::getline(inputfile, line2);
-            elem = std::make_shared<CHEXA1Element>();
-            elem->read(line1, line2);
-        }
-        else if (line1.find("CHEXA2") != std::string::npos) {
-            // d011121a.inp
-            // CHEXA1  1       200     1       2       13      12      101     102     +SOL1
-            //+SOL1   113     112
-            std::getline(inputfile, line2);
-            elem = std::make_shared<CHEXA2Element>();
-            elem->read(line1, line2);
-        }
-
-        if (node && node->isValid()) {
-            mesh_nodes.push_back(node);
-        }
-
-        if (elem && elem->isValid()) {
-            mesh_elements.push_back(elem);
-        }
-    } while (inputfile.good());
-    inputfile.close();
+    FemMeshData data;
+    FemMeshNastran95Reader reader;
+    reader.read(Filename, data);
 
     Base::Console().Log("    %f: File read, start building mesh\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // Now fill the SMESH datastructure
-    SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
-    meshds->ClearMesh();
-
-    for (auto it : mesh_nodes) {
-        it->addToMesh(meshds);
-    }
-
-    for (auto it : mesh_elements) {
-        it->addToMesh(meshds);
-    }
+    data.build(this->myMesh->GetMeshDS());
 
     Base::Console().Log("    %f: Done \n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
@@ -1522,37 +935,18 @@ void FemMesh::readAbaqus(const std::string& FileName)
     Base::TimeElapsed Start;
     Base::Console().Log("Start: FemMesh::readAbaqus() =================================\n");
 
-    /*
-    Python command to read Abaqus inp mesh file from test suite:
-    from feminout.importInpMesh import read as read_inp
-    femmesh = read_inp(FreeCAD.ConfigGet("AppHomePath") +
-    'Mod/Fem/femtest/data/mesh/tetra10_mesh.inp')
-    */
+    _Mtrx = Base::Matrix4D();
+
+    // only the mesh is read, the same as feminout.importInpMesh does
+    FemMeshData data;
+    FemMeshAbaqusReader reader;
+    reader.read(FileName, data);
+
+    Base::Console().Log("    %f: File read, start building mesh\n",
+                        Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
+
+    data.build(this->myMesh->GetMeshDS());
 
-    PyObject* module = PyImport_ImportModule("feminout.importInpMesh");
-    if (!module) {
-        return;
-    }
-    try {
-        Py::Module abaqusmod(module, true);
-        Py::Callable method(abaqusmod.getAttr("read"));
-        Py::Tuple args(1);
-        args.setItem(0, Py::String(FileName));
-        Py::Object mesh(method.apply(args));
-        if (PyObject_TypeCheck(mesh.ptr(), &FemMeshPy::Type)) {
-            FemMeshPy* fempy = static_cast<FemMeshPy*>(mesh.ptr());
-            FemMesh* fem = fempy->getFemMeshPtr();
-            *this = *fem;  // the deep copy should be avoided, a pointer swap method could be
-                           // implemented see
-                           // https://forum.freecad.org/viewtopic.php?f=10&t=31999&start=10#p274241
-        }
-        else {
-            throw Base::FileException("Problems reading file");
-        }
-    }
-    catch (Py::Exception& e) {
-        e.clear();
-    }
     Base::Console().Log("    %f: Done \n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 }
@@ -1562,37 +956,18 @@ void FemMesh::readZ88(const std::string& FileName)
     Base::TimeElapsed Start;
     Base::Console().Log("Start: FemMesh::readZ88() =================================\n");
 
-    /*
-    Python command to read Z88 mesh file from test suite:
-    from feminout.importZ88Mesh import read as read_z88
-    femmesh = read_z88(FreeCAD.ConfigGet("AppHomePath") +
-    'Mod/Fem/femtest/data/mesh/tetra10_mesh.z88')
-    */
+    _Mtrx = Base::Matrix4D();
+
+    // the same as feminout.importZ88Mesh does, the mesh is empty if an element is not supported
+    FemMeshData data;
+    FemMeshZ88Reader reader;
+    reader.read(FileName, data);
+
+    Base::Console().Log("    %f: File read, start building mesh\n",
+                        Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
+
+    data.build(this->myMesh->GetMeshDS());
 
-    PyObject* module = PyImport_ImportModule("feminout.importZ88Mesh");
-    if (!module) {
-        return;
-    }
-    try {
-        Py::Module z88mod(module, true);
-        Py::Callable method(z88mod.getAttr("read"));
-        Py::Tuple args(1);
-        args.setItem(0, Py::String(FileName));
-        Py::Object mesh(method.apply(args));
-        if (PyObject_TypeCheck(mesh.ptr(), &FemMeshPy::Type)) {
-            FemMeshPy* fempy = static_cast<FemMeshPy*>(mesh.ptr());
-            FemMesh* fem = fempy->getFemMeshPtr();
-            *this = *fem;  // the deep copy should be avoided, a pointer swap method could be
-                           // implemented see
-                           // https://forum.freecad.org/viewtopic.php?f=10&t=31999&start=10#p274241
-        }
-        else {
-            throw Base::FileException("Problems reading file");
-        }
-    }
-    catch (Py::Exception& e) {
-        e.clear();
-    }
     Base::Console().Log("    %f: Done \n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 }
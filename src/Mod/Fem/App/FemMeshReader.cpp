@@ -0,0 +1,1601 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string_view>
+#include <thread>
+
+#include <SMESHDS_Mesh.hxx>
+#endif
+
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Base/TimeInfo.h>
+#include <Base/Vector3D.h>
+
+#include "FemMeshReader.h"
+
+
+using namespace Fem;
+
+namespace
+{
+/// iterates over the lines in [begin, end) without the line breaks
+class LineIterator
+{
+public:
+    LineIterator(const char* begin, const char* end)
+        : pos(begin)
+        , end(end)
+    {}
+
+    bool next(const char*& lineBegin, const char*& lineEnd)
+    {
+        if (pos >= end) {
+            return false;
+        }
+        lineBegin = pos;
+        const char* br = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        lineEnd = br ? br : end;
+        pos = br ? br + 1 : end;
+        if (lineEnd > lineBegin && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+        return true;
+    }
+
+    bool next(std::string& line)
+    {
+        const char* lineBegin {};
+        const char* lineEnd {};
+        if (!next(lineBegin, lineEnd)) {
+            line.clear();
+            return false;
+        }
+        line.assign(lineBegin, lineEnd);
+        return true;
+    }
+
+private:
+    const char* pos;
+    const char* end;
+};
+
+std::string_view trim(std::string_view str)
+{
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front()))) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back()))) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+bool startsWithNoCase(std::string_view str, std::string_view prefix)
+{
+    if (str.size() < prefix.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < prefix.size(); i++) {
+        if (std::toupper(static_cast<unsigned char>(str[i])) != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// splits at \a sep, or at white space if \a sep is zero
+void split(std::string_view str, char sep, std::vector<std::string_view>& fields)
+{
+    fields.clear();
+    if (sep) {
+        std::size_t pos = 0;
+        for (;;) {
+            std::size_t next = str.find(sep, pos);
+            fields.push_back(str.substr(pos, next - pos));
+            if (next == std::string_view::npos) {
+                break;
+            }
+            pos = next + 1;
+        }
+        return;
+    }
+
+    std::size_t pos = 0;
+    while (pos < str.size()) {
+        while (pos < str.size() && std::isspace(static_cast<unsigned char>(str[pos]))) {
+            pos++;
+        }
+        std::size_t start = pos;
+        while (pos < str.size() && !std::isspace(static_cast<unsigned char>(str[pos]))) {
+            pos++;
+        }
+        if (pos > start) {
+            fields.push_back(str.substr(start, pos - start));
+        }
+    }
+}
+
+/// converts a field like Python's int(), i.e. surrounding white space is allowed
+bool toInt(std::string_view str, int& value)
+{
+    str = trim(str);
+    char buf[32];
+    if (str.empty() || str.size() >= sizeof(buf)) {
+        return false;
+    }
+    str.copy(buf, str.size());
+    buf[str.size()] = '\0';
+    char* end {};
+    long val = std::strtol(buf, &end, 10);
+    if (*end != '\0') {
+        return false;
+    }
+    value = static_cast<int>(val);
+    return true;
+}
+
+/// converts a field like Python's float()
+bool toDouble(std::string_view str, double& value)
+{
+    str = trim(str);
+    char buf[64];
+    if (str.empty() || str.size() >= sizeof(buf)) {
+        return false;
+    }
+    str.copy(buf, str.size());
+    buf[str.size()] = '\0';
+    char* end {};
+    value = std::strtod(buf, &end);
+    return *end == '\0';
+}
+
+/// splits a free field card at commas, empty fields are skipped
+void tokenize(std::string_view str, std::vector<std::string_view>& tokens)
+{
+    split(str, ',', tokens);
+    tokens.erase(std::remove_if(tokens.begin(),
+                                tokens.end(),
+                                [](std::string_view token) {
+                                    return token.empty();
+                                }),
+                 tokens.end());
+}
+
+/// like std::string::substr but empty instead of throwing if \a pos is beyond the end
+std::string field(const std::string& str, std::size_t pos, std::size_t len)
+{
+    return pos < str.size() ? str.substr(pos, len) : std::string();
+}
+
+// ----------------------------------------------------------------------------
+
+class NastranElement
+{
+public:
+    virtual ~NastranElement() = default;
+    bool isValid() const
+    {
+        return element_id >= 0;
+    }
+    void clear()
+    {
+        element_id = -1;
+        elements.clear();
+    }
+    virtual void read(const std::string& str1, const std::string& str2) = 0;
+    virtual void addToData(FemMeshData& data) const = 0;
+
+protected:
+    void addElement(FemMeshData& data, int dim, std::initializer_list<int> order) const
+    {
+        int nodes[20];
+        int count = 0;
+        for (int index : order) {
+            nodes[count++] = elements[index];
+        }
+        data.addElement(element_id, dim, nodes, count);
+    }
+
+protected:
+    int element_id = -1;
+    std::vector<int> elements;
+};
+
+class GRIDElement: public NastranElement
+{
+    void addToData(FemMeshData& data) const override
+    {
+        data.addNode(element_id, node.x, node.y, node.z);
+    }
+
+protected:
+    Base::Vector3d node;
+};
+
+class GRIDFreeFieldElement: public GRIDElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        std::vector<std::string_view> token_results;
+        tokenize(str, token_results);
+        if (token_results.size() < 6) {
+            return;  // Line does not include Nodal coordinates
+        }
+
+        element_id = atoi(std::string(token_results[1]).c_str());
+        node.x = atof(std::string(token_results[3]).c_str());
+        node.y = atof(std::string(token_results[4]).c_str());
+        node.z = atof(std::string(token_results[5]).c_str());
+    }
+};
+
+class GRIDLongFieldElement: public GRIDElement
+{
+    void read(const std::string& str1, const std::string& str2) override
+    {
+        element_id = atoi(field(str1, 8, 24).c_str());
+        node.x = atof(field(str1, 40, 56).c_str());
+        node.y = atof(field(str1, 56, 72).c_str());
+        node.z = atof(field(str2, 8, 24).c_str());
+    }
+};
+
+class CTRIA3Element: public NastranElement
+{
+public:
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 2, {0, 1, 2});
+    }
+};
+
+class CTRIA3FreeFieldElement: public CTRIA3Element
+{
+public:
+    void read(const std::string& str, const std::string&) override
+    {
+        std::vector<std::string_view> token_results;
+        tokenize(str, token_results);
+        if (token_results.size() < 6) {
+            return;  // Line does not include enough nodal IDs
+        }
+
+        element_id = atoi(std::string(token_results[1]).c_str());
+        elements.push_back(atoi(std::string(token_results[3]).c_str()));
+        elements.push_back(atoi(std::string(token_results[4]).c_str()));
+        elements.push_back(atoi(std::string(token_results[5]).c_str()));
+    }
+};
+
+class CTRIA3LongFieldElement: public CTRIA3Element
+{
+public:
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+        elements.push_back(atoi(field(str, 40, 48).c_str()));
+    }
+};
+
+class CTETRAElement: public NastranElement
+{
+public:
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 3, {1, 0, 2, 3, 4, 6, 5, 8, 7, 9});
+    }
+};
+
+class CTETRAFreeFieldElement: public CTETRAElement
+{
+public:
+    void read(const std::string& str, const std::string&) override
+    {
+        std::vector<std::string_view> token_results;
+        tokenize(str, token_results);
+        if (token_results.size() < 14) {
+            return;  // Line does not include enough nodal IDs
+        }
+
+        element_id = atoi(std::string(token_results[1]).c_str());
+        elements.push_back(atoi(std::string(token_results[3]).c_str()));
+        elements.push_back(atoi(std::string(token_results[4]).c_str()));
+        elements.push_back(atoi(std::string(token_results[5]).c_str()));
+        elements.push_back(atoi(std::string(token_results[6]).c_str()));
+        elements.push_back(atoi(std::string(token_results[7]).c_str()));
+        elements.push_back(atoi(std::string(token_results[8]).c_str()));
+        elements.push_back(atoi(std::string(token_results[10]).c_str()));
+        elements.push_back(atoi(std::string(token_results[11]).c_str()));
+        elements.push_back(atoi(std::string(token_results[12]).c_str()));
+        elements.push_back(atoi(std::string(token_results[13]).c_str()));
+    }
+};
+
+class CTETRALongFieldElement: public CTETRAElement
+{
+public:
+    void read(const std::string& str1, const std::string& str2) override
+    {
+        int id = atoi(field(str1, 8, 16).c_str());
+        int offset = 0;
+
+        if (id < 1000000) {
+            offset = 0;
+        }
+        else if (id < 10000000) {
+            offset = 1;
+        }
+        else if (id < 100000000) {
+            offset = 2;
+        }
+
+
+        element_id = id;
+        elements.push_back(atoi(field(str1, 24, 32).c_str()));
+        elements.push_back(atoi(field(str1, 32, 40).c_str()));
+        elements.push_back(atoi(field(str1, 40, 48).c_str()));
+        elements.push_back(atoi(field(str1, 48, 56).c_str()));
+        elements.push_back(atoi(field(str1, 56, 64).c_str()));
+        elements.push_back(atoi(field(str1, 64, 72).c_str()));
+        elements.push_back(atoi(field(str2, 8 + offset, 16 + offset).c_str()));
+        elements.push_back(atoi(field(str2, 16 + offset, 24 + offset).c_str()));
+        elements.push_back(atoi(field(str2, 24 + offset, 32 + offset).c_str()));
+        elements.push_back(atoi(field(str2, 32 + offset, 40 + offset).c_str()));
+    }
+};
+
+// NASTRAN-95
+
+class GRIDNastran95Element: public GRIDElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        node.x = atof(field(str, 24, 32).c_str());
+        node.y = atof(field(str, 32, 40).c_str());
+        node.z = atof(field(str, 40, 48).c_str());
+    }
+};
+
+class CBARElement: public NastranElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 1, {0, 1});
+    }
+};
+
+class CTRMEMElement: public NastranElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+        elements.push_back(atoi(field(str, 40, 48).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 2, {0, 1, 2});
+    }
+};
+
+class CTRIA1Element: public NastranElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+        elements.push_back(atoi(field(str, 40, 48).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 2, {0, 1, 2});
+    }
+};
+
+class CQUAD1Element: public NastranElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+        elements.push_back(atoi(field(str, 40, 48).c_str()));
+        elements.push_back(atoi(field(str, 48, 56).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 2, {0, 1, 2, 3});
+    }
+};
+
+class CTETRANastran95Element: public NastranElement
+{
+    void read(const std::string& str, const std::string&) override
+    {
+        element_id = atoi(field(str, 8, 16).c_str());
+        elements.push_back(atoi(field(str, 24, 32).c_str()));
+        elements.push_back(atoi(field(str, 32, 40).c_str()));
+        elements.push_back(atoi(field(str, 40, 48).c_str()));
+        elements.push_back(atoi(field(str, 48, 56).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 2, {0, 1, 2, 3});
+    }
+};
+
+class CHEXAElement: public NastranElement
+{
+    void read(const std::string& str1, const std::string& str2) override
+    {
+        element_id = atoi(field(str1, 8, 16).c_str());
+        elements.push_back(atoi(field(str1, 24, 32).c_str()));
+        elements.push_back(atoi(field(str1, 32, 40).c_str()));
+        elements.push_back(atoi(field(str1, 40, 48).c_str()));
+        elements.push_back(atoi(field(str1, 48, 56).c_str()));
+        elements.push_back(atoi(field(str1, 56, 64).c_str()));
+        elements.push_back(atoi(field(str1, 64, 72).c_str()));
+
+        elements.push_back(atoi(field(str2, 8, 16).c_str()));
+        elements.push_back(atoi(field(str2, 16, 24).c_str()));
+    }
+    void addToData(FemMeshData& data) const override
+    {
+        addElement(data, 3, {0, 1, 2, 3, 4, 5, 6, 7});
+    }
+};
+
+enum NastranFlags
+{
+    // a free field card has been found, the rest of the file is read as free field format
+    FreeField = 1
+};
+
+// ----------------------------------------------------------------------------
+
+/// The node count and the node order of an Abaqus element type
+struct AbaqusElement
+{
+    int dim;
+    // the CalculiX node index of each SMESH node
+    std::vector<int> order;
+};
+
+const AbaqusElement* findAbaqusElement(const std::string& type)
+{
+    // clang-format off
+    static const AbaqusElement tria3 {2, {0, 1, 2}};
+    static const AbaqusElement tria6 {2, {0, 1, 2, 3, 4, 5}};
+    static const AbaqusElement quad4 {2, {0, 1, 2, 3}};
+    static const AbaqusElement quad8 {2, {0, 1, 2, 3, 4, 5, 6, 7}};
+    static const AbaqusElement tetra4 {3, {1, 0, 2, 3}};
+    static const AbaqusElement tetra10 {3, {1, 0, 2, 3, 4, 6, 5, 8, 7, 9}};
+    static const AbaqusElement hexa8 {3, {5, 6, 7, 4, 1, 2, 3, 0}};
+    static const AbaqusElement hexa20 {3, {5, 6, 7, 4, 1, 2, 3, 0, 13, 14, 15, 12,
+                                           9, 10, 11, 8, 17, 18, 19, 16}};
+    static const AbaqusElement penta6 {3, {4, 5, 3, 1, 2, 0}};
+    static const AbaqusElement penta15 {3, {4, 5, 3, 1, 2, 0, 10, 11, 9, 7, 8, 6, 13, 14, 12}};
+    static const AbaqusElement seg2 {1, {0, 1}};
+    static const AbaqusElement seg3 {1, {0, 2, 1}};
+    static const std::vector<std::pair<const char*, const AbaqusElement*>> types = {
+        {"S3", &tria3}, {"CPS3", &tria3}, {"CPE3", &tria3}, {"CAX3", &tria3},
+        {"S6", &tria6}, {"CPS6", &tria6}, {"CPE6", &tria6}, {"CAX6", &tria6},
+        {"S4", &quad4}, {"S4R", &quad4}, {"CPS4", &quad4}, {"CPS4R", &quad4},
+        {"CPE4", &quad4}, {"CPE4R", &quad4}, {"CAX4", &quad4}, {"CAX4R", &quad4},
+        {"S8", &quad8}, {"S8R", &quad8}, {"CPS8", &quad8}, {"CPS8R", &quad8},
+        {"CPE8", &quad8}, {"CPE8R", &quad8}, {"CAX8", &quad8}, {"CAX8R", &quad8},
+        {"C3D4", &tetra4}, {"C3D10", &tetra10},
+        {"C3D8", &hexa8}, {"C3D8R", &hexa8}, {"C3D8I", &hexa8},
+        {"C3D20", &hexa20}, {"C3D20R", &hexa20}, {"C3D20RI", &hexa20},
+        {"C3D6", &penta6}, {"C3D15", &penta15},
+        {"B31", &seg2}, {"B31R", &seg2}, {"T3D2", &seg2},
+        {"B32", &seg3}, {"B32R", &seg3}, {"T3D3", &seg3},
+    };
+    // clang-format on
+
+    for (const auto& it : types) {
+        if (type == it.first) {
+            return it.second;
+        }
+    }
+    return nullptr;
+}
+
+enum AbaqusFlags
+{
+    // after the first *STEP only the history data follows
+    AbaqusStep = 1
+};
+
+constexpr const char* abaqusNodeSection = "*NODE";
+
+/** Handles a keyword line and updates \a context. Returns false if the line is not a keyword,
+ * \a error is set if the line starts an unsupported element section.
+ */
+bool abaqusKeyword(std::string_view line, FemMeshReader::Context& context, std::string& error)
+{
+    if (line.empty() || line[0] != '*') {
+        return false;
+    }
+    // comments and includes do not end the current section
+    if (startsWithNoCase(line, "**") || startsWithNoCase(line, "*INCLUDE")) {
+        return true;
+    }
+
+    context.state = 0;
+    context.section.clear();
+    bool model = (context.flags & AbaqusStep) == 0;
+    if (startsWithNoCase(line, "*NODE")) {
+        if (model) {
+            context.section = abaqusNodeSection;
+        }
+    }
+    else if (startsWithNoCase(line, "*ELEMENT")) {
+        if (!model) {
+            return true;
+        }
+        std::vector<std::string_view> params;
+        split(line.substr(8), ',', params);
+        std::string type;
+        for (std::string_view param : params) {
+            param = trim(param);
+            if (startsWithNoCase(param, "TYPE")) {
+                std::size_t pos = param.find('=');
+                if (pos != std::string_view::npos) {
+                    type = trim(param.substr(pos + 1));
+                }
+            }
+        }
+        std::transform(type.begin(), type.end(), type.begin(), [](unsigned char c) {
+            return std::toupper(c);
+        });
+
+        if (type == "B32" || type == "B32R" || type == "T3D3") {
+            error = "Error: seg3 (3-node beam element type) not supported, yet.";
+        }
+        if (findAbaqusElement(type)) {
+            context.section = type;
+        }
+        else {
+            error = "Error: " + type + " not supported.";
+        }
+    }
+    else if (startsWithNoCase(line, "*STEP")) {
+        context.flags |= AbaqusStep;
+    }
+    return true;
+}
+
+/** Reads the nodes of an element line, \a remaining is the number of nodes still missing from
+ * the previous line, zero if the line starts a new element. Returns the number of nodes still
+ * missing after this line.
+ */
+int readAbaqusElement(std::string_view line,
+                      const AbaqusElement& type,
+                      int remaining,
+                      std::vector<std::string_view>& fields,
+                      int& id,
+                      std::vector<int>& nodes)
+{
+    split(line, ',', fields);
+    std::size_t pos = 0;
+    if (remaining == 0) {
+        nodes.clear();
+        remaining = static_cast<int>(type.order.size());
+        if (!toInt(fields[0], id)) {
+            return -1;
+        }
+        pos = 1;
+    }
+
+    for (; pos < fields.size() && remaining > 0; pos++) {
+        int node {};
+        if (!toInt(fields[pos], node)) {
+            break;
+        }
+        nodes.push_back(node);
+        remaining--;
+    }
+    return remaining;
+}
+
+// ----------------------------------------------------------------------------
+
+/// The node order of a supported Z88 element type
+struct Z88Element
+{
+    int dim;
+    // the Z88 node index of each SMESH node
+    std::vector<int> order;
+};
+
+const Z88Element* findZ88Element(int type)
+{
+    // stab4 or stab5 or welle5 or beam13 or beam25 Z88 --> seg2 FreeCAD
+    static const Z88Element seg2 {1, {0, 1}};
+    // scheibe3 or scheibe14 or schale24 Z88 --> tria6 FreeCAD
+    static const Z88Element tria6 {2, {0, 1, 2, 3, 4, 5}};
+    // scheibe7 or platte20 or schale23 Z88 --> quad8 FreeCAD
+    static const Z88Element quad8 {2, {0, 1, 2, 3, 4, 5, 6, 7}};
+    // volume17 Z88 --> tetra4 FreeCAD
+    // N4, N2, N3, N1
+    static const Z88Element tetra4 {3, {3, 1, 2, 0}};
+    // volume16 Z88 --> tetra10 FreeCAD
+    // N1, N2, N4, N3, N5, N8, N10, N7, N6, N9
+    static const Z88Element tetra10 {3, {0, 1, 3, 2, 4, 7, 9, 6, 5, 8}};
+    // volume1 Z88 --> hexa8 FreeCAD
+    static const Z88Element hexa8 {3, {0, 1, 2, 3, 4, 5, 6, 7}};
+    // volume10 Z88 --> hexa20 FreeCAD
+    static const Z88Element hexa20 {
+        3,
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}};
+
+    switch (type) {
+        case 2:
+        case 4:
+        case 5:
+        case 9:
+        case 13:
+        case 25:
+            return &seg2;
+        case 3:
+        case 14:
+        case 24:
+            return &tria6;
+        case 7:
+        case 20:
+        case 23:
+            return &quad8;
+        case 17:
+            return &tetra4;
+        case 16:
+            return &tetra10;
+        case 1:
+            return &hexa8;
+        case 10:
+            return &hexa20;
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+void FemMeshData::addNode(int id, double x, double y, double z)
+{
+    nodeIds.push_back(id);
+    coords.push_back(x);
+    coords.push_back(y);
+    coords.push_back(z);
+}
+
+void FemMeshData::addElement(int id, int dim, const int* nodes, int count)
+{
+    elementIds.push_back(id);
+    elementDims.push_back(static_cast<unsigned char>(dim));
+    elementOffsets.push_back(elementNodes.size());
+    elementNodes.insert(elementNodes.end(), nodes, nodes + count);
+}
+
+void FemMeshData::append(FemMeshData&& data)
+{
+    if (nodeIds.empty() && elementIds.empty()) {
+        *this = std::move(data);
+        return;
+    }
+
+    nodeIds.insert(nodeIds.end(), data.nodeIds.begin(), data.nodeIds.end());
+    coords.insert(coords.end(), data.coords.begin(), data.coords.end());
+    std::size_t offset = elementNodes.size();
+    elementIds.insert(elementIds.end(), data.elementIds.begin(), data.elementIds.end());
+    elementDims.insert(elementDims.end(), data.elementDims.begin(), data.elementDims.end());
+    for (std::size_t it : data.elementOffsets) {
+        elementOffsets.push_back(it + offset);
+    }
+    elementNodes.insert(elementNodes.end(), data.elementNodes.begin(), data.elementNodes.end());
+    data.clear();
+}
+
+void FemMeshData::clear()
+{
+    nodeIds.clear();
+    coords.clear();
+    elementIds.clear();
+    elementDims.clear();
+    elementOffsets.clear();
+    elementNodes.clear();
+}
+
+void FemMeshData::build(SMESHDS_Mesh* meshds) const
+{
+    meshds->ClearMesh();
+
+    // the node table of SMESH is indexed by the node id, allocate it once
+    if (!nodeIds.empty()) {
+        int maxId = *std::max_element(nodeIds.begin(), nodeIds.end());
+        if (maxId > 0) {
+            meshds->incrementNodesCapacity(maxId + 1);
+        }
+    }
+
+    for (std::size_t i = 0; i < nodeIds.size(); i++) {
+        meshds->AddNodeWithID(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2], nodeIds[i]);
+    }
+
+    std::size_t failed = 0;
+    int failedId = 0;
+    const SMDS_MeshNode* n[20];
+    for (std::size_t i = 0; i < elementIds.size(); i++) {
+        std::size_t begin = elementOffsets[i];
+        std::size_t end = i + 1 < elementIds.size() ? elementOffsets[i + 1] : elementNodes.size();
+        int count = static_cast<int>(end - begin);
+        int id = elementIds[i];
+
+        bool found = count <= 20;
+        for (int j = 0; found && j < count; j++) {
+            n[j] = meshds->FindNode(elementNodes[begin + j]);
+            found = n[j] != nullptr;
+        }
+
+        SMDS_MeshElement* elem = nullptr;
+        if (found) {
+            switch (elementDims[i]) {
+                case 1:
+                    switch (count) {
+                        case 2:
+                            elem = meshds->AddEdgeWithID(n[0], n[1], id);
+                            break;
+                        case 3:
+                            elem = meshds->AddEdgeWithID(n[0], n[1], n[2], id);
+                            break;
+                    }
+                    break;
+                case 2:
+                    switch (count) {
+                        case 3:
+                            elem = meshds->AddFaceWithID(n[0], n[1], n[2], id);
+                            break;
+                        case 4:
+                            elem = meshds->AddFaceWithID(n[0], n[1], n[2], n[3], id);
+                            break;
+                        case 6:
+                            elem = meshds->AddFaceWithID(n[0], n[1], n[2], n[3], n[4], n[5], id);
+                            break;
+                        case 8:
+                            elem = meshds->AddFaceWithID(n[0],
+                                                         n[1],
+                                                         n[2],
+                                                         n[3],
+                                                         n[4],
+                                                         n[5],
+                                                         n[6],
+                                                         n[7],
+                                                         id);
+                            break;
+                    }
+                    break;
+                case 3:
+                    switch (count) {
+                        case 4:
+                            elem = meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], id);
+                            break;
+                        case 5:
+                            elem = meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], n[4], id);
+                            break;
+                        case 6:
+                            elem =
+                                meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], n[4], n[5], id);
+                            break;
+                        case 8:
+                            elem = meshds->AddVolumeWithID(n[0],
+                                                           n[1],
+                                                           n[2],
+                                                           n[3],
+                                                           n[4],
+                                                           n[5],
+                                                           n[6],
+                                                           n[7],
+                                                           id);
+                            break;
+                        case 10:
+                            elem = meshds->AddVolumeWithID(n[0],
+                                                           n[1],
+                                                           n[2],
+                                                           n[3],
+                                                           n[4],
+                                                           n[5],
+                                                           n[6],
+                                                           n[7],
+                                                           n[8],
+                                                           n[9],
+                                                           id);
+                            break;
+                        case 13:
+                            elem = meshds->AddVolumeWithID(n[0],
+                                                           n[1],
+                                                           n[2],
+                                                           n[3],
+                                                           n[4],
+                                                           n[5],
+                                                           n[6],
+                                                           n[7],
+                                                           n[8],
+                                                           n[9],
+                                                           n[10],
+                                                           n[11],
+                                                           n[12],
+                                                           id);
+                            break;
+                        case 15:
+                            elem = meshds->AddVolumeWithID(n[0],
+                                                           n[1],
+                                                           n[2],
+                                                           n[3],
+                                                           n[4],
+                                                           n[5],
+                                                           n[6],
+                                                           n[7],
+                                                           n[8],
+                                                           n[9],
+                                                           n[10],
+                                                           n[11],
+                                                           n[12],
+                                                           n[13],
+                                                           n[14],
+                                                           id);
+                            break;
+                        case 20:
+                            elem = meshds->AddVolumeWithID(n[0],
+                                                           n[1],
+                                                           n[2],
+                                                           n[3],
+                                                           n[4],
+                                                           n[5],
+                                                           n[6],
+                                                           n[7],
+                                                           n[8],
+                                                           n[9],
+                                                           n[10],
+                                                           n[11],
+                                                           n[12],
+                                                           n[13],
+                                                           n[14],
+                                                           n[15],
+                                                           n[16],
+                                                           n[17],
+                                                           n[18],
+                                                           n[19],
+                                                           id);
+                            break;
+                    }
+                    break;
+            }
+        }
+
+        if (!elem) {
+            if (failed == 0) {
+                failedId = id;
+            }
+            failed++;
+        }
+    }
+
+    if (failed > 0) {
+        Base::Console().Warning("FEM: Failed to add %lu elements, the first one is element %d\n",
+                                static_cast<unsigned long>(failed),
+                                failedId);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+std::size_t FemMeshReader::countThreads()
+{
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+void FemMeshReader::parallel(std::size_t count, const RangeFunction& func)
+{
+    std::size_t numThreads = std::min(count, countThreads());
+    if (numThreads <= 1) {
+        if (count > 0) {
+            func(0, count, 0);
+        }
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::size_t step = count / numThreads;
+    std::size_t rest = count % numThreads;
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < numThreads; i++) {
+        std::size_t end = begin + step + (i < rest ? 1 : 0);
+        threads.emplace_back([&func, &exceptions, begin, end, i]() {
+            try {
+                func(begin, end, i);
+            }
+            catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+        begin = end;
+    }
+
+    for (auto& it : threads) {
+        it.join();
+    }
+    for (auto& it : exceptions) {
+        if (it) {
+            std::rethrow_exception(it);
+        }
+    }
+}
+
+void FemMeshReader::read(const std::string& fileName, FemMeshData& data)
+{
+    Base::TimeElapsed start;
+    errors.clear();
+    failed = false;
+
+    FemMeshData result;
+    Context context;
+    readFile(fileName, context, result);
+
+    for (const auto& it : errors) {
+        Base::Console().Error("%s\n", it.c_str());
+    }
+
+    double seconds = Base::TimeElapsed::diffTimeF(start, Base::TimeElapsed());
+    double size = static_cast<double>(Base::FileInfo(fileName).size()) / (1024.0 * 1024.0);
+    Base::Console().Log("    %f: Read %lu nodes and %lu elements (%.1f MB/s)\n",
+                        seconds,
+                        static_cast<unsigned long>(result.countNodes()),
+                        static_cast<unsigned long>(result.countElements()),
+                        seconds > 0.0 ? size / seconds : 0.0);
+
+    if (!isFailed()) {
+        data.append(std::move(result));
+    }
+}
+
+void FemMeshReader::setBlockSize(std::size_t block, std::size_t minChunk)
+{
+    blockSize = std::max<std::size_t>(block, 1);
+    minChunkSize = std::max<std::size_t>(minChunk, 1);
+}
+
+std::string FemMeshReader::includedFile(const char*, const char*) const
+{
+    return {};
+}
+
+void FemMeshReader::reportError(const std::string& msg) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    errors.insert(msg);
+}
+
+void FemMeshReader::parseChunks(const Chunks& chunks, const char* end, FemMeshData& data) const
+{
+    std::vector<FemMeshData> parts(chunks.size());
+    parallel(chunks.size(), [&](std::size_t begin, std::size_t last, std::size_t) {
+        for (std::size_t i = begin; i < last; i++) {
+            const char* chunkEnd = i + 1 < chunks.size() ? chunks[i + 1].first : end;
+            parse(chunks[i].first, chunkEnd, chunks[i].second, parts[i]);
+        }
+    });
+
+    for (auto& it : parts) {
+        data.append(std::move(it));
+    }
+}
+
+void FemMeshReader::readFile(const std::string& fileName, Context& context, FemMeshData& data)
+{
+    Base::FileInfo fi(fileName);
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    if (!file) {
+        reportError("Cannot open file " + fileName);
+        return;
+    }
+
+    // small files are read in one block
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = std::max<std::streamoff>(file.tellg(), 0);
+    std::size_t size = std::min(blockSize, static_cast<std::size_t>(fileSize) + 1);
+    file.seekg(0, std::ios::beg);
+
+    std::string buffer;
+    bool eof = false;
+    while (!eof && !isFailed()) {
+        // append the next block to the part of the previous block that is not parsed yet
+        std::size_t carry = buffer.size();
+        buffer.resize(carry + size);
+        file.read(&buffer[carry], static_cast<std::streamsize>(size));
+        buffer.resize(carry + static_cast<std::size_t>(file.gcount()));
+        eof = !file;
+
+        const char* begin = buffer.data();
+        const char* end = begin + buffer.size();
+        const std::size_t chunkSize = std::max(buffer.size() / countThreads(), minChunkSize);
+
+        // the block always starts at a record
+        Chunks chunks;
+        chunks.emplace_back(begin, context);
+        const char* nextChunk = begin + chunkSize;
+        const char* lastStart = begin;
+        Context lastContext = context;
+
+        const char* line = begin;
+        while (line < end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+            if (!lineEnd) {
+                if (!eof) {
+                    break;  // incomplete line, it is read with the next block
+                }
+                lineEnd = end;
+            }
+            const char* next = lineEnd < end ? lineEnd + 1 : end;
+            if (lineEnd > line && lineEnd[-1] == '\r') {
+                --lineEnd;
+            }
+
+            Context before = context;
+            bool start = scanLine(line, lineEnd, context);
+            context.line++;
+            if (start) {
+                lastStart = line;
+                lastContext = before;
+                if (line >= nextChunk) {
+                    chunks.emplace_back(line, before);
+                    nextChunk = line + chunkSize;
+                }
+            }
+
+            std::string include = includedFile(line, lineEnd);
+            if (!include.empty()) {
+                // everything before the include must be in the data before its content
+                parseChunks(chunks, next, data);
+
+                Base::FileInfo includeFile(include);
+                if (!includeFile.exists()) {
+                    includeFile.setFile(fi.dirPath() + "/" + include);
+                }
+                long lineNo = context.line;
+                context.line = 0;
+                readFile(includeFile.filePath(), context, data);
+                context.line = lineNo;
+
+                chunks.clear();
+                chunks.emplace_back(next, context);
+                nextChunk = next + chunkSize;
+                lastStart = next;
+                lastContext = context;
+            }
+
+            line = next;
+        }
+
+        if (eof) {
+            parseChunks(chunks, end, data);
+            break;
+        }
+
+        // parse up to the last record start, the rest is scanned again with the next block
+        while (!chunks.empty() && chunks.back().first >= lastStart) {
+            chunks.pop_back();
+        }
+        parseChunks(chunks, lastStart, data);
+        if (lastStart == begin) {
+            // a single record is larger than the block
+            size *= 2;
+        }
+        buffer.erase(0, static_cast<std::size_t>(lastStart - begin));
+        context = lastContext;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+bool FemMeshNastranReader::scanLine(const char* begin, const char* end, Context& context)
+{
+    // the second line of a record
+    if (context.state) {
+        context.state = 0;
+        return false;
+    }
+
+    std::string_view line(begin, end - begin);
+    if (line.find(',') != std::string_view::npos) {
+        context.flags |= FreeField;
+    }
+
+    if (line.find("GRID*") != std::string_view::npos) {
+        if ((context.flags & FreeField) == 0) {
+            context.state = 1;
+        }
+    }
+    else if (line.find("GRID") != std::string_view::npos
+             || line.find("CTRIA3") != std::string_view::npos) {
+        // single line
+    }
+    else if (line.find("CTETRA") != std::string_view::npos) {
+        context.state = 1;
+    }
+    return true;
+}
+
+void FemMeshNastranReader::parse(const char* begin,
+                                 const char* end,
+                                 Context context,
+                                 FemMeshData& data) const
+{
+    GRIDFreeFieldElement gridFree;
+    GRIDLongFieldElement gridLong;
+    CTRIA3FreeFieldElement triaFree;
+    CTRIA3LongFieldElement triaLong;
+    CTETRAFreeFieldElement tetraFree;
+    CTETRALongFieldElement tetraLong;
+
+    bool freeField = (context.flags & FreeField) != 0;
+    LineIterator lines(begin, end);
+    std::string line1, line2;
+    while (lines.next(line1)) {
+        if (line1.empty()) {
+            continue;
+        }
+        if (line1.find(',') != std::string::npos) {
+            freeField = true;
+        }
+
+        NastranElement* ptr = nullptr;
+        if (line1.find("GRID*") != std::string::npos) {  // We found a Grid line
+            // Now lets extract the GRID Points = Nodes
+            // As each GRID Line consists of two subsequent lines we have to
+            // take care of that as well
+            if (!freeField) {
+                lines.next(line2);
+                ptr = &gridLong;
+                ptr->clear();
+                ptr->read(line1, line2);
+            }
+        }
+        else if (line1.find("GRID") != std::string::npos) {  // We found a Grid line
+            if (freeField) {
+                ptr = &gridFree;
+                ptr->clear();
+                ptr->read(line1, "");
+            }
+        }
+        else if (line1.find("CTRIA3") != std::string::npos) {
+            ptr = freeField ? static_cast<NastranElement*>(&triaFree) : &triaLong;
+            ptr->clear();
+            ptr->read(line1, "");
+        }
+        else if (line1.find("CTETRA") != std::string::npos) {
+            // Lets extract the elements
+            // As each Element Line consists of two subsequent lines as well
+            // we have to take care of that
+            // At a first step we only extract Quadratic Tetrahedral Elements
+            lines.next(line2);
+            if (freeField) {
+                ptr = &tetraFree;
+                ptr->clear();
+                ptr->read(line1.append(line2), "");
+            }
+            else {
+                ptr = &tetraLong;
+                ptr->clear();
+                ptr->read(line1, line2);
+            }
+        }
+
+        if (ptr && ptr->isValid()) {
+            ptr->addToData(data);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+bool FemMeshNastran95Reader::scanLine(const char* begin, const char* end, Context& context)
+{
+    // the second line of a record
+    if (context.state) {
+        context.state = 0;
+        return false;
+    }
+
+    std::string_view line(begin, end - begin);
+    if (line.find("GRID*") != std::string_view::npos) {
+        context.state = 1;
+    }
+    else if (line.find("GRID") != std::string_view::npos) {
+        // single line
+    }
+    else if (line.find("CHEXA1") != std::string_view::npos
+             || line.find("CHEXA2") != std::string_view::npos) {
+        context.state = 1;
+    }
+    return true;
+}
+
+void FemMeshNastran95Reader::parse(const char* begin,
+                                   const char* end,
+                                   Context,
+                                   FemMeshData& data) const
+{
+    GRIDLongFieldElement gridLong;
+    GRIDNastran95Element grid;
+    CBARElement bar;
+    CTRMEMElement trmem;
+    CTRIA1Element tria;
+    CQUAD1Element quad;
+    CTETRANastran95Element tetra;
+    CHEXAElement hexa;
+
+    LineIterator lines(begin, end);
+    std::string line1, line2;
+    while (lines.next(line1)) {
+        if (line1.empty()) {
+            continue;
+        }
+
+        NastranElement* ptr = nullptr;
+        std::string tcard = line1.substr(0, 6);
+        if (line1.find("GRID*") != std::string::npos)  // We found a Grid line
+        {
+            // Now lets extract the GRID Points = Nodes
+            // As each GRID Line consists of two subsequent lines we have to
+            // take care of that as well
+            lines.next(line2);
+            ptr = &gridLong;
+        }
+        else if (line1.find("GRID") != std::string::npos)  // We found a Grid line
+        {
+            // D06.inp
+            // GRID    109             .9      .7
+            ptr = &grid;
+        }
+
+        // 1D
+        else if (tcard == "CBAR") {
+            ptr = &bar;
+        }
+        // 2d
+        else if (tcard == "CTRMEM") {
+            // D06
+            // CTRMEM  322     1       179     180     185
+            ptr = &trmem;
+        }
+        else if (tcard == "CTRIA1") {
+            ptr = &tria;
+        }
+        else if (tcard == "CQUAD1") {
+            ptr = &quad;
+        }
+
+        // 3d element
+        else if (line1.find("CTETRA") != std::string::npos) {
+            // d011121a.inp
+            // CTETRA  3       200     104     114     3       103
+            ptr = &tetra;
+        }
+        else if (line1.find("CWEDGE") != std::string::npos) {
+            // d011121a.inp
+            // CWEDGE  11      200     6       17      16      106     117     116
+            ptr = &tetra;
+        }
+        else if (line1.find("CHEXA1") != std::string::npos
+                 || line1.find("CHEXA2") != std::string::npos) {
+            // d011121a.inp
+            // CHEXA1  1       200     1       2       13      12      101     102     +SOL1
+            //+SOL1   113     112
+            lines.next(line2);
+            ptr = &hexa;
+        }
+
+        if (ptr) {
+            ptr->clear();
+            ptr->read(line1, line2);
+            if (ptr->isValid()) {
+                ptr->addToData(data);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+bool FemMeshAbaqusReader::scanLine(const char* begin, const char* end, Context& context)
+{
+    std::string_view line(begin, end - begin);
+    if (trim(line).empty()) {
+        return context.state == 0;
+    }
+
+    std::string error;
+    if (abaqusKeyword(line, context, error)) {
+        if (!error.empty()) {
+            reportError(error);
+        }
+        // comments may be inside an element
+        return context.state == 0;
+    }
+
+    const AbaqusElement* type = findAbaqusElement(context.section);
+    if (!type) {
+        return true;
+    }
+
+    // an element may continue on the next lines
+    bool start = context.state == 0;
+    int id {};
+    context.state =
+        std::max(0, readAbaqusElement(line, *type, context.state, scanFields, id, scanNodes));
+    return start;
+}
+
+void FemMeshAbaqusReader::parse(const char* begin,
+                                const char* end,
+                                Context context,
+                                FemMeshData& data) const
+{
+    const AbaqusElement* type = findAbaqusElement(context.section);
+    std::vector<std::string_view> fields;
+    std::vector<int> nodes;
+    int ordered[20];
+    int id = 0;
+    double x {}, y {}, z {};
+    std::string error;
+
+    LineIterator lines(begin, end);
+    const char* lineBegin {};
+    const char* lineEnd {};
+    for (; lines.next(lineBegin, lineEnd); context.line++) {
+        std::string_view line(lineBegin, lineEnd - lineBegin);
+        if (trim(line).empty()) {
+            continue;
+        }
+
+        if (abaqusKeyword(line, context, error)) {
+            type = findAbaqusElement(context.section);
+            continue;
+        }
+
+        if (context.section == abaqusNodeSection) {
+            split(line, ',', fields);
+            if (fields.size() < 4 || !toInt(fields[0], id) || !toDouble(fields[1], x)
+                || !toDouble(fields[2], y) || !toDouble(fields[3], z)) {
+                reportError("Invalid node in line " + std::to_string(context.line + 1));
+                continue;
+            }
+            data.addNode(id, x, y, z);
+        }
+        else if (type) {
+            int remaining = readAbaqusElement(line, *type, context.state, fields, id, nodes);
+            if (remaining < 0) {
+                reportError("Invalid element in line " + std::to_string(context.line + 1));
+                context.state = 0;
+                continue;
+            }
+
+            context.state = remaining;
+            if (remaining == 0) {
+                // switch from the CalculiX node numbering to the FreeCAD node numbering
+                int count = static_cast<int>(type->order.size());
+                for (int i = 0; i < count; i++) {
+                    ordered[i] = nodes[type->order[i]];
+                }
+                data.addElement(id, type->dim, ordered, count);
+            }
+        }
+    }
+}
+
+std::string FemMeshAbaqusReader::includedFile(const char* begin, const char* end) const
+{
+    std::string_view line(begin, end - begin);
+    if (!startsWithNoCase(line, "*INCLUDE")) {
+        return {};
+    }
+
+    std::size_t pos = line.find('=');
+    if (pos == std::string_view::npos) {
+        return {};
+    }
+    std::string_view file = trim(line.substr(pos + 1));
+    while (!file.empty() && file.front() == '"') {
+        file.remove_prefix(1);
+    }
+    while (!file.empty() && file.back() == '"') {
+        file.remove_suffix(1);
+    }
+    return std::string(file);
+}
+
+// ----------------------------------------------------------------------------
+
+bool FemMeshZ88Reader::scanLine(const char* begin, const char* end, Context& context)
+{
+    if (context.line > 0) {
+        // an element consists of two lines
+        long offset = context.line - numNodes - 1;
+        return offset < 0 || offset % 2 == 0;
+    }
+
+    std::vector<std::string_view> fields;
+    split(std::string_view(begin, end - begin), 0, fields);
+    int dim {}, nodes {}, elements {}, kflag {};
+    if (fields.size() < 5 || !toInt(fields[0], dim) || !toInt(fields[1], nodes)
+        || !toInt(fields[2], elements) || !toInt(fields[4], kflag)) {
+        reportError("Z88: Invalid header line");
+        setFailed();
+        return true;
+    }
+
+    // for non rotational elements is --> kflag = 0 --> cartesian, kflag = 1 polar coordinates
+    if (kflag) {
+        reportError("KFLAG = 1, Rotational coordinates not supported at the moment");
+        setFailed();
+    }
+
+    dimension = dim;
+    numNodes = nodes;
+    numElements = elements;
+    return true;
+}
+
+void FemMeshZ88Reader::parse(const char* begin,
+                             const char* end,
+                             Context context,
+                             FemMeshData& data) const
+{
+    std::vector<std::string_view> fields;
+    int elemNo = 0;
+    int elemType = 0;
+    int nodes[20];
+    int ordered[20];
+    const long lastLine = numNodes + 2 * numElements;
+
+    auto unsupported = [this](const char* name, const char* reason) {
+        reportError(std::string("Z88 Element No. ") + name + "\n" + reason);
+        setFailed();
+    };
+
+    LineIterator lines(begin, end);
+    const char* lineBegin {};
+    const char* lineEnd {};
+    for (; lines.next(lineBegin, lineEnd) && !isFailed(); context.line++) {
+        long lno = context.line;
+        if (lno == 0 || lno > lastLine) {
+            continue;
+        }
+
+        split(std::string_view(lineBegin, lineEnd - lineBegin), 0, fields);
+        if (lno <= numNodes) {
+            // node line
+            int id {};
+            double x {}, y {}, z {};
+            bool valid = fields.size() >= 4 && toInt(fields[0], id) && toDouble(fields[2], x)
+                && toDouble(fields[3], y);
+            if (dimension == 3) {
+                valid = valid && fields.size() >= 5 && toDouble(fields[4], z);
+            }
+            if (!valid) {
+                reportError("Z88: Invalid node in line " + std::to_string(lno + 1));
+                setFailed();
+                continue;
+            }
+            data.addNode(id, x, y, z);
+            continue;
+        }
+
+        if ((lno - numNodes - 1) % 2 == 0) {
+            // first element line
+            if (fields.size() < 2 || !toInt(fields[0], elemNo) || !toInt(fields[1], elemType)) {
+                reportError("Z88: Invalid element in line " + std::to_string(lno + 1));
+                setFailed();
+            }
+            continue;
+        }
+
+        // second element line, the nodes
+        const Z88Element* type = nullptr;
+        switch (elemType) {
+            // not supported elements
+            case 8:
+                unsupported("8, torus8", "Rotational elements are not supported at the moment");
+                continue;
+            case 12:
+                unsupported("12, torus12", "Rotational elements are not supported at the moment");
+                continue;
+            case 15:
+                unsupported("15, torus6", "Rotational elements are not supported at the moment");
+                continue;
+            case 19:
+                unsupported("19, platte16", "Not supported at the moment");
+                continue;
+            case 21:
+                // schale16, mixture made from hexa8 and hexa20 (thickness is linear)
+                unsupported("21, schale16", "Not supported at the moment");
+                continue;
+            case 22:
+                // schale12, mixtrue made from prism6 and prism15 (thickness is linear)
+                unsupported("22, schale12", "Not supported at the moment");
+                continue;
+
+            // supported elements
+            default:
+                type = findZ88Element(elemType);
+                break;
+        }
+
+        // unknown elements
+        // some examples have -1 for some teaching reasons to show some other stuff
+        if (!type) {
+            reportError("Unknown element");
+            setFailed();
+            continue;
+        }
+
+        int count = static_cast<int>(type->order.size());
+        bool valid = fields.size() >= type->order.size();
+        for (int i = 0; valid && i < count; i++) {
+            valid = toInt(fields[i], nodes[i]);
+        }
+        if (!valid) {
+            reportError("Z88: Invalid element in line " + std::to_string(lno + 1));
+            setFailed();
+            continue;
+        }
+
+        for (int i = 0; i < count; i++) {
+            ordered[i] = nodes[type->order[i]];
+        }
+        data.addElement(elemNo, type->dim, ordered, count);
+    }
+}
@@ -0,0 +1,205 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef Fem_FemMeshReader_H
+#define Fem_FemMeshReader_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Mod/Fem/FemGlobal.h>
+
+
+class SMESHDS_Mesh;
+
+namespace Fem
+{
+
+/** Nodes and elements of a mesh in compact arrays.
+ * The mesh readers fill the arrays, possibly in several threads, and build the SMESH mesh from
+ * them in one go.
+ */
+class FemExport FemMeshData
+{
+public:
+    void addNode(int id, double x, double y, double z);
+    /// adds an edge (dim 1), face (dim 2) or volume (dim 3), the nodes are in SMESH order
+    void addElement(int id, int dim, const int* nodes, int count);
+    /// appends the nodes and elements of \a data
+    void append(FemMeshData&& data);
+    void clear();
+
+    std::size_t countNodes() const
+    {
+        return nodeIds.size();
+    }
+    std::size_t countElements() const
+    {
+        return elementIds.size();
+    }
+
+    /// replaces the content of \a meshds with the nodes and elements
+    void build(SMESHDS_Mesh* meshds) const;
+
+private:
+    std::vector<int> nodeIds;
+    // x, y, z of each node
+    std::vector<double> coords;
+    std::vector<int> elementIds;
+    std::vector<unsigned char> elementDims;
+    // start of the nodes of each element in elementNodes
+    std::vector<std::size_t> elementOffsets;
+    std::vector<int> elementNodes;
+};
+
+/** Base class of the readers of text mesh files.
+ * The file is read in blocks of limited size. The lines of a block are scanned in file order to
+ * find where records start and to track the state a record depends on, e.g. the section of the
+ * file. The block is then split at record starts into chunks that are parsed in parallel.
+ */
+class FemExport FemMeshReader
+{
+public:
+    /// the state at the start of a line
+    struct Context
+    {
+        // zero based line number in the file
+        long line {0};
+        int state {0};
+        // state bits that hold for the rest of the file
+        int flags {0};
+        std::string section;
+    };
+
+    virtual ~FemMeshReader() = default;
+
+    /// reads \a fileName and appends its nodes and elements to \a data
+    void read(const std::string& fileName, FemMeshData& data);
+    /** Sets the size of the blocks the file is read in and the size below which a block is not
+     * split into more chunks. The defaults are meant for large files, the tests use small sizes
+     * to read small files in several blocks and chunks.
+     */
+    void setBlockSize(std::size_t block, std::size_t minChunk);
+
+    using RangeFunction =
+        std::function<void(std::size_t begin, std::size_t end, std::size_t index)>;
+    /// calls \a func for ranges of [0, count) in parallel, the ranges are passed with their index
+    static void parallel(std::size_t count, const RangeFunction& func);
+    static std::size_t countThreads();
+
+protected:
+    /** Called for each line in file order. Returns true if a chunk may start at the line and
+     * updates \a context for the next line.
+     */
+    virtual bool scanLine(const char* begin, const char* end, Context& context) = 0;
+    /// parses the lines in [begin, end), called in parallel for different chunks
+    virtual void
+    parse(const char* begin, const char* end, Context context, FemMeshData& data) const = 0;
+    /** The file included by a line whose content is read at this place, empty if there is none.
+     * A relative path is searched in the directory of the including file.
+     */
+    virtual std::string includedFile(const char* begin, const char* end) const;
+
+    /// reports an error, thread-safe. The errors are printed once after reading.
+    void reportError(const std::string& msg) const;
+    /// true if the reading should stop, e.g. because of an unsupported element
+    bool isFailed() const
+    {
+        return failed;
+    }
+    void setFailed() const
+    {
+        failed = true;
+    }
+
+private:
+    using Chunks = std::vector<std::pair<const char*, Context>>;
+    void readFile(const std::string& fileName, Context& context, FemMeshData& data);
+    void parseChunks(const Chunks& chunks, const char* end, FemMeshData& data) const;
+
+private:
+    // the size of the blocks a file is read in
+    std::size_t blockSize {64 * 1024 * 1024};
+    // chunks are not made smaller than this, smaller ones are not worth a thread
+    std::size_t minChunkSize {1024 * 1024};
+    mutable std::mutex mutex;
+    mutable std::set<std::string> errors;
+    mutable std::atomic<bool> failed {false};
+};
+
+/// Nastran bulk data files (bdf)
+class FemExport FemMeshNastranReader: public FemMeshReader
+{
+protected:
+    bool scanLine(const char* begin, const char* end, Context& context) override;
+    void
+    parse(const char* begin, const char* end, Context context, FemMeshData& data) const override;
+};
+
+/// NASTRAN-95 input files
+class FemExport FemMeshNastran95Reader: public FemMeshReader
+{
+protected:
+    bool scanLine(const char* begin, const char* end, Context& context) override;
+    void
+    parse(const char* begin, const char* end, Context context, FemMeshData& data) const override;
+};
+
+/// Abaqus/CalculiX input files (inp), only the mesh of the model definition is read
+class FemExport FemMeshAbaqusReader: public FemMeshReader
+{
+protected:
+    bool scanLine(const char* begin, const char* end, Context& context) override;
+    void
+    parse(const char* begin, const char* end, Context context, FemMeshData& data) const override;
+    std::string includedFile(const char* begin, const char* end) const override;
+
+private:
+    // reused by scanLine()
+    std::vector<std::string_view> scanFields;
+    std::vector<int> scanNodes;
+};
+
+/// Z88 mesh files (z88i1.txt or z88structure.txt)
+class FemExport FemMeshZ88Reader: public FemMeshReader
+{
+protected:
+    bool scanLine(const char* begin, const char* end, Context& context) override;
+    void
+    parse(const char* begin, const char* end, Context context, FemMeshData& data) const override;
+
+private:
+    int dimension {3};
+    long numNodes {0};
+    long numElements {0};
+};
+
+}  // namespace Fem
+
+
+#endif  // Fem_FemMeshReader_H
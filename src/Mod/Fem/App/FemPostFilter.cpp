@@ -114,6 +114,24 @@ vtkDataObject* FemPostFilter::getInputData()
     return nullptr;
 }
 
+void FemPostFilter::onChanged(const Property* prop)
+{
+    // the outputs the pipeline keeps for its frames are outdated if a filter setting changes
+    if (prop != &Data && !(prop->getType() & Prop_Output) && !prop->testStatus(Property::Output)
+        && !isRestoring() && !isRecomputing() && getDocument()) {
+        std::vector<App::DocumentObject*> objs =
+            getDocument()->getObjectsOfType(FemPostPipeline::getClassTypeId());
+        for (auto it : objs) {
+            auto pipeline = static_cast<FemPostPipeline*>(it);
+            if (pipeline->holdsPostObject(this)) {
+                pipeline->clearFrameOutputs();
+            }
+        }
+    }
+
+    Fem::FemPostObject::onChanged(prop);
+}
+
 // ***************************************************************************
 // in the following, the different filters sorted alphabetically
 // ***************************************************************************
@@ -241,6 +259,9 @@ void FemPostDataAlongLineFilter::onChanged(const Property* prop)
     else if (prop == &PlotDataComponent) {
         GetAxisData();
     }
+    else if (prop == &Data) {
+        GetAxisData();
+    }
 
     Fem::FemPostFilter::onChanged(prop);
 }
@@ -260,7 +281,8 @@ void FemPostDataAlongLineFilter::GetAxisData()
     std::vector<double> coords;
     std::vector<double> values;
 
-    vtkSmartPointer<vtkDataObject> data = m_probe->GetOutputDataObject(0);
+    // the data of a result frame is set without executing the probe
+    vtkSmartPointer<vtkDataObject> data = Data.getValue();
     vtkDataSet* dset = vtkDataSet::SafeDownCast(data);
     if (!dset) {
         return;
@@ -394,7 +416,8 @@ void FemPostDataAtPointFilter::GetPointData()
 {
     std::vector<double> values;
 
-    vtkSmartPointer<vtkDataObject> data = m_probe->GetOutputDataObject(0);
+    // the data of a result frame is set without executing the probe
+    vtkSmartPointer<vtkDataObject> data = Data.getValue();
     vtkDataSet* dset = vtkDataSet::SafeDownCast(data);
     if (!dset) {
         return;
@@ -60,6 +60,7 @@ public:
 
 protected:
     vtkDataObject* getInputData();
+    void onChanged(const App::Property* prop) override;
 
     // pipeline handling for derived filter
     struct FilterPipeline
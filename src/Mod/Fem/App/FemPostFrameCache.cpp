@@ -0,0 +1,260 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#endif
+
+#include "FemPostFrameCache.h"
+
+
+using namespace Fem;
+
+FemPostFrameCache::FemPostFrameCache()
+    : budget(1024 * 1024)
+{}
+
+FemPostFrameCache::~FemPostFrameCache()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    requested.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void FemPostFrameCache::setFrames(int count, Loader load)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    loader = std::move(load);
+    numFrames = count;
+    generation++;
+    requests.clear();
+    entries.clear();
+    usage.clear();
+    used = 0;
+    current = -1;
+    loaded.notify_all();
+}
+
+void FemPostFrameCache::clear()
+{
+    setFrames(0, Loader());
+}
+
+int FemPostFrameCache::count() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return numFrames;
+}
+
+void FemPostFrameCache::setBudget(std::size_t kb)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    budget = kb;
+    trim();
+}
+
+void FemPostFrameCache::setPrefetch(int count)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    prefetch = std::max(0, count);
+}
+
+std::size_t FemPostFrameCache::memSize(vtkDataObject* data)
+{
+    return data ? data->GetActualMemorySize() : 0;
+}
+
+std::map<int, FemPostFrameCache::Entry>::iterator
+FemPostFrameCache::insert(int frame, const vtkSmartPointer<vtkDataObject>& data)
+{
+    auto it = entries.find(frame);
+    if (it != entries.end()) {
+        return it;
+    }
+
+    Entry entry;
+    entry.data = data;
+    entry.size = memSize(data);
+    usage.push_front(frame);
+    entry.use = usage.begin();
+    used += entry.size;
+    return entries.emplace(frame, std::move(entry)).first;
+}
+
+void FemPostFrameCache::trim()
+{
+    // the current frame is always kept, even if it alone exceeds the budget
+    auto it = usage.end();
+    while (used > budget && it != usage.begin()) {
+        --it;
+        if (*it == current) {
+            continue;
+        }
+        auto entry = entries.find(*it);
+        used -= entry->second.size;
+        entries.erase(entry);
+        it = usage.erase(it);
+    }
+}
+
+vtkSmartPointer<vtkDataObject> FemPostFrameCache::getData(int frame)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (frame < 0 || frame >= numFrames) {
+        return {};
+    }
+
+    current = frame;
+    auto it = entries.find(frame);
+    if (it == entries.end()) {
+        // wait if the background thread is already loading the frame
+        unsigned long gen = generation;
+        loaded.wait(lock, [&] {
+            return gen != generation || loading.find(frame) == loading.end();
+        });
+        if (gen != generation) {
+            return {};
+        }
+
+        it = entries.find(frame);
+        if (it == entries.end()) {
+            Loader load = loader;
+            lock.unlock();
+            vtkSmartPointer<vtkDataObject> data = load(frame);
+            lock.lock();
+            if (gen != generation) {
+                return data;
+            }
+            it = insert(frame, data);
+        }
+    }
+
+    usage.splice(usage.begin(), usage, it->second.use);
+    vtkSmartPointer<vtkDataObject> data = it->second.data;
+
+    // load the next frames in the background, e.g. when playing an animation
+    requests.clear();
+    for (int i = 1; i <= prefetch && i < numFrames; i++) {
+        int next = (frame + i) % numFrames;
+        if (entries.find(next) == entries.end() && loading.find(next) == loading.end()) {
+            requests.push_back(next);
+        }
+    }
+    if (!requests.empty()) {
+        if (!worker.joinable()) {
+            worker = std::thread(&FemPostFrameCache::run, this);
+        }
+        requested.notify_one();
+    }
+
+    trim();
+    return data;
+}
+
+bool FemPostFrameCache::getOutputs(int frame, Outputs& outputs) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(frame);
+    if (it == entries.end() || it->second.outputs.empty()) {
+        return false;
+    }
+    outputs = it->second.outputs;
+    return true;
+}
+
+void FemPostFrameCache::setOutputs(int frame, const Outputs& outputs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(frame);
+    if (it == entries.end()) {
+        return;
+    }
+
+    Entry& entry = it->second;
+    used -= entry.size;
+    entry.outputs = outputs;
+    entry.size = memSize(entry.data);
+    for (const auto& output : outputs) {
+        entry.size += memSize(output);
+    }
+    used += entry.size;
+    trim();
+}
+
+void FemPostFrameCache::clearOutputs()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& it : entries) {
+        Entry& entry = it.second;
+        used -= entry.size;
+        entry.outputs.clear();
+        entry.size = memSize(entry.data);
+        used += entry.size;
+    }
+}
+
+void FemPostFrameCache::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+        requested.wait(lock, [this] {
+            return stop || !requests.empty();
+        });
+        if (stop) {
+            break;
+        }
+
+        int frame = requests.front();
+        requests.pop_front();
+        if (entries.find(frame) != entries.end() || loading.find(frame) != loading.end()) {
+            continue;
+        }
+
+        loading.insert(frame);
+        Loader load = loader;
+        unsigned long gen = generation;
+        lock.unlock();
+
+        vtkSmartPointer<vtkDataObject> data;
+        try {
+            data = load(frame);
+        }
+        catch (...) {
+            // the frame is loaded again when it is shown and the error is reported then
+        }
+
+        lock.lock();
+        loading.erase(frame);
+        if (gen == generation && data) {
+            insert(frame, data);
+            trim();
+        }
+        loaded.notify_all();
+    }
+}
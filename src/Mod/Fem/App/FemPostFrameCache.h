@@ -0,0 +1,120 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef Fem_FemPostFrameCache_H
+#define Fem_FemPostFrameCache_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <vtkDataObject.h>
+#include <vtkSmartPointer.h>
+
+#include <Mod/Fem/FemGlobal.h>
+
+
+namespace Fem
+{
+
+/** The frames of a time series or of several modes shown by a post-processing pipeline.
+ * The data set of a frame is loaded on demand and the following frames are loaded ahead in a
+ * background thread. The data sets and the filter outputs computed for them are kept in a least
+ * recently used cache limited by a memory budget.
+ */
+class FemExport FemPostFrameCache
+{
+public:
+    /// Loads the data set of a frame, called in the background thread
+    using Loader = std::function<vtkSmartPointer<vtkDataObject>(int)>;
+    using Outputs = std::vector<vtkSmartPointer<vtkDataObject>>;
+
+    FemPostFrameCache();
+    ~FemPostFrameCache();
+
+    /// Replaces the frames, all cached data is dropped
+    void setFrames(int count, Loader loader);
+    void clear();
+    int count() const;
+    /// Sets the memory budget in kB
+    void setBudget(std::size_t kb);
+    /// Sets the number of frames that are loaded ahead
+    void setPrefetch(int count);
+
+    /// Returns the data set of \a frame and starts loading the following frames
+    vtkSmartPointer<vtkDataObject> getData(int frame);
+    /// Gets the filter outputs cached for \a frame
+    bool getOutputs(int frame, Outputs& outputs) const;
+    void setOutputs(int frame, const Outputs& outputs);
+    /// Drops the filter outputs of all frames, e.g. if a filter has changed
+    void clearOutputs();
+
+    FemPostFrameCache(const FemPostFrameCache&) = delete;
+    FemPostFrameCache& operator=(const FemPostFrameCache&) = delete;
+
+private:
+    struct Entry
+    {
+        vtkSmartPointer<vtkDataObject> data;
+        Outputs outputs;
+        std::size_t size {0};
+        std::list<int>::iterator use;
+    };
+
+    void run();
+    std::map<int, Entry>::iterator insert(int frame, const vtkSmartPointer<vtkDataObject>& data);
+    void trim();
+    static std::size_t memSize(vtkDataObject* data);
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable requested;
+    std::condition_variable loaded;
+    std::thread worker;
+    bool stop {false};
+
+    Loader loader;
+    int numFrames {0};
+    // incremented whenever the frames are replaced, loads of older frames are dropped
+    unsigned long generation {0};
+    std::deque<int> requests;
+    std::set<int> loading;
+
+    std::map<int, Entry> entries;
+    // most recently used frame first
+    std::list<int> usage;
+    std::size_t used {0};
+    std::size_t budget;
+    int prefetch {2};
+    int current {-1};
+};
+
+}  // namespace Fem
+
+
+#endif  // Fem_FemPostFrameCache_H
@@ -30,6 +30,8 @@
 #include <vtkRectilinearGrid.h>
 #include <vtkStructuredGrid.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkXMLDataElement.h>
+#include <vtkXMLDataParser.h>
 #include <vtkXMLImageDataReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLPolyDataReader.h>
@@ -38,7 +40,10 @@
 #include <vtkXMLUnstructuredGridReader.h>
 #endif
 
+#include <App/Application.h>
+#include <App/Document.h>
 #include <Base/Console.h>
+#include <Base/Tools.h>
 
 #include "FemMesh.h"
 #include "FemMeshObject.h"
@@ -75,6 +80,38 @@ FemPostPipeline::FemPostPipeline()
                       "In parallel, every filter gets the pipeline source as input.\n"
                       "In custom, every filter keeps its input set by the user.");
     Mode.setEnums(ModeEnums);
+    ADD_PROPERTY_TYPE(Frame,
+                      (0),
+                      "Pipeline",
+                      App::Prop_Output,
+                      "The frame shown, i.e. the time step or the mode of the result frames");
+    ADD_PROPERTY_TYPE(FrameValues,
+                      (),
+                      "Pipeline",
+                      App::PropertyType(App::Prop_ReadOnly | App::Prop_Output),
+                      "The time or the frequency of each frame");
+    ADD_PROPERTY_TYPE(FrameResults,
+                      (nullptr),
+                      "Pipeline",
+                      App::Prop_None,
+                      "The result objects shown as frames");
+    ADD_PROPERTY_TYPE(FrameFile,
+                      (""),
+                      "Pipeline",
+                      App::Prop_None,
+                      "A ParaView data file (pvd) whose data sets are shown as frames");
+    ADD_PROPERTY_TYPE(FrameScale,
+                      (1.0),
+                      "Pipeline",
+                      App::Prop_Hidden,
+                      "The scale applied to the points of the frames");
+
+    auto constraints = new App::PropertyIntegerConstraint::Constraints();
+    constraints->setDeletable(true);
+    constraints->LowerBound = 0;
+    constraints->UpperBound = 0;
+    constraints->StepSize = 1;
+    Frame.setConstraints(constraints);
 }
 
 FemPostPipeline::~FemPostPipeline() = default;
@@ -98,45 +135,71 @@ bool FemPostPipeline::canRead(Base::FileInfo File)
 {
 
     // from FemResult only unstructural mesh is supported in femvtktoools.cpp
-    return File.hasExtension({"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu"});
+    return File.hasExtension({"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu", "pvd"});
 }
 
-void FemPostPipeline::read(Base::FileInfo File)
+vtkSmartPointer<vtkDataObject> FemPostPipeline::readDataFile(const Base::FileInfo& File)
 {
-
-    // checking on the file
-    if (!File.isReadable()) {
-        throw Base::FileException("File to load not existing or not readable", File);
-    }
-
     if (File.hasExtension("vtu")) {
-        readXMLFile<vtkXMLUnstructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLUnstructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("pvtu")) {
-        readXMLFile<vtkXMLPUnstructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLPUnstructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("vtp")) {
-        readXMLFile<vtkXMLPolyDataReader>(File.filePath());
+        return readXMLFile<vtkXMLPolyDataReader>(File.filePath());
     }
     else if (File.hasExtension("vts")) {
-        readXMLFile<vtkXMLStructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLStructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("vtr")) {
-        readXMLFile<vtkXMLRectilinearGridReader>(File.filePath());
+        return readXMLFile<vtkXMLRectilinearGridReader>(File.filePath());
     }
     else if (File.hasExtension("vti")) {
-        readXMLFile<vtkXMLImageDataReader>(File.filePath());
+        return readXMLFile<vtkXMLImageDataReader>(File.filePath());
     }
     else if (File.hasExtension("vtk")) {
-        readXMLFile<vtkDataSetReader>(File.filePath());
+        return readXMLFile<vtkDataSetReader>(File.filePath());
     }
-    else {
-        throw Base::FileException("Unknown extension");
+
+    throw Base::FileException("Unknown extension");
+}
+
+void FemPostPipeline::read(Base::FileInfo File)
+{
+
+    // checking on the file
+    if (!File.isReadable()) {
+        throw Base::FileException("File to load not existing or not readable", File);
+    }
+
+    // a collection of data sets is shown frame by frame
+    if (File.hasExtension("pvd")) {
+        FrameResults.setValues({});
+        FrameScale.setValue(1.0);
+        FrameFile.setValue(File.filePath().c_str());
+        return;
+    }
+
+    vtkSmartPointer<vtkDataObject> data = readDataFile(File);
+    if (getFrameCount() > 0) {
+        // the data set replaces the frames, so none of them is shown
+        Base::FlagToggler<bool> flag(m_showingFrame);
+        FrameResults.setValues({});
+        FrameFile.setValue("");
     }
+    Data.setValue(data);
 }
 
 void FemPostPipeline::scale(double s)
 {
+    // the frames are scaled when they are loaded
+    if (getFrameCount() > 0) {
+        FrameScale.setValue(FrameScale.getValue() * s);
+        setupFrames(true);
+        return;
+    }
+
     Data.scale(s);
 }
 
@@ -186,9 +249,30 @@ void FemPostPipeline::onChanged(const Property* prop)
         };
     }
 
+    if (prop == &Filter || prop == &Mode) {
+        clearFrameOutputs();
+    }
+    else if (prop == &FrameResults || prop == &FrameFile) {
+        if (!isRestoring()) {
+            setupFrames(true);
+        }
+    }
+    else if (prop == &Frame) {
+        if (!isRestoring()) {
+            showFrame(Frame.getValue());
+        }
+    }
+
     App::GeoFeature::onChanged(prop);
 }
 
+void FemPostPipeline::onDocumentRestored()
+{
+    // the restored data is the one of the current frame
+    setupFrames(false);
+    App::GeoFeature::onDocumentRestored();
+}
+
 void FemPostPipeline::recomputeChildren()
 {
     for (const auto& obj : Filter.getValues()) {
@@ -240,9 +324,221 @@ void FemPostPipeline::load(FemResultObject* res)
     // ***************************
     FemVTKTools::exportFreeCADResult(res, grid);
 
+    if (getFrameCount() > 0) {
+        // the data set replaces the frames, so none of them is shown
+        Base::FlagToggler<bool> flag(m_showingFrame);
+        FrameResults.setValues({});
+        FrameFile.setValue("");
+    }
     Data.setValue(grid);
 }
 
+void FemPostPipeline::load(const std::vector<FemResultObject*>& results)
+{
+    if (results.size() == 1) {
+        load(results.front());
+        return;
+    }
+
+    std::vector<App::DocumentObject*> objs;
+    for (auto res : results) {
+        App::DocumentObject* meshObj = res->Mesh.getValue();
+        if (!meshObj || !meshObj->isDerivedFrom(Fem::FemMeshObject::getClassTypeId())) {
+            Base::Console().Log("Result %s has no mesh object.\n", res->getNameInDocument());
+            continue;
+        }
+        objs.push_back(res);
+    }
+
+    FrameFile.setValue("");
+    FrameScale.setValue(1.0);
+    FrameResults.setValues(objs);
+}
+
+int FemPostPipeline::getFrameCount() const
+{
+    return m_frames.count();
+}
+
+void FemPostPipeline::setupFrames(bool show)
+{
+    std::vector<double> values;
+    FemPostFrameCache::Loader loader;
+    double scale = FrameScale.getValue();
+
+    const std::vector<App::DocumentObject*>& results = FrameResults.getValues();
+    if (!results.empty()) {
+        // the results usually share one mesh which is exported only once, the frames reference
+        // its points and cells and only add the result arrays
+        std::map<App::DocumentObject*, vtkSmartPointer<vtkUnstructuredGrid>> grids;
+        std::vector<vtkSmartPointer<vtkUnstructuredGrid>> frameGrids;
+        std::vector<FemVTKTools::ResultColumns> frameColumns;
+        for (auto obj : results) {
+            auto res = dynamic_cast<FemResultObject*>(obj);
+            App::DocumentObject* meshObj = res ? res->Mesh.getValue() : nullptr;
+            if (!meshObj || !meshObj->isDerivedFrom(Fem::FemMeshObject::getClassTypeId())) {
+                continue;
+            }
+
+            vtkSmartPointer<vtkUnstructuredGrid>& grid = grids[meshObj];
+            if (!grid) {
+                const FemMesh& mesh = static_cast<FemMeshObject*>(meshObj)->FemMesh.getValue();
+                grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+                FemVTKTools::exportVTKMesh(&mesh, grid);
+                if (scale != 1.0) {
+                    PropertyPostDataObject::scaleDataObject(grid, scale);
+                }
+            }
+
+            // the time of a transient analysis or the frequency of a mode
+            double value = res->Time.getValue();
+            auto freq = dynamic_cast<App::PropertyFloat*>(
+                res->getPropertyByName("EigenmodeFrequency"));
+            if (freq && freq->getValue() != 0.0) {
+                value = freq->getValue();
+            }
+
+            values.push_back(value);
+            frameGrids.push_back(grid);
+            frameColumns.push_back(FemVTKTools::getFreeCADResultColumns(res));
+        }
+
+        loader = [frameGrids, frameColumns](int frame) -> vtkSmartPointer<vtkDataObject> {
+            vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+            grid->ShallowCopy(frameGrids[frame]);
+            FemVTKTools::exportFreeCADResultColumns(frameColumns[frame], grid);
+            return grid;
+        };
+    }
+    else if (strlen(FrameFile.getValue()) > 0) {
+        Base::FileInfo file(FrameFile.getValue());
+        vtkSmartPointer<vtkXMLDataParser> parser = vtkSmartPointer<vtkXMLDataParser>::New();
+        parser->SetFileName(file.filePath().c_str());
+        vtkXMLDataElement* root = file.isReadable() && parser->Parse() ? parser->GetRootElement()
+                                                                       : nullptr;
+        vtkXMLDataElement* collection =
+            root ? root->FindNestedElementWithName("Collection") : nullptr;
+        if (!collection) {
+            Base::Console().Error("Cannot read data set collection '%s'\n",
+                                  file.filePath().c_str());
+        }
+
+        std::vector<std::string> files;
+        for (int i = 0; collection && i < collection->GetNumberOfNestedElements(); i++) {
+            vtkXMLDataElement* dataSet = collection->GetNestedElement(i);
+            const char* name = dataSet->GetAttribute("file");
+            const char* part = dataSet->GetAttribute("part");
+            if (strcmp(dataSet->GetName(), "DataSet") != 0 || !name
+                || (part && strcmp(part, "0") != 0)) {
+                continue;
+            }
+
+            // the data set files are usually relative to the collection file
+            Base::FileInfo relative(file.dirPath() + "/" + name);
+            std::string path = relative.exists() ? relative.filePath() : std::string(name);
+
+            double time = 0.0;
+            dataSet->GetScalarAttribute("timestep", time);
+            values.push_back(time);
+            files.push_back(path);
+        }
+
+        loader = [files, scale](int frame) {
+            vtkSmartPointer<vtkDataObject> data = readDataFile(Base::FileInfo(files[frame]));
+            if (scale != 1.0) {
+                PropertyPostDataObject::scaleDataObject(data, scale);
+            }
+            return data;
+        };
+    }
+
+    // the budget is given in MB
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/General");
+    long budget = hGrp->GetInt("PostFrameCacheSize", 1024);
+    m_frames.setBudget(static_cast<std::size_t>(std::max(0L, budget)) * 1024);
+
+    int count = static_cast<int>(values.size());
+    m_frames.setFrames(count, loader);
+    FrameValues.setValues(values);
+
+    auto constraints = new App::PropertyIntegerConstraint::Constraints();
+    constraints->setDeletable(true);
+    constraints->LowerBound = 0;
+    constraints->UpperBound = std::max(0, count - 1);
+    constraints->StepSize = 1;
+    Frame.setConstraints(constraints);
+
+    if (Frame.getValue() > constraints->UpperBound) {
+        // the frame is shown below
+        Base::FlagToggler<bool> flag(m_showingFrame);
+        Frame.setValue(constraints->UpperBound);
+    }
+
+    if (show && count > 0) {
+        showFrame(Frame.getValue());
+    }
+}
+
+void FemPostPipeline::showFrame(int frame)
+{
+    if (frame < 0 || frame >= getFrameCount() || m_showingFrame) {
+        return;
+    }
+
+    vtkSmartPointer<vtkDataObject> data = m_frames.getData(frame);
+    if (!data) {
+        Base::Console().Error("Cannot load frame %d of %s\n", frame, getFullName().c_str());
+        return;
+    }
+
+    Base::FlagToggler<bool> flag(m_showingFrame);
+
+    // showing a frame does not change the document, so the objects are only marked as touched
+    // if they were before
+    std::vector<App::DocumentObject*> filters = Filter.getValues();
+    std::vector<bool> touched;
+    touched.push_back(isTouched());
+    for (auto obj : filters) {
+        touched.push_back(obj->isTouched());
+    }
+
+    Data.setSharedValue(data);
+
+    FemPostFrameCache::Outputs outputs;
+    if (m_frames.getOutputs(frame, outputs) && outputs.size() == filters.size()) {
+        for (std::size_t i = 0; i < filters.size(); i++) {
+            static_cast<FemPostObject*>(filters[i])->Data.setSharedValue(outputs[i]);
+        }
+    }
+    else {
+        // the filters are ordered by their dependencies, the output of each filter is a new data
+        // object so it can be kept for the frame
+        outputs.clear();
+        for (auto obj : filters) {
+            obj->recomputeFeature();
+            outputs.push_back(static_cast<FemPostObject*>(obj)->Data.getValue());
+        }
+        m_frames.setOutputs(frame, outputs);
+    }
+
+    if (!touched[0]) {
+        purgeTouched();
+    }
+    for (std::size_t i = 0; i < filters.size(); i++) {
+        if (!touched[i + 1]) {
+            filters[i]->purgeTouched();
+        }
+    }
+}
+
+void FemPostPipeline::clearFrameOutputs()
+{
+    if (!m_showingFrame) {
+        m_frames.clearOutputs();
+    }
+}
+
 PyObject* FemPostPipeline::getPyObject()
 {
     if (PythonObject.is(Py::_None())) {
@@ -23,6 +23,9 @@
 #ifndef Fem_FemPostPipeline_H
 #define Fem_FemPostPipeline_H
 
+#include <App/PropertyFile.h>
+
+#include "FemPostFrameCache.h"
 #include "FemPostFunction.h"
 #include "FemPostObject.h"
 #include "FemResultObject.h"
@@ -45,6 +48,11 @@ public:
     App::PropertyLinkList Filter;
     App::PropertyLink Functions;
     App::PropertyEnumeration Mode;
+    App::PropertyIntegerConstraint Frame;
+    App::PropertyFloatList FrameValues;
+    App::PropertyLinkList FrameResults;
+    App::PropertyFile FrameFile;
+    App::PropertyFloat FrameScale;
 
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
@@ -62,6 +70,14 @@ public:
 
     // load from results
     void load(FemResultObject* res);
+    // load several results as frames, e.g. the time steps or the eigenmodes of an analysis
+    void load(const std::vector<FemResultObject*>& results);
+
+    // frame handling
+    int getFrameCount() const;
+    void showFrame(int frame);
+    // drops the filter outputs cached for the frames, must be called if a filter changes
+    void clearFrameOutputs();
 
     // Pipeline handling
     void recomputeChildren();
@@ -70,19 +86,27 @@ public:
 
 protected:
     void onChanged(const App::Property* prop) override;
+    void onDocumentRestored() override;
 
 private:
     static const char* ModeEnums[];
 
+    void setupFrames(bool show);
+    static vtkSmartPointer<vtkDataObject> readDataFile(const Base::FileInfo& file);
+
     template<class TReader>
-    void readXMLFile(std::string file)
+    static vtkSmartPointer<vtkDataObject> readXMLFile(std::string file)
     {
 
         vtkSmartPointer<TReader> reader = vtkSmartPointer<TReader>::New();
         reader->SetFileName(file.c_str());
         reader->Update();
-        Data.setValue(reader->GetOutput());
+        return reader->GetOutput();
     }
+
+private:
+    FemPostFrameCache m_frames;
+    bool m_showingFrame {false};
 };
 
 }  // namespace Fem
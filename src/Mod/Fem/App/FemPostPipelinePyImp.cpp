@@ -66,17 +66,46 @@ PyObject* FemPostPipelinePy::scale(PyObject* args)
 PyObject* FemPostPipelinePy::load(PyObject* args)
 {
     PyObject* py;
-    if (!PyArg_ParseTuple(args, "O!", &(App::DocumentObjectPy::Type), &py)) {
+    if (!PyArg_ParseTuple(args, "O", &py)) {
         return nullptr;
     }
 
-    App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>(py)->getDocumentObjectPtr();
-    if (!obj->isDerivedFrom<FemResultObject>()) {
-        PyErr_SetString(PyExc_TypeError, "object is not a result object");
+    // a single result or a sequence of results shown as frames
+    std::vector<FemResultObject*> results;
+    if (PyObject_TypeCheck(py, &(App::DocumentObjectPy::Type))) {
+        App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>(py)->getDocumentObjectPtr();
+        if (!obj->isDerivedFrom<FemResultObject>()) {
+            PyErr_SetString(PyExc_TypeError, "object is not a result object");
+            return nullptr;
+        }
+        results.push_back(static_cast<FemResultObject*>(obj));
+    }
+    else if (PySequence_Check(py)) {
+        Py::Sequence list(py);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* item = (*it).ptr();
+            App::DocumentObject* obj = nullptr;
+            if (PyObject_TypeCheck(item, &(App::DocumentObjectPy::Type))) {
+                obj = static_cast<App::DocumentObjectPy*>(item)->getDocumentObjectPtr();
+            }
+            if (!obj || !obj->isDerivedFrom<FemResultObject>()) {
+                PyErr_SetString(PyExc_TypeError, "object is not a result object");
+                return nullptr;
+            }
+            results.push_back(static_cast<FemResultObject*>(obj));
+        }
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "expected a result object or a sequence of them");
+        return nullptr;
+    }
+
+    if (results.empty()) {
+        PyErr_SetString(PyExc_ValueError, "no result object given");
         return nullptr;
     }
 
-    getFemPostPipelinePtr()->load(static_cast<FemResultObject*>(obj));
+    getFemPostPipelinePtr()->load(results);
     Py_Return;
 }
 
@@ -25,10 +25,14 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -38,6 +42,7 @@
 #include <vtkDataSetReader.h>
 #include <vtkDataSetWriter.h>
 #include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
 #include <vtkHexahedron.h>
 #include <vtkIdList.h>
 #include <vtkLine.h>
@@ -55,6 +60,7 @@
 #include <vtkTriangle.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersionMacros.h>
 #include <vtkWedge.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
@@ -70,8 +76,10 @@
 #include <Base/Type.h>
 
 #include "FemAnalysis.h"
+#include "FemMeshReader.h"
 #include "FemResultObject.h"
 #include "FemVTKTools.h"
+#include "PropertyResultArray.h"
 
 
 namespace Fem
@@ -122,27 +130,6 @@ void fillVtkArray(vtkSmartPointer<vtkCellArray>& elemArray, std::vector<int>& ty
     types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
 }
 
-// Helper function to fill SMDS_Mesh elements ID from vtk cell
-void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
-{
-    VTKCellType cellType = static_cast<VTKCellType>(cell->GetCellType());
-    const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(cellType);
-    vtkIdType* vtkIds = cell->GetPointIds()->GetPointer(0);
-    ids.clear();
-    int nbPoints = cell->GetNumberOfPoints();
-    ids.resize(nbPoints);
-    if (!order.empty()) {
-        for (int i = 0; i < nbPoints; ++i) {
-            ids[i] = vtkIds[order[i]] + 1;
-        }
-    }
-    else {
-        for (int i = 0; i < nbPoints; ++i) {
-            ids[i] = vtkIds[i] + 1;
-        }
-    }
-}
-
 }  // namespace
 
 
@@ -153,149 +140,94 @@ void FemVTKTools::importVTKMesh(vtkSmartPointer<vtkDataSet> dataset, FemMesh* me
     Base::Console().Log("%d nodes/points and %d cells/elements found!\n", nPoints, nCells);
     Base::Console().Log("Build SMESH mesh out of the vtk mesh data.\n", nPoints, nCells);
 
-    // Now fill the SMESH datastructure
-    SMESH_Mesh* smesh = mesh->getSMesh();
-    SMESHDS_Mesh* meshds = smesh->GetMeshDS();
-    meshds->ClearMesh();
-
-    for (vtkIdType i = 0; i < nPoints; i++) {
-        double* p = dataset->GetPoint(i);
-        meshds->AddNodeWithID(p[0] * scale, p[1] * scale, p[2] * scale, i + 1);
+    // The cell access of vtkDataSet and the node order tables of SMESH are thread-safe once they
+    // have been used from a single thread
+    vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+    if (nCells > 0) {
+        dataset->GetCellType(0);
+        dataset->GetCellPoints(0, pointIds);
     }
+    SMDS_MeshCell::fromVtkOrder(VTK_TETRA);
+
+    // convert the points and cells in parallel, SMESH itself is filled afterwards
+    const std::size_t numPoints = static_cast<std::size_t>(nPoints);
+    const std::size_t numCells = static_cast<std::size_t>(nCells);
+    std::vector<FemMeshData> nodes(FemMeshReader::countThreads());
+    FemMeshReader::parallel(numPoints, [&](std::size_t begin, std::size_t end, std::size_t index) {
+        double p[3];
+        for (std::size_t i = begin; i < end; i++) {
+            dataset->GetPoint(static_cast<vtkIdType>(i), p);
+            nodes[index].addNode(static_cast<int>(i + 1), p[0] * scale, p[1] * scale, p[2] * scale);
+        }
+    });
+
+    std::vector<FemMeshData> cells(FemMeshReader::countThreads());
+    std::atomic<bool> unsupported(false);
+    FemMeshReader::parallel(numCells, [&](std::size_t begin, std::size_t end, std::size_t index) {
+        vtkSmartPointer<vtkIdList> ids = vtkSmartPointer<vtkIdList>::New();
+        int elemNodes[20];
+        for (std::size_t i = begin; i < end; i++) {
+            vtkIdType iCell = static_cast<vtkIdType>(i);
+            int dim = 0;
+            switch (dataset->GetCellType(iCell)) {
+                // 1D edges
+                case VTK_LINE:            // seg2
+                case VTK_QUADRATIC_EDGE:  // seg3
+                    dim = 1;
+                    break;
+                // 2D faces
+                case VTK_TRIANGLE:            // tria3
+                case VTK_QUADRATIC_TRIANGLE:  // tria6
+                case VTK_QUAD:                // quad4
+                case VTK_QUADRATIC_QUAD:      // quad8
+                    dim = 2;
+                    break;
+                // 3D volumes
+                case VTK_TETRA:                 // tetra4
+                case VTK_QUADRATIC_TETRA:       // tetra10
+                case VTK_HEXAHEDRON:            // hexa8
+                case VTK_QUADRATIC_HEXAHEDRON:  // hexa20
+                case VTK_WEDGE:                 // penta6
+                case VTK_QUADRATIC_WEDGE:       // penta15
+                case VTK_PYRAMID:               // pyra5
+                case VTK_QUADRATIC_PYRAMID:     // pyra13
+                    dim = 3;
+                    break;
+                // not handled cases
+                default:
+                    unsupported = true;
+                    continue;
+            }
 
-    for (vtkIdType iCell = 0; iCell < nCells; iCell++) {
-        vtkCell* cell = dataset->GetCell(iCell);
-        std::vector<int> ids;
-        fillMeshElementIds(cell, ids);
-        switch (cell->GetCellType()) {
-            // 1D edges
-            case VTK_LINE:  // seg2
-                meshds->AddEdgeWithID(ids[0], ids[1], iCell + 1);
-                break;
-            case VTK_QUADRATIC_EDGE:  // seg3
-                meshds->AddEdgeWithID(ids[0], ids[1], ids[2], iCell + 1);
-                break;
-            // 2D faces
-            case VTK_TRIANGLE:  // tria3
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], iCell + 1);
-                break;
-            case VTK_QUADRATIC_TRIANGLE:  // tria6
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], iCell + 1);
-                break;
-            case VTK_QUAD:  // quad4
-                meshds->AddFaceWithID(ids[0], ids[1], ids[2], ids[3], iCell + 1);
-                break;
-            case VTK_QUADRATIC_QUAD:  // quad8
-                meshds->AddFaceWithID(ids[0],
-                                      ids[1],
-                                      ids[2],
-                                      ids[3],
-                                      ids[4],
-                                      ids[5],
-                                      ids[6],
-                                      ids[7],
-                                      iCell + 1);
-                break;
-            // 3D volumes
-            case VTK_TETRA:  // tetra4
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], iCell + 1);
-                break;
-            case VTK_QUADRATIC_TETRA:  // tetra10
-                meshds->AddVolumeWithID(ids[0],
-                                        ids[1],
-                                        ids[2],
-                                        ids[3],
-                                        ids[4],
-                                        ids[5],
-                                        ids[6],
-                                        ids[7],
-                                        ids[8],
-                                        ids[9],
-                                        iCell + 1);
-                break;
-            case VTK_HEXAHEDRON:  // hexa8
-                meshds->AddVolumeWithID(ids[0],
-                                        ids[1],
-                                        ids[2],
-                                        ids[3],
-                                        ids[4],
-                                        ids[5],
-                                        ids[6],
-                                        ids[7],
-                                        iCell + 1);
-                break;
-            case VTK_QUADRATIC_HEXAHEDRON:  // hexa20
-                meshds->AddVolumeWithID(ids[0],
-                                        ids[1],
-                                        ids[2],
-                                        ids[3],
-                                        ids[4],
-                                        ids[5],
-                                        ids[6],
-                                        ids[7],
-                                        ids[8],
-                                        ids[9],
-                                        ids[10],
-                                        ids[11],
-                                        ids[12],
-                                        ids[13],
-                                        ids[14],
-                                        ids[15],
-                                        ids[16],
-                                        ids[17],
-                                        ids[18],
-                                        ids[19],
-                                        iCell + 1);
-                break;
-            case VTK_WEDGE:  // penta6
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], iCell + 1);
-                break;
-            case VTK_QUADRATIC_WEDGE:  // penta15
-                meshds->AddVolumeWithID(ids[0],
-                                        ids[1],
-                                        ids[2],
-                                        ids[3],
-                                        ids[4],
-                                        ids[5],
-                                        ids[6],
-                                        ids[7],
-                                        ids[8],
-                                        ids[9],
-                                        ids[10],
-                                        ids[11],
-                                        ids[12],
-                                        ids[13],
-                                        ids[14],
-                                        iCell + 1);
-                break;
-            case VTK_PYRAMID:  // pyra5
-                meshds->AddVolumeWithID(ids[0], ids[1], ids[2], ids[3], ids[4], iCell + 1);
-                break;
-            case VTK_QUADRATIC_PYRAMID:  // pyra13
-                meshds->AddVolumeWithID(ids[0],
-                                        ids[1],
-                                        ids[2],
-                                        ids[3],
-                                        ids[4],
-                                        ids[5],
-                                        ids[6],
-                                        ids[7],
-                                        ids[8],
-                                        ids[9],
-                                        ids[10],
-                                        ids[11],
-                                        ids[12],
-                                        iCell + 1);
-                break;
-
-            // not handled cases
-            default: {
-                Base::Console().Error(
-                    "Only common 1D, 2D and 3D Cells are supported in VTK mesh import\n");
-                break;
+            dataset->GetCellPoints(iCell, ids);
+            VTKCellType cellType = static_cast<VTKCellType>(dataset->GetCellType(iCell));
+            const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(cellType);
+            int count = static_cast<int>(ids->GetNumberOfIds());
+            if (count > 20) {
+                unsupported = true;
+                continue;
             }
+            for (int j = 0; j < count; j++) {
+                elemNodes[j] = static_cast<int>(ids->GetId(order.empty() ? j : order[j])) + 1;
+            }
+            cells[index].addElement(static_cast<int>(iCell + 1), dim, elemNodes, count);
         }
+    });
+
+    if (unsupported) {
+        Base::Console().Error("Only common 1D, 2D and 3D Cells are supported in VTK mesh import\n");
     }
+
+    FemMeshData data;
+    for (auto& it : nodes) {
+        data.append(std::move(it));
+    }
+    for (auto& it : cells) {
+        data.append(std::move(it));
+    }
+
+    // Now fill the SMESH datastructure
+    data.build(mesh->getSMesh()->GetMeshDS());
 }
 
 FemMesh* FemVTKTools::readVTKMesh(const char* filename, FemMesh* mesh)
@@ -771,6 +703,135 @@ std::map<std::string, std::string> _getFreeCADMechResultScalarProperties()
 }
 
 
+// Takes over the values of a VTK array into a result array. Float and double arrays are
+// referenced instead of copied, the VTK array is kept alive as long as the values are used.
+std::shared_ptr<const PropertyResultArray::Values> _takeResultArray(vtkDataArray* array,
+                                                                    vtkIdType nPoints)
+{
+    auto values = std::make_shared<PropertyResultArray::Values>();
+    values->components = array->GetNumberOfComponents();
+    values->tuples = static_cast<std::size_t>(nPoints);
+
+    int type = array->GetDataType();
+    if ((type == VTK_FLOAT || type == VTK_DOUBLE) && array->GetNumberOfTuples() >= nPoints) {
+        values->type = type == VTK_FLOAT ? PropertyResultArray::Float32
+                                         : PropertyResultArray::Float64;
+        values->data = array->GetVoidPointer(0);
+        array->Register(nullptr);
+        values->owner = std::shared_ptr<const void>(array, [](vtkDataArray* ptr) {
+            ptr->UnRegister(nullptr);
+        });
+        return values;
+    }
+
+    // other types are converted to double
+    std::size_t count = values->tuples * values->components;
+    std::shared_ptr<double[]> block(new double[count]());
+    vtkIdType tuples = std::min(nPoints, array->GetNumberOfTuples());
+    for (vtkIdType i = 0; i < tuples; i++) {
+        for (int c = 0; c < values->components; c++) {
+            block[i * values->components + c] = array->GetComponent(i, c);
+        }
+    }
+    values->type = PropertyResultArray::Float64;
+    values->data = block.get();
+    values->owner = block;
+    return values;
+}
+
+#if VTK_MAJOR_VERSION >= 9
+// The result values handed over to VTK without a copy. VTK releases them through a plain
+// function that only gets the data pointer, so the owners are kept here until then.
+std::mutex& _sharedResultMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_multimap<const void*, std::shared_ptr<const void>>& _sharedResults()
+{
+    static std::unordered_multimap<const void*, std::shared_ptr<const void>> owners;
+    return owners;
+}
+
+void _releaseSharedResult(void* data)
+{
+    std::lock_guard<std::mutex> lock(_sharedResultMutex());
+    auto it = _sharedResults().find(data);
+    if (it != _sharedResults().end()) {
+        _sharedResults().erase(it);
+    }
+}
+
+template<class TArray, typename TValue>
+vtkSmartPointer<vtkDataArray> _shareResultArray(const PropertyResultArray::Values& values)
+{
+    {
+        std::lock_guard<std::mutex> lock(_sharedResultMutex());
+        _sharedResults().emplace(values.data, values.owner);
+    }
+    vtkSmartPointer<TArray> data = vtkSmartPointer<TArray>::New();
+    data->SetNumberOfComponents(values.components);
+    data->SetArray(static_cast<TValue*>(const_cast<void*>(values.data)),
+                   static_cast<vtkIdType>(values.tuples * values.components),
+                   0,
+                   TArray::VTK_DATA_ARRAY_USER_DEFINED);
+    data->SetArrayFreeFunction(_releaseSharedResult);
+    return data;
+}
+#endif
+
+// Creates the VTK array for a result array. If the values neither have to be reordered nor
+// scaled they are handed over to VTK without a copy.
+vtkSmartPointer<vtkDataArray>
+_makeResultArray(const std::shared_ptr<const PropertyResultArray::Values>& values,
+                 int dim,
+                 vtkIdType nPoints,
+                 const std::vector<vtkIdType>& pointIds,
+                 bool sameOrder,
+                 double factor)
+{
+    if (!values || values->tuples == 0 || values->components != dim) {
+        return {};
+    }
+
+#if VTK_MAJOR_VERSION >= 9
+    if (sameOrder && factor == 1.0 && values->tuples == static_cast<std::size_t>(nPoints)) {
+        if (values->type == PropertyResultArray::Float32) {
+            return _shareResultArray<vtkFloatArray, float>(*values);
+        }
+        return _shareResultArray<vtkDoubleArray, double>(*values);
+    }
+#else
+    (void)sameOrder;
+#endif
+
+    vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
+    data->SetNumberOfComponents(dim);
+    data->SetNumberOfTuples(nPoints);
+    double* ptr = data->GetPointer(0);
+
+    // we need to set values for the unused points.
+    // TODO: ensure that the result bar does not include the used 0 if it is not
+    // part of the result (e.g. does the result bar show 0 as smallest value?)
+    if (static_cast<std::size_t>(nPoints) != values->tuples) {
+        std::fill(ptr, ptr + nPoints * dim, 0.0);
+    }
+
+    std::size_t count = std::min(values->tuples, pointIds.size());
+    for (std::size_t i = 0; i < count; i++) {
+        vtkIdType id = pointIds[i];
+        if (id < 0 || id >= nPoints) {
+            continue;
+        }
+        for (int c = 0; c < dim; c++) {
+            ptr[id * dim + c] = values->value(i * dim + c) * factor;
+        }
+    }
+    return data;
+}
+
+
 void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                                       App::DocumentObject* result)
 {
@@ -806,9 +867,13 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                       //        FreeCAD only supports dim 3D, I do not know about VTK
         vtkDataArray* vector_field = vtkDataArray::SafeDownCast(pd->GetArray(it.second.c_str()));
         if (vector_field && vector_field->GetNumberOfComponents() == dim) {
-            App::PropertyVectorList* vector_list =
-                static_cast<App::PropertyVectorList*>(result->getPropertyByName(it.first.c_str()));
-            if (vector_list) {
+            App::Property* prop = result->getPropertyByName(it.first.c_str());
+            if (auto array = dynamic_cast<PropertyResultArray*>(prop)) {
+                array->setValues(_takeResultArray(vector_field, nPoints));
+                Base::Console().Log("    A PropertyResultArray has been filled with values: %s\n",
+                                    it.first.c_str());
+            }
+            else if (auto vector_list = dynamic_cast<App::PropertyVectorList*>(prop)) {
                 std::vector<Base::Vector3d> vec(nPoints);
                 for (vtkIdType i = 0; i < nPoints; ++i) {
                     double* p = vector_field->GetTuple(
@@ -837,8 +902,14 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
     for (const auto& scalar : scalars) {
         vtkDataArray* vec = vtkDataArray::SafeDownCast(pd->GetArray(scalar.second.c_str()));
         if (nPoints && vec && vec->GetNumberOfComponents() == 1) {
-            App::PropertyFloatList* field = static_cast<App::PropertyFloatList*>(
-                result->getPropertyByName(scalar.first.c_str()));
+            App::Property* prop = result->getPropertyByName(scalar.first.c_str());
+            if (auto array = dynamic_cast<PropertyResultArray*>(prop)) {
+                array->setValues(_takeResultArray(vec, nPoints));
+                Base::Console().Log("    A PropertyResultArray has been filled with values: %s\n",
+                                    scalar.first.c_str());
+                continue;
+            }
+            App::PropertyFloatList* field = dynamic_cast<App::PropertyFloatList*>(prop);
             if (!field) {
                 Base::Console().Error("static_cast<App::PropertyFloatList*>((result->"
                                       "getPropertyByName(\"%s\")) failed.\n",
@@ -846,17 +917,10 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                 continue;
             }
 
-            double vmin = 1.0e100, vmax = -1.0e100;
             std::vector<double> values(nPoints, 0.0);
-            for (vtkIdType i = 0; i < vec->GetNumberOfTuples(); i++) {
-                double v = *(vec->GetTuple(i));
-                values[i] = v;
-                if (v > vmax) {
-                    vmax = v;
-                }
-                if (v < vmin) {
-                    vmin = v;
-                }
+            vtkIdType count = std::min(nPoints, vec->GetNumberOfTuples());
+            for (vtkIdType i = 0; i < count; i++) {
+                values[i] = vec->GetComponent(i, 0);
             }
             field->setValues(values);
             Base::Console().Log("    A PropertyFloatList has been filled with vales: %s\n",
@@ -875,16 +939,13 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
 }
 
 
-void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
-                                      vtkSmartPointer<vtkDataSet> grid)
+FemVTKTools::ResultColumns FemVTKTools::getFreeCADResultColumns(const App::DocumentObject* result)
 {
-    Base::Console().Log("Start: Create VTK result data from FreeCAD result data.\n");
-
     std::map<std::string, std::string> vectors = _getFreeCADMechResultVectorProperties();
     std::map<std::string, std::string> scalars = _getFreeCADMechResultScalarProperties();
 
+    ResultColumns columns;
     const Fem::FemResultObject* res = static_cast<const Fem::FemResultObject*>(result);
-    const vtkIdType nPoints = grid->GetNumberOfPoints();
 
     // we need the corresponding mesh to get the correct id for the result data
     // (when the freecad smesh mesh has gaps in the points
@@ -893,136 +954,125 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
     App::DocumentObject* meshObj = res->Mesh.getValue();
     if (!meshObj || !meshObj->isDerivedFrom(FemMeshObject::getClassTypeId())) {
         Base::Console().Error("Result object does not correctly link to mesh");
-        return;
+        return columns;
     }
     const SMESH_Mesh* smesh = static_cast<FemMeshObject*>(meshObj)->FemMesh.getValue().getSMesh();
     const SMESHDS_Mesh* meshDS = smesh->GetMeshDS();
 
-    // all result object meshes are in mm therefore for e.g. length outputs like
-    // displacement we must divide by 1000
-    double factor = 1.0;
+    // the result values are ordered like the mesh nodes, collect the vtk point of each node once
+    // for all result lists
+    columns.pointIds.reserve(meshDS->NbNodes());
+    columns.sameOrder = true;
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        const SMDS_MeshNode* node = aNodeIter->next();
+        vtkIdType id = node->GetID() - 1;
+        columns.sameOrder =
+            columns.sameOrder && id == static_cast<vtkIdType>(columns.pointIds.size());
+        columns.pointIds.push_back(id);
+    }
+
+    // the values of the old list properties are copied, the result arrays are shared
+    using Values = PropertyResultArray::Values;
+    auto getValues = [](const App::Property* field) -> std::shared_ptr<const Values> {
+        if (auto array = dynamic_cast<const PropertyResultArray*>(field)) {
+            return array->getValues();
+        }
+        if (auto list = dynamic_cast<const App::PropertyVectorList*>(field)) {
+            return PropertyResultArray::makeValues(list->getValues(), PropertyResultArray::Float64);
+        }
+        if (auto list = dynamic_cast<const App::PropertyFloatList*>(field)) {
+            return PropertyResultArray::makeValues(list->getValues(), PropertyResultArray::Float64);
+        }
+        return {};
+    };
 
     // vectors
     for (const auto& it : vectors) {
-        const int dim =
-            3;  // Fixme, detect dim, but FreeCAD PropertyVectorList ATM only has DIM of 3
-        App::PropertyVectorList* field = nullptr;
-        if (res->getPropertyByName(it.first.c_str())) {
-            field = static_cast<App::PropertyVectorList*>(res->getPropertyByName(it.first.c_str()));
-        }
-        else {
+        App::Property* field = res->getPropertyByName(it.first.c_str());
+        if (!field) {
             Base::Console().Error("    PropertyVectorList not found: %s\n", it.first.c_str());
+            continue;
         }
 
-        if (field && field->getSize() > 0) {
-            const std::vector<Base::Vector3d>& vel = field->getValues();
-            vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
-            data->SetNumberOfComponents(dim);
-            data->SetNumberOfTuples(nPoints);
-            data->SetName(it.second.c_str());
-
-            // we need to set values for the unused points.
-            // TODO: ensure that the result bar does not include the used 0 if it is not
-            // part of the result (e.g. does the result bar show 0 as smallest value?)
-            if (nPoints != field->getSize()) {
-                double tuple[] = {0, 0, 0};
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetTuple(i, tuple);
-                }
-            }
-
-            if (it.first.compare("DisplacementVectors") == 0) {
-                factor = 0.001;  // to get meter
-            }
-            else {
-                factor = 1.0;
-            }
-
-            SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
-            for (const auto& jt : vel) {
-                const SMDS_MeshNode* node = aNodeIter->next();
-                double tuple[] = {jt.x * factor, jt.y * factor, jt.z * factor};
-                data->SetTuple(node->GetID() - 1, tuple);
-            }
-            grid->GetPointData()->AddArray(data);
-            Base::Console().Log(
-                "    The PropertyVectorList %s was exported to VTK vector list: %s\n",
-                it.first.c_str(),
-                it.second.c_str());
-        }
-        else if (field) {
-            Base::Console().Log("    PropertyVectorList NOT exported to vtk: %s size is: %i\n",
-                                it.first.c_str(),
-                                field->getSize());
+        // all result object meshes are in mm therefore for e.g. length outputs like
+        // displacement we must divide by 1000
+        double factor = 1.0;
+        if (it.first.compare("DisplacementVectors") == 0) {
+            factor = 0.001;  // to get meter
         }
+
+        // Fixme, detect dim, but FreeCAD PropertyVectorList ATM only has DIM of 3
+        columns.columns.push_back({it.first, it.second, 3, factor, getValues(field)});
     }
 
     // scalars
     for (const auto& scalar : scalars) {
-        App::PropertyFloatList* field = nullptr;
-        if (res->getPropertyByName(scalar.first.c_str())) {
-            field =
-                static_cast<App::PropertyFloatList*>(res->getPropertyByName(scalar.first.c_str()));
-        }
-        else {
+        App::Property* field = res->getPropertyByName(scalar.first.c_str());
+        if (!field) {
             Base::Console().Error("PropertyFloatList %s not found \n", scalar.first.c_str());
+            continue;
         }
 
-        if (field && field->getSize() > 0) {
-            const std::vector<double>& vec = field->getValues();
-            vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
-            data->SetNumberOfValues(nPoints);
-            data->SetName(scalar.second.c_str());
-
-            // we need to set values for the unused points.
-            // TODO: ensure that the result bar does not include the used 0 if it is not part
-            // of the result (e.g. does the result bar show 0 as smallest value?)
-            if (nPoints != field->getSize()) {
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetValue(i, 0);
-                }
-            }
+        double factor = 1.0;
+        if ((scalar.first.compare("MaxShear") == 0)
+            || (scalar.first.compare("NodeStressXX") == 0)
+            || (scalar.first.compare("NodeStressXY") == 0)
+            || (scalar.first.compare("NodeStressXZ") == 0)
+            || (scalar.first.compare("NodeStressYY") == 0)
+            || (scalar.first.compare("NodeStressYZ") == 0)
+            || (scalar.first.compare("NodeStressZZ") == 0)
+            || (scalar.first.compare("PrincipalMax") == 0)
+            || (scalar.first.compare("PrincipalMed") == 0)
+            || (scalar.first.compare("PrincipalMin") == 0)
+            || (scalar.first.compare("vonMises") == 0)
+            || (scalar.first.compare("NetworkPressure") == 0)) {
+            factor = 1e6;  // to get Pascal
+        }
+        else if (scalar.first.compare("DisplacementLengths") == 0) {
+            factor = 0.001;  // to get meter
+        }
 
-            if ((scalar.first.compare("MaxShear") == 0)
-                || (scalar.first.compare("NodeStressXX") == 0)
-                || (scalar.first.compare("NodeStressXY") == 0)
-                || (scalar.first.compare("NodeStressXZ") == 0)
-                || (scalar.first.compare("NodeStressYY") == 0)
-                || (scalar.first.compare("NodeStressYZ") == 0)
-                || (scalar.first.compare("NodeStressZZ") == 0)
-                || (scalar.first.compare("PrincipalMax") == 0)
-                || (scalar.first.compare("PrincipalMed") == 0)
-                || (scalar.first.compare("PrincipalMin") == 0)
-                || (scalar.first.compare("vonMises") == 0)
-                || (scalar.first.compare("NetworkPressure") == 0)) {
-                factor = 1e6;  // to get Pascal
-            }
-            else if (scalar.first.compare("DisplacementLengths") == 0) {
-                factor = 0.001;  // to get meter
-            }
-            else {
-                factor = 1.0;
-            }
+        columns.columns.push_back({scalar.first, scalar.second, 1, factor, getValues(field)});
+    }
 
-            SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
-            for (double i : vec) {
-                const SMDS_MeshNode* node = aNodeIter->next();
-                // for the MassFlowRate the last vec entries can be a nullptr, thus check this
-                if (node) {
-                    data->SetValue(node->GetID() - 1, i * factor);
-                }
-            }
+    return columns;
+}
 
+void FemVTKTools::exportFreeCADResultColumns(const ResultColumns& columns,
+                                             vtkSmartPointer<vtkDataSet> grid)
+{
+    const vtkIdType nPoints = grid->GetNumberOfPoints();
+    bool sameOrder =
+        columns.sameOrder && static_cast<vtkIdType>(columns.pointIds.size()) == nPoints;
+
+    for (const auto& it : columns.columns) {
+        // for the MassFlowRate the list can be longer than the number of nodes, the
+        // values without a node are skipped
+        vtkSmartPointer<vtkDataArray> data =
+            _makeResultArray(it.values, it.dim, nPoints, columns.pointIds, sameOrder, it.factor);
+        if (data) {
+            data->SetName(it.vtkName.c_str());
             grid->GetPointData()->AddArray(data);
-            Base::Console().Log(
-                "    The PropertyFloatList %s was exported to VTK scalar list: %s\n",
-                scalar.first.c_str(),
-                scalar.second.c_str());
         }
-        else if (field) {
-            Base::Console().Log("    PropertyFloatList NOT exported to vtk: %s size is: %i\n",
-                                scalar.first.c_str(),
-                                field->getSize());
+    }
+}
+
+void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
+                                      vtkSmartPointer<vtkDataSet> grid)
+{
+    Base::Console().Log("Start: Create VTK result data from FreeCAD result data.\n");
+
+    ResultColumns columns = getFreeCADResultColumns(result);
+    exportFreeCADResultColumns(columns, grid);
+    for (const auto& it : columns.columns) {
+        if (it.values && it.values->tuples > 0) {
+            Base::Console().Log("    The result list %s was exported to VTK list: %s\n",
+                                it.name.c_str(),
+                                it.vtkName.c_str());
+        }
+        else {
+            Base::Console().Log("    Result list NOT exported to vtk: %s\n", it.name.c_str());
         }
     }
 
@@ -30,6 +30,7 @@
 #include <App/DocumentObject.h>
 
 #include "FemMeshObject.h"
+#include "PropertyResultArray.h"
 
 
 namespace Fem
@@ -38,6 +39,27 @@ namespace Fem
 class FemExport FemVTKTools
 {
 public:
+    // a result list of a FreeCAD FEM result object
+    struct ResultColumn
+    {
+        std::string name;
+        std::string vtkName;
+        int dim;
+        // unit conversion to the vtk data
+        double factor;
+        std::shared_ptr<const PropertyResultArray::Values> values;
+    };
+
+    // the result lists of a FreeCAD FEM result object, the values are shared and never modified
+    // so they can be exported to vtk later or in another thread
+    struct ResultColumns
+    {
+        // vtk point of each result value
+        std::vector<vtkIdType> pointIds;
+        bool sameOrder {false};
+        std::vector<ResultColumn> columns;
+    };
+
     // extract data from vtkUnstructuredGrid instance and fill a FreeCAD FEM mesh object with that
     // data
     static void importVTKMesh(vtkSmartPointer<vtkDataSet> grid, FemMesh* mesh, float scale = 1.0);
@@ -59,6 +81,13 @@ public:
     static void exportFreeCADResult(const App::DocumentObject* result,
                                     vtkSmartPointer<vtkDataSet> grid);
 
+    // collect the result lists of a FreeCAD FEM result object, must be called in the main thread
+    static ResultColumns getFreeCADResultColumns(const App::DocumentObject* result);
+
+    // fill a vtk data set with the collected result lists
+    static void exportFreeCADResultColumns(const ResultColumns& columns,
+                                           vtkSmartPointer<vtkDataSet> grid);
+
     // FemMesh read from vtkUnstructuredGrid data file
     static FemMesh* readVTKMesh(const char* filename, FemMesh* mesh);
 
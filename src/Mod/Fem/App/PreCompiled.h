@@ -34,11 +34,15 @@
 
 // standard
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cassert>
+#include <cctype>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -46,6 +50,8 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 // Boost
@@ -184,6 +190,8 @@
 #include <vtkUniformGrid.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkWedge.h>
+#include <vtkXMLDataElement.h>
+#include <vtkXMLDataParser.h>
 #include <vtkXMLDataSetWriter.h>
 #include <vtkXMLImageDataReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
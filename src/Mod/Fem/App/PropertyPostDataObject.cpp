@@ -103,6 +103,14 @@ void PropertyPostDataObject::scale(double s)
 {
     if (m_dataObject) {
         aboutToSetValue();
+        // the data set may be shared, see setSharedValue()
+        if (m_dataObject->GetReferenceCount() > 1) {
+            vtkSmartPointer<vtkDataObject> copy = m_dataObject;
+            createDataObjectByExternalType(copy);
+            if (m_dataObject != copy) {
+                m_dataObject->DeepCopy(copy);
+            }
+        }
         scaleDataObject(m_dataObject, s);
         hasSetValue();
     }
@@ -123,6 +131,13 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     hasSetValue();
 }
 
+void PropertyPostDataObject::setSharedValue(const vtkSmartPointer<vtkDataObject>& ds)
+{
+    aboutToSetValue();
+    m_dataObject = ds;
+    hasSetValue();
+}
+
 const vtkSmartPointer<vtkDataObject>& PropertyPostDataObject::getValue() const
 {
     return m_dataObject;
@@ -50,6 +50,8 @@ public:
     void scale(double s);
     /// set the dataset
     void setValue(const vtkSmartPointer<vtkDataObject>&);
+    /// set the dataset without copying it, it must not be modified afterwards
+    void setSharedValue(const vtkSmartPointer<vtkDataObject>&);
     /// get the part shape
     const vtkSmartPointer<vtkDataObject>& getValue() const;
     /// check if we hold a dataset or a dataobject (which would mean a composite data structure)
@@ -80,7 +82,6 @@ public:
     /// Get valid paths for this property; used by auto completer
     void getPaths(std::vector<App::ObjectIdentifier>& paths) const override;
 
-private:
     static void scaleDataObject(vtkDataObject*, double s);
 
 protected:
@@ -0,0 +1,409 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <Python.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#endif
+
+#include <App/Application.h>
+#include <App/PropertyGeo.h>
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/VectorPy.h>
+#include <Base/Writer.h>
+#include <CXX/Objects.hxx>
+
+#include "PropertyResultArray.h"
+
+
+using namespace Fem;
+
+namespace
+{
+// the values are read and written in blocks of this size, this avoids a temporary copy of the
+// whole array and keeps the stream buffers small
+constexpr std::size_t chunkSize = 1 << 20;
+}  // namespace
+
+TYPESYSTEM_SOURCE(Fem::PropertyResultArray, App::Property)
+
+std::size_t PropertyResultArray::Values::byteSize() const
+{
+    std::size_t size = type == Float32 ? sizeof(float) : sizeof(double);
+    return size * components * tuples;
+}
+
+double PropertyResultArray::Values::value(std::size_t index) const
+{
+    if (type == Float32) {
+        return static_cast<const float*>(data)[index];
+    }
+    return static_cast<const double*>(data)[index];
+}
+
+PropertyResultArray::PropertyResultArray()
+    : _values(std::make_shared<Values>())
+{}
+
+PropertyResultArray::~PropertyResultArray() = default;
+
+std::shared_ptr<PropertyResultArray::Values>
+PropertyResultArray::allocate(ValueType type, int components, std::size_t tuples, void*& buffer)
+{
+    auto values = std::make_shared<Values>();
+    values->type = type;
+    values->components = components;
+    values->tuples = tuples;
+
+    std::size_t count = tuples * components;
+    if (type == Float32) {
+        std::shared_ptr<float[]> block(new float[count]);
+        buffer = block.get();
+        values->owner = block;
+    }
+    else {
+        std::shared_ptr<double[]> block(new double[count]);
+        buffer = block.get();
+        values->owner = block;
+    }
+    values->data = buffer;
+    return values;
+}
+
+bool PropertyResultArray::useSinglePrecision() const
+{
+    if (isSinglePrecision()) {
+        return true;
+    }
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/General");
+    return hGrp->GetBool("ResultSinglePrecision", false);
+}
+
+std::shared_ptr<const PropertyResultArray::Values>
+PropertyResultArray::makeValues(const std::vector<double>& values, ValueType type)
+{
+    void* buffer = nullptr;
+    auto block = allocate(type, 1, values.size(), buffer);
+    if (type == Float32) {
+        std::copy(values.begin(), values.end(), static_cast<float*>(buffer));
+    }
+    else {
+        std::copy(values.begin(), values.end(), static_cast<double*>(buffer));
+    }
+    return block;
+}
+
+std::shared_ptr<const PropertyResultArray::Values>
+PropertyResultArray::makeValues(const std::vector<Base::Vector3d>& values, ValueType type)
+{
+    void* buffer = nullptr;
+    auto block = allocate(type, 3, values.size(), buffer);
+    auto fill = [&values](auto* data) {
+        for (const auto& it : values) {
+            *data++ = it.x;
+            *data++ = it.y;
+            *data++ = it.z;
+        }
+    };
+    if (type == Float32) {
+        fill(static_cast<float*>(buffer));
+    }
+    else {
+        fill(static_cast<double*>(buffer));
+    }
+    return block;
+}
+
+void PropertyResultArray::setValues(const std::vector<double>& values)
+{
+    setValues(makeValues(values, useSinglePrecision() ? Float32 : Float64));
+}
+
+void PropertyResultArray::setValues(const std::vector<Base::Vector3d>& values)
+{
+    setValues(makeValues(values, useSinglePrecision() ? Float32 : Float64));
+}
+
+void PropertyResultArray::setValues(const std::shared_ptr<const Values>& values)
+{
+    aboutToSetValue();
+    _values = values ? values : std::make_shared<Values>();
+    hasSetValue();
+}
+
+int PropertyResultArray::getSize() const
+{
+    return static_cast<int>(_values->tuples);
+}
+
+int PropertyResultArray::getComponents() const
+{
+    return _values->components;
+}
+
+double PropertyResultArray::getValue(int tuple, int component) const
+{
+    return _values->value(static_cast<std::size_t>(tuple) * _values->components + component);
+}
+
+std::vector<double> PropertyResultArray::getScalars() const
+{
+    std::vector<double> values(_values->tuples);
+    for (std::size_t i = 0; i < _values->tuples; i++) {
+        values[i] = _values->value(i * _values->components);
+    }
+    return values;
+}
+
+std::vector<Base::Vector3d> PropertyResultArray::getVectors() const
+{
+    std::vector<Base::Vector3d> values(_values->tuples);
+    if (_values->components < 3) {
+        return values;
+    }
+    for (std::size_t i = 0; i < _values->tuples; i++) {
+        std::size_t index = i * _values->components;
+        values[i].Set(_values->value(index),
+                      _values->value(index + 1),
+                      _values->value(index + 2));
+    }
+    return values;
+}
+
+PyObject* PropertyResultArray::getPyObject()
+{
+    int size = getSize();
+    int components = getComponents();
+    PyObject* list = PyList_New(size);
+    for (int i = 0; i < size; i++) {
+        if (components == 1) {
+            PyList_SetItem(list, i, PyFloat_FromDouble(getValue(i)));
+        }
+        else if (components == 3) {
+            Base::Vector3d vec(getValue(i, 0), getValue(i, 1), getValue(i, 2));
+            PyList_SetItem(list, i, new Base::VectorPy(vec));
+        }
+        else {
+            PyObject* tuple = PyTuple_New(components);
+            for (int j = 0; j < components; j++) {
+                PyTuple_SetItem(tuple, j, PyFloat_FromDouble(getValue(i, j)));
+            }
+            PyList_SetItem(list, i, tuple);
+        }
+    }
+    return list;
+}
+
+void PropertyResultArray::setPyObject(PyObject* value)
+{
+    if (!PySequence_Check(value)) {
+        std::string error = std::string("type must be a sequence, not ");
+        error += value->ob_type->tp_name;
+        throw Base::TypeError(error);
+    }
+
+    Py::Sequence list(value);
+    Py_ssize_t size = list.size();
+    if (size == 0) {
+        setValues(std::make_shared<Values>());
+        return;
+    }
+
+    PyObject* first = list[0].ptr();
+    if (PyFloat_Check(first) || PyLong_Check(first)) {
+        std::vector<double> values(size);
+        for (Py_ssize_t i = 0; i < size; i++) {
+            PyObject* item = list[i].ptr();
+            if (PyFloat_Check(item)) {
+                values[i] = PyFloat_AsDouble(item);
+            }
+            else if (PyLong_Check(item)) {
+                values[i] = static_cast<double>(PyLong_AsLong(item));
+            }
+            else {
+                std::string error = std::string("type in list must be float, not ");
+                error += item->ob_type->tp_name;
+                throw Base::TypeError(error);
+            }
+        }
+        setValues(values);
+    }
+    else {
+        std::vector<Base::Vector3d> values(size);
+        App::PropertyVector val;
+        for (Py_ssize_t i = 0; i < size; i++) {
+            val.setPyObject(list[i].ptr());
+            values[i] = val.getValue();
+        }
+        setValues(values);
+    }
+}
+
+void PropertyResultArray::Save(Base::Writer& writer) const
+{
+    writer.Stream() << writer.ind() << "<ResultArray type=\""
+                    << (_values->type == Float32 ? "Float32" : "Float64") << "\" components=\""
+                    << _values->components << "\" count=\"" << _values->tuples << "\"";
+    if (writer.isForceXML()) {
+        // the values are written inline, one element per value, with all digits because not all
+        // writers set the precision of their stream
+        std::ostream& str = writer.Stream();
+        std::streamsize precision = str.precision(std::numeric_limits<double>::max_digits10);
+        str << ">" << std::endl;
+        writer.incInd();
+        std::size_t count = _values->tuples * _values->components;
+        for (std::size_t i = 0; i < count; i++) {
+            str << writer.ind() << "<F v=\"" << _values->value(i) << "\"/>" << std::endl;
+        }
+        writer.decInd();
+        str.precision(precision);
+        writer.Stream() << writer.ind() << "</ResultArray>" << std::endl;
+    }
+    else {
+        writer.Stream() << " file=\""
+                        << (_values->tuples > 0 ? writer.addFile(getName(), this) : "")
+                        << "\"/>" << std::endl;
+    }
+}
+
+void PropertyResultArray::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("ResultArray");
+    _restoreType =
+        strcmp(reader.getAttribute("type", "Float64"), "Float32") == 0 ? Float32 : Float64;
+    _restoreComponents = static_cast<int>(
+        std::max(1L, reader.getAttributeAsInteger("components", "1")));
+
+    if (!reader.hasAttribute("file")) {
+        // the values are inline, as written with forced XML
+        auto tuples = static_cast<std::size_t>(reader.getAttributeAsUnsigned("count"));
+        void* buffer = nullptr;
+        auto block = allocate(_restoreType, _restoreComponents, tuples, buffer);
+        std::size_t count = tuples * _restoreComponents;
+        for (std::size_t i = 0; i < count; i++) {
+            reader.readElement("F");
+            double value = reader.getAttributeAsFloat("v");
+            if (_restoreType == Float32) {
+                static_cast<float*>(buffer)[i] = static_cast<float>(value);
+            }
+            else {
+                static_cast<double*>(buffer)[i] = value;
+            }
+        }
+        reader.readEndElement("ResultArray");
+        setValues(block);
+        return;
+    }
+
+    std::string file(reader.getAttribute("file"));
+    if (!file.empty()) {
+        // initiate a file read
+        reader.addFile(file.c_str(), this);
+    }
+    else {
+        setValues(std::make_shared<Values>());
+    }
+}
+
+void PropertyResultArray::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    uint64_t uCt = _values->tuples;
+    str << uCt;
+
+    // the values are written as they are in memory, i.e. in the little endian byte order of the
+    // supported platforms
+    const char* data = static_cast<const char*>(_values->data);
+    std::size_t size = _values->byteSize();
+    for (std::size_t pos = 0; pos < size; pos += chunkSize) {
+        str.write(data + pos, static_cast<int>(std::min(chunkSize, size - pos)));
+    }
+}
+
+void PropertyResultArray::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint64_t uCt = 0;
+    str >> uCt;
+
+    void* buffer = nullptr;
+    auto block = allocate(_restoreType, _restoreComponents, uCt, buffer);
+    char* data = static_cast<char*>(buffer);
+    std::size_t size = block->byteSize();
+    for (std::size_t pos = 0; pos < size && reader; pos += chunkSize) {
+        reader.read(data + pos, static_cast<std::streamsize>(std::min(chunkSize, size - pos)));
+    }
+    if (!reader) {
+        // Note: Do NOT throw an exception here, the remaining files can still be read
+        Base::Console().Error("Result array file '%s' is truncated\n",
+                              reader.getFileName().c_str());
+        setValues(std::make_shared<Values>());
+        return;
+    }
+    setValues(block);
+}
+
+App::Property* PropertyResultArray::Copy() const
+{
+    PropertyResultArray* prop = new PropertyResultArray();
+    // the values are never modified, so the copy can share them
+    prop->_values = _values;
+    return prop;
+}
+
+void PropertyResultArray::Paste(const App::Property& from)
+{
+    setValues(dynamic_cast<const PropertyResultArray&>(from)._values);
+}
+
+unsigned int PropertyResultArray::getMemSize() const
+{
+    return static_cast<unsigned int>(_values->byteSize());
+}
+
+bool PropertyResultArray::isSame(const App::Property& other) const
+{
+    if (&other == this) {
+        return true;
+    }
+    if (other.getTypeId() != getTypeId()) {
+        return false;
+    }
+    const Values& lhs = *_values;
+    const Values& rhs = *static_cast<const PropertyResultArray&>(other)._values;
+    if (lhs.byteSize() == 0 && rhs.byteSize() == 0) {
+        return true;
+    }
+    if (lhs.data == rhs.data) {
+        return lhs.byteSize() == rhs.byteSize();
+    }
+    return lhs.type == rhs.type && lhs.components == rhs.components && lhs.tuples == rhs.tuples
+        && std::memcmp(lhs.data, rhs.data, lhs.byteSize()) == 0;
+}
@@ -0,0 +1,138 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef Fem_PropertyResultArray_H
+#define Fem_PropertyResultArray_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <App/Property.h>
+#include <Base/Vector3D.h>
+#include <Mod/Fem/FemGlobal.h>
+
+
+namespace Fem
+{
+
+/** Column of result values, e.g. one value or vector per mesh node.
+ * The values are kept in one contiguous block of single or double precision floats. The block is
+ * never modified once it is set, so it is shared by copies of the property (undo/redo) and can be
+ * handed over to VTK or taken from VTK without copying the values.
+ * From Python the property behaves like a float list or a vector list.
+ */
+class FemExport PropertyResultArray: public App::Property
+{
+    TYPESYSTEM_HEADER_WITH_OVERRIDE();
+
+public:
+    enum ValueType
+    {
+        Float32,
+        Float64
+    };
+
+    /// The values, \a data stays valid as long as \a owner is alive
+    struct Values
+    {
+        ValueType type {Float64};
+        int components {1};
+        std::size_t tuples {0};
+        const void* data {nullptr};
+        std::shared_ptr<const void> owner;
+
+        std::size_t byteSize() const;
+        /// value \a index of the flat array, i.e. tuple * components + component
+        double value(std::size_t index) const;
+    };
+
+    PropertyResultArray();
+    ~PropertyResultArray() override;
+
+    /** @name Getter/setter */
+    //@{
+    /// sets scalar values, stored in single precision if isSinglePrecision() or the user
+    /// preference is set
+    void setValues(const std::vector<double>&);
+    /// sets vectors
+    void setValues(const std::vector<Base::Vector3d>&);
+    /// takes over the values without copying them
+    void setValues(const std::shared_ptr<const Values>&);
+    const std::shared_ptr<const Values>& getValues() const
+    {
+        return _values;
+    }
+    /// number of tuples
+    int getSize() const;
+    int getComponents() const;
+    double getValue(int tuple, int component = 0) const;
+    std::vector<double> getScalars() const;
+    std::vector<Base::Vector3d> getVectors() const;
+    /// true if new values are stored in single precision
+    bool useSinglePrecision() const;
+    //@}
+
+    /** @name Creation of values */
+    //@{
+    static std::shared_ptr<const Values> makeValues(const std::vector<double>&, ValueType type);
+    static std::shared_ptr<const Values> makeValues(const std::vector<Base::Vector3d>&,
+                                                    ValueType type);
+    //@}
+
+    /** @name Python interface */
+    //@{
+    PyObject* getPyObject() override;
+    void setPyObject(PyObject* value) override;
+    //@}
+
+    /** @name Save/restore */
+    //@{
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
+    App::Property* Copy() const override;
+    void Paste(const App::Property& from) override;
+    unsigned int getMemSize() const override;
+    bool isSame(const App::Property& other) const override;
+    //@}
+
+private:
+    /// creates an uninitialized block of values to be filled through \a buffer
+    static std::shared_ptr<Values>
+    allocate(ValueType type, int components, std::size_t tuples, void*& buffer);
+
+private:
+    std::shared_ptr<const Values> _values;
+    // the layout read by Restore() and needed by RestoreDocFile()
+    ValueType _restoreType {Float64};
+    int _restoreComponents {1};
+};
+
+}  // namespace Fem
+
+
+#endif  // Fem_PropertyResultArray_H
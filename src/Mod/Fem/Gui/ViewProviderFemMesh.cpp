@@ -40,7 +40,12 @@
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -66,39 +71,37 @@ struct FemFace
     unsigned short Size;
     unsigned short FaceNo;
     bool hide;
-    Base::Vector3d getFirstNodePoint()
-    {
-        return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-    }
 
-    Base::Vector3d set(short size,
-                       const SMDS_MeshElement* element,
-                       unsigned short id,
-                       short faceNo,
-                       const SMDS_MeshNode* n1,
-                       const SMDS_MeshNode* n2,
-                       const SMDS_MeshNode* n3,
-                       const SMDS_MeshNode* n4 = nullptr,
-                       const SMDS_MeshNode* n5 = nullptr,
-                       const SMDS_MeshNode* n6 = nullptr,
-                       const SMDS_MeshNode* n7 = nullptr,
-                       const SMDS_MeshNode* n8 = nullptr);
-
-    bool isSameFace(FemFace& face);
+    void set(short size,
+             const SMDS_MeshElement* element,
+             unsigned short id,
+             short faceNo,
+             const SMDS_MeshNode* n1,
+             const SMDS_MeshNode* n2,
+             const SMDS_MeshNode* n3,
+             const SMDS_MeshNode* n4 = nullptr,
+             const SMDS_MeshNode* n5 = nullptr,
+             const SMDS_MeshNode* n6 = nullptr,
+             const SMDS_MeshNode* n7 = nullptr,
+             const SMDS_MeshNode* n8 = nullptr);
+
+    std::size_t hash() const;
+    bool hasSameNodes(const FemFace& face) const;
+    bool isLess(const FemFace& face) const;
 };
 
-Base::Vector3d FemFace::set(short size,
-                            const SMDS_MeshElement* element,
-                            unsigned short id,
-                            short faceNo,
-                            const SMDS_MeshNode* n1,
-                            const SMDS_MeshNode* n2,
-                            const SMDS_MeshNode* n3,
-                            const SMDS_MeshNode* n4,
-                            const SMDS_MeshNode* n5,
-                            const SMDS_MeshNode* n6,
-                            const SMDS_MeshNode* n7,
-                            const SMDS_MeshNode* n8)
+void FemFace::set(short size,
+                  const SMDS_MeshElement* element,
+                  unsigned short id,
+                  short faceNo,
+                  const SMDS_MeshNode* n1,
+                  const SMDS_MeshNode* n2,
+                  const SMDS_MeshNode* n3,
+                  const SMDS_MeshNode* n4,
+                  const SMDS_MeshNode* n5,
+                  const SMDS_MeshNode* n6,
+                  const SMDS_MeshNode* n7,
+                  const SMDS_MeshNode* n8)
 {
     Nodes[0] = n1;
     Nodes[1] = n2;
@@ -131,35 +134,100 @@ Base::Vector3d FemFace::set(short size,
             }
         }
     }
+}
 
-    return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
+// hash of the sorted nodes, equal faces have equal hashes
+std::size_t FemFace::hash() const
+{
+    std::size_t seed = Size;
+    for (auto node : Nodes) {
+        seed ^= std::hash<const SMDS_MeshNode*>()(node) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
 }
 
-class FemFaceGridItem: public std::vector<FemFace*>
+// the nodes are sorted, so the faces are the same if their nodes are the same
+bool FemFace::hasSameNodes(const FemFace& face) const
 {
-public:
-    // FemFaceGridItem(void){reserve(200);}
-};
+    return Size == face.Size && std::memcmp(Nodes, face.Nodes, sizeof(Nodes)) == 0;
+}
+
+// strict ordering of faces by their sorted nodes, equal faces end up next to each other
+bool FemFace::isLess(const FemFace& face) const
+{
+    if (Size != face.Size) {
+        return Size < face.Size;
+    }
+    return std::lexicographical_compare(std::begin(Nodes),
+                                        std::end(Nodes),
+                                        std::begin(face.Nodes),
+                                        std::end(face.Nodes),
+                                        std::less<const SMDS_MeshNode*>());
+}
 
-bool FemFace::isSameFace(FemFace& face)
+// Hide all faces that are shared by two (or more) elements, i.e. all faces inside the mesh.
+// The faces are distributed into buckets by the hash of their nodes (one radix pass), so equal
+// faces always land in the same bucket. The buckets are independent and are sorted and scanned
+// for equal neighbours in parallel.
+static void hideInnerFaces(std::vector<FemFace>& faces)
 {
-    // the same element can not have the same face
-    if (face.ElementNumber == ElementNumber) {
-        return false;
+    const std::size_t numFaces = faces.size();
+    std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    if (numFaces < 100000) {
+        numThreads = 1;
     }
-    if (face.Size != Size) {
-        return false;
+    const std::size_t numBuckets = numThreads * 64;
+
+    std::vector<std::size_t> bucketOf(numFaces);
+    std::vector<std::size_t> bucketStart(numBuckets + 1, 0);
+    for (std::size_t i = 0; i < numFaces; i++) {
+        bucketOf[i] = faces[i].hash() % numBuckets;
+        bucketStart[bucketOf[i] + 1]++;
     }
-    // if the same face size just compare if the sorted nodes are the same
-    if (Nodes[0] == face.Nodes[0] && Nodes[1] == face.Nodes[1] && Nodes[2] == face.Nodes[2]
-        && Nodes[3] == face.Nodes[3] && Nodes[4] == face.Nodes[4] && Nodes[5] == face.Nodes[5]
-        && Nodes[6] == face.Nodes[6] && Nodes[7] == face.Nodes[7]) {
-        hide = true;
-        face.hide = true;
-        return true;
+    for (std::size_t b = 0; b < numBuckets; b++) {
+        bucketStart[b + 1] += bucketStart[b];
     }
+    std::vector<FemFace*> sorted(numFaces);
+    {
+        std::vector<std::size_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+        for (std::size_t i = 0; i < numFaces; i++) {
+            sorted[fill[bucketOf[i]]++] = &faces[i];
+        }
+    }
+
+    auto processBuckets = [&](std::size_t first) {
+        for (std::size_t b = first; b < numBuckets; b += numThreads) {
+            auto begin = sorted.begin() + bucketStart[b];
+            auto end = sorted.begin() + bucketStart[b + 1];
+            std::sort(begin, end, [](const FemFace* f1, const FemFace* f2) {
+                return f1->isLess(*f2);
+            });
+            for (auto it = begin; it != end;) {
+                auto next = it + 1;
+                bool shared = false;
+                while (next != end && (*it)->hasSameNodes(**next)) {
+                    // the same element can not have the same face
+                    shared = shared || (*next)->ElementNumber != (*it)->ElementNumber;
+                    ++next;
+                }
+                if (shared) {
+                    for (auto face = it; face != next; ++face) {
+                        (*face)->hide = true;
+                    }
+                }
+                it = next;
+            }
+        }
+    };
 
-    return false;
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < numThreads; t++) {
+        threads.emplace_back(processBuckets, t);
+    }
+    processBuckets(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -383,6 +451,8 @@ void ViewProviderFemMesh::updateData(const App::Property* prop)
         ViewProviderFEMMeshBuilder builder;
         resetColorByNodeId();
         resetDisplacementByNodeId();
+        // the mesh has changed, the inner faces have to be searched again
+        vInnerFaces.clear();
         builder.createMesh(prop,
                            pcCoords,
                            pcFaces,
@@ -391,7 +461,8 @@ void ViewProviderFemMesh::updateData(const App::Property* prop)
                            vNodeElementIdx,
                            onlyEdges,
                            ShowInner.getValue(),
-                           MaxFacesShowInner.getValue());
+                           MaxFacesShowInner.getValue(),
+                           &vInnerFaces);
     }
     Gui::ViewProviderGeometryObject::updateData(prop);
 }
@@ -426,7 +497,7 @@ void ViewProviderFemMesh::onChanged(const App::Property* prop)
         }
     }
     else if (prop == &ShowInner) {
-        // recalc mesh with new settings
+        // recalc mesh with new settings, the inner faces of the unchanged mesh are reused
         ViewProviderFEMMeshBuilder builder;
         builder.createMesh(&(static_cast<Fem::FemMeshObject*>(this->pcObject)->FemMesh),
                            pcCoords,
@@ -436,7 +507,8 @@ void ViewProviderFemMesh::onChanged(const App::Property* prop)
                            vNodeElementIdx,
                            onlyEdges,
                            ShowInner.getValue(),
-                           MaxFacesShowInner.getValue());
+                           MaxFacesShowInner.getValue(),
+                           &vInnerFaces);
     }
     else if (prop == &LineWidth) {
         pcDrawStyle->lineWidth = LineWidth.getValue();
@@ -935,7 +1007,8 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                                             std::vector<unsigned long>& vNodeElementIdx,
                                             bool& onlyEdges,
                                             bool ShowInner,
-                                            int MaxFacesShowInner) const
+                                            int MaxFacesShowInner,
+                                            std::vector<bool>* innerFaces) const
 {
 
     const Fem::PropertyFemMesh* mesh = static_cast<const Fem::PropertyFemMesh*>(prop);
@@ -992,8 +1065,6 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     Base::Console().Log("    %f: Start build up %i face helper\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()),
                         facesHelper.size());
-    Base::BoundBox3d BndBox;
-
     int i = 0;
 
     if (ShowFaces) {
@@ -1005,52 +1076,52 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
             switch (num) {
                 case 3:
                     // tria3 face = N1, N2, N3
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2)));
+                    facesHelper[i++].set(3,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2));
                     break;
                 case 4:
                     // quad4 face = N1, N2, N3, N4
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(3)));
+                    facesHelper[i++].set(4,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(3));
                     break;
                 case 6:
                     // tria6 face = N1, N4, N2, N5, N3, N6
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(5)));
+                    facesHelper[i++].set(6,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(5));
                     break;
                 case 8:
                     // quad8 face = N1, N5, N2, N6, N3, N7, N4, N8
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(5),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(6),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(7)));
+                    facesHelper[i++].set(8,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(5),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(6),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(7));
                     break;
                 default:
                     // unknown face type
@@ -1075,34 +1146,34 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N4, N2
                     // face 3 = N2, N4, N3
                     // face 4 = N3, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // pyra5 volume
                 case 5:
@@ -1111,42 +1182,42 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N5, N3
                     // face 4 = N3, N5, N4
                     // face 5 = N4, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // penta6 volume
                 case 6:
@@ -1155,44 +1226,44 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N4, N5, N2
                     // face 4 = N2, N5, N6, N3
                     // face 5 = N3, N6, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // hexa8 volume
                 case 8:
@@ -1202,54 +1273,54 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N6, N7, N3
                     // face 5 = N3, N7, N8, N4
                     // face 6 = N4, N8, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // tetra10 volume
                 case 10:
@@ -1257,46 +1328,46 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N8,  N4, N9,  N2, N5
                     // face 3 = N2, N9,  N4, N10, N3, N6
                     // face 4 = N3, N10, N4, N8,  N1, N7
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6));
                     break;
                 // pyra13 volume
                 case 13:
@@ -1305,58 +1376,58 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N11, N5, N12, N3, N7
                     // face 4 = N3, N12, N5, N13, N4, N8
                     // face 5 = N4, N13, N5, N10, N1, N9
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // penta15 volume
                 case 15:
@@ -1365,62 +1436,62 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N13, N4, N10, N5, N14, N2, N7
                     // face 4 = N2, N14, N5, N11, N6, N15, N3, N8
                     // face 5 = N3, N15, N6, N12, N4, N13, N1, N9
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // hexa20 volume
                 case 20:
@@ -1430,78 +1501,78 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N18, N6, N14, N7, N19, N3, N10
                     // face 5 = N3, N19, N7, N15, N8, N20, N4, N11
                     // face 6 = N4, N20, N8, N16, N5, N17, N1, N12
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(12)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(10)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(11)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(12));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(10));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(11));
                     break;
                 // unknown volume type
                 default:
@@ -1513,97 +1584,36 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     int FaceSize = facesHelper.size();
 
 
-    if (FaceSize < MaxFacesShowInner) {
-        Base::Console().Log("    %f: Start eliminate internal faces SIMPLE\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-
-        // search for double (inside) faces and hide them
-        if (!ShowInner) {
+    // search for double (inside) faces and hide them. Above MaxFacesShowInner faces the inner
+    // faces are always hidden.
+    if (!ShowInner || FaceSize >= MaxFacesShowInner) {
+        if (innerFaces && static_cast<int>(innerFaces->size()) == FaceSize) {
+            Base::Console().Log("    %f: Reuse internal faces\n",
+                                Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
             for (int l = 0; l < FaceSize; l++) {
-                if (!facesHelper[l].hide) {
-                    for (int i = l + 1; i < FaceSize; i++) {
-                        if (facesHelper[l].isSameFace(facesHelper[i])) {
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    else {
-        Base::Console().Log("    %f: Start eliminate internal faces GRID\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-        BndBox.Enlarge(BndBox.CalcDiagonalLength() / 10000.0);
-        // calculate grid properties
-        double edge = pow(FaceSize, 1.0 / 3.0);
-        double edgeL = BndBox.LengthX() + BndBox.LengthY() + BndBox.LengthZ();
-        double gridFactor = 5.0;
-        double size = (edgeL / (3 * edge)) * gridFactor;
-
-        unsigned int NbrX = (unsigned int)(BndBox.LengthX() / size) + 1;
-        unsigned int NbrY = (unsigned int)(BndBox.LengthY() / size) + 1;
-        unsigned int NbrZ = (unsigned int)(BndBox.LengthZ() / size) + 1;
-        Base::Console().Log("      Size:F:%f,  X:%i  ,Y:%i  ,Z:%i\n", gridFactor, NbrX, NbrY, NbrZ);
-
-        double Xmin = BndBox.MinX;
-        double Ymin = BndBox.MinY;
-        double Zmin = BndBox.MinZ;
-        double Xln = BndBox.LengthX() / NbrX;
-        double Yln = BndBox.LengthY() / NbrY;
-        double Zln = BndBox.LengthZ() / NbrZ;
-
-        std::vector<FemFaceGridItem> Grid(NbrX * NbrY * NbrZ);
-
-
-        unsigned int iX = 0;
-        unsigned int iY = 0;
-        unsigned int iZ = 0;
-
-        for (int l = 0; l < FaceSize; l++) {
-            Base::Vector3d point(facesHelper[l].getFirstNodePoint());
-            double x = (point.x - Xmin) / Xln;
-            double y = (point.y - Ymin) / Yln;
-            double z = (point.z - Zmin) / Zln;
-
-            iX = x;
-            iY = y;
-            iZ = z;
-
-            if (iX >= NbrX || iY >= NbrY || iZ >= NbrZ) {
-                Base::Console().Log("      Outof range!\n");
+                facesHelper[l].hide = (*innerFaces)[l];
             }
-
-            Grid[iX + iY * NbrX + iZ * NbrX * NbrY].push_back(&facesHelper[l]);
         }
-
-        unsigned int max = 0, avg = 0;
-        for (const auto& it : Grid) {
-            for (size_t l = 0; l < it.size(); l++) {
-                if (!it[l]->hide) {
-                    for (size_t i = l + 1; i < it.size(); i++) {
-                        if (it[l]->isSameFace(*(it[i]))) {
-                            break;
-                        }
-                    }
+        else {
+            Base::Console().Log("    %f: Start eliminate internal faces\n",
+                                Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
+            hideInnerFaces(facesHelper);
+            if (innerFaces) {
+                innerFaces->resize(FaceSize);
+                for (int l = 0; l < FaceSize; l++) {
+                    (*innerFaces)[l] = facesHelper[l].hide;
                 }
             }
-            if (it.size() > max) {
-                max = it.size();
-            }
-            avg += it.size();
         }
-        avg = avg / Grid.size();
-
-        Base::Console().Log("      VoxelSize: Max:%i ,Average:%i\n", max, avg);
-
-    }  // if( FaceSize < 1000)
+    }
 
 
     Base::Console().Log("    %f: Start build up node map\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // sort out double nodes and build up index map
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    std::unordered_map<const SMDS_MeshNode*, int> mapNodeIndex;
+    mapNodeIndex.reserve(numNodes);
 
     // handling the corner case beams only, means no faces/triangles only nodes and edges
     if (onlyEdges) {
@@ -1638,7 +1648,7 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     // set the point coordinates
     coords->point.setNum(mapNodeIndex.size());
     vNodeElementIdx.resize(mapNodeIndex.size());
-    std::map<const SMDS_MeshNode*, int>::iterator it = mapNodeIndex.begin();
+    auto it = mapNodeIndex.begin();
     SbVec3f* verts = coords->point.startEditing();
     for (int i = 0; it != mapNodeIndex.end(); ++it, i++) {
         verts[i].setValue((float)it->first->X(), (float)it->first->Y(), (float)it->first->Z());
@@ -53,7 +53,8 @@ public:
                     std::vector<unsigned long>&,
                     bool& edgeOnly,
                     bool ShowInner,
-                    int MaxFacesShowInner) const;
+                    int MaxFacesShowInner,
+                    std::vector<bool>* innerFaces = nullptr) const;
 };
 
 class FemGuiExport ViewProviderFemMesh: public Gui::ViewProviderGeometryObject
@@ -165,6 +166,8 @@ protected:
     std::vector<unsigned long> vFaceElementIdx;
     std::vector<unsigned long> vNodeElementIdx;
     std::vector<unsigned long> vHighlightedIdx;
+    /// inner faces of the current mesh, kept to quickly toggle ShowInner
+    std::vector<bool> vInnerFaces;
     std::vector<Base::Vector3d> DisplacementVector;
     double DisplacementFactor;
 
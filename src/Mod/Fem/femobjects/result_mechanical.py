@@ -66,7 +66,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         # https://forum.freecad.org/viewtopic.php?f=18&t=13460&start=10#p108072
         # do not show up in propertyEditor of comboView
         obj.addProperty(
-            "App::PropertyVectorList",
+            "Fem::PropertyResultArray",
             "DisplacementVectors",
             "NodeData",
             "List of displacement vectors",
@@ -74,7 +74,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("DisplacementVectors", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "Peeq",
             "NodeData",
             "List of equivalent plastic strain values",
@@ -82,7 +82,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("Peeq", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "MohrCoulomb",
             "NodeData",
             "List of Mohr Coulomb stress values",
@@ -90,7 +90,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("MohrCoulomb", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "ReinforcementRatio_x",
             "NodeData",
             "Reinforcement ratio x-direction",
@@ -98,7 +98,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("ReinforcementRatio_x", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "ReinforcementRatio_y",
             "NodeData",
             "Reinforcement ratio y-direction",
@@ -106,7 +106,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("ReinforcementRatio_y", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "ReinforcementRatio_z",
             "NodeData",
             "Reinforcement ratio z-direction",
@@ -116,7 +116,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         # these three principal vectors are used only if there is a reinforced mat obj
         # https://forum.freecad.org/viewtopic.php?f=18&t=33106&p=416006#p416006
         obj.addProperty(
-            "App::PropertyVectorList",
+            "Fem::PropertyResultArray",
             "PS1Vector",
             "NodeData",
             "List of 1st Principal Stress Vectors",
@@ -124,7 +124,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("PS1Vector", "LockDynamic")
         obj.addProperty(
-            "App::PropertyVectorList",
+            "Fem::PropertyResultArray",
             "PS2Vector",
             "NodeData",
             "List of 2nd Principal Stress Vectors",
@@ -132,7 +132,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("PS2Vector", "LockDynamic")
         obj.addProperty(
-            "App::PropertyVectorList",
+            "Fem::PropertyResultArray",
             "PS3Vector",
             "NodeData",
             "List of 3rd Principal Stress Vectors",
@@ -142,7 +142,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
 
         # readonly in propertyEditor of comboView
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "DisplacementLengths",
             "NodeData",
             "List of displacement lengths",
@@ -150,21 +150,21 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("DisplacementLengths", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "vonMises",
             "NodeData",
             "List of von Mises equivalent stresses",
             True,
         )
         obj.setPropertyStatus("vonMises", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "PrincipalMax", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "PrincipalMax", "NodeData", "", True)
         obj.setPropertyStatus("PrincipalMax", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "PrincipalMed", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "PrincipalMed", "NodeData", "", True)
         obj.setPropertyStatus("PrincipalMed", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "PrincipalMin", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "PrincipalMin", "NodeData", "", True)
         obj.setPropertyStatus("PrincipalMin", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "MaxShear",
             "NodeData",
             "List of Maximum Shear stress values",
@@ -172,7 +172,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("MaxShear", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "MassFlowRate",
             "NodeData",
             "List of mass flow rate values",
@@ -180,7 +180,7 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("MassFlowRate", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList",
+            "Fem::PropertyResultArray",
             "NetworkPressure",
             "NodeData",
             "List of network pressure values",
@@ -188,43 +188,43 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         )
         obj.setPropertyStatus("NetworkPressure", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList", "UserDefined", "NodeData", "User Defined Results", True
+            "Fem::PropertyResultArray", "UserDefined", "NodeData", "User Defined Results", True
         )
         obj.setPropertyStatus("UserDefined", "LockDynamic")
         obj.addProperty(
-            "App::PropertyFloatList", "Temperature", "NodeData", "Temperature field", True
+            "Fem::PropertyResultArray", "Temperature", "NodeData", "Temperature field", True
         )
         obj.addProperty(
-            "App::PropertyVectorList", "HeatFlux", "NodeData", "List of heat flux vectors", True
+            "Fem::PropertyResultArray", "HeatFlux", "NodeData", "List of heat flux vectors", True
         )
         obj.setPropertyStatus("HeatFlux", "LockDynamic")
 
         obj.setPropertyStatus("Temperature", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressXX", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressXX", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressXX", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressYY", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressYY", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressYY", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressZZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressZZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressZZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressXY", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressXY", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressXY", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressXZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressXZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressXZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStressYZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStressYZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStressYZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainXX", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainXX", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainXX", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainYY", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainYY", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainYY", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainZZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainZZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainZZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainXY", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainXY", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainXY", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainXZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainXZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainXZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "NodeStrainYZ", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "NodeStrainYZ", "NodeData", "", True)
         obj.setPropertyStatus("NodeStrainYZ", "LockDynamic")
-        obj.addProperty("App::PropertyFloatList", "CriticalStrainRatio", "NodeData", "", True)
+        obj.addProperty("Fem::PropertyResultArray", "CriticalStrainRatio", "NodeData", "", True)
         obj.setPropertyStatus("CriticalStrainRatio", "LockDynamic")
 
         # initialize the Stats with the appropriate count of items
@@ -192,6 +192,33 @@ class TestMeshCommon(unittest.TestCase):
             f"Problem in test_writeAbaqus_precision, \n{read_node_line}\n{expected}",
         )
 
+    # ********************************************************************************************
+    def test_read_mesh_files(self):
+        # the C++ readers of inp and z88 files have to give the same mesh as the Python readers
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_elements
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_nodes
+        from feminout.importInpMesh import read as read_inp
+        from feminout.importZ88Mesh import read as read_z88
+
+        fm = Fem.FemMesh()
+        create_nodes(fm)
+        create_elements(fm)
+        tmp_dir = testtools.get_fem_test_tmp_dir("mesh_common_read")
+
+        for file_extension, read_python in (("inp", read_inp), ("z88", read_z88)):
+            mesh_file = join(tmp_dir, "canticcx_tetra10." + file_extension)
+            fm.write(mesh_file)
+
+            mesh_cpp = Fem.read(mesh_file)
+            mesh_python = read_python(mesh_file)
+
+            self.assertEqual(mesh_cpp.NodeCount, fm.NodeCount)
+            self.assertEqual(mesh_cpp.VolumeCount, fm.VolumeCount)
+            self.assertEqual(mesh_cpp.Nodes, mesh_python.Nodes)
+            self.assertEqual(mesh_cpp.VolumeCount, mesh_python.VolumeCount)
+            for vol in mesh_python.Volumes:
+                self.assertEqual(mesh_cpp.getElementNodes(vol), mesh_python.getElementNodes(vol))
+
 
 # ************************************************************************************************
 # ************************************************************************************************
@@ -373,6 +400,33 @@ class TestMeshEleTetra10(unittest.TestCase):
         obj.ViewObject.DisplayMode = "Faces, Wireframe & Nodes"
         """
 
+    # ********************************************************************************************
+    def test_tetra10_bdf(self):
+        # tetra10 element: reading from Nastran mesh file format, there is no Nastran mesh writer
+
+        file_extension = "bdf"
+        testfile = self.base_testfile + file_extension
+
+        femmesh_testfile = Fem.read(testfile)  # read the mesh from test mesh
+
+        self.assertEqual(
+            femmesh_testfile.Nodes,
+            self.expected_nodes["nodes"],
+            "Test reading {} mesh from {} file failed. Nodes are different.\n".format(
+                self.elem, file_extension
+            ),
+        )
+        self.assertEqual(
+            [
+                femmesh_testfile.Volumes[0],
+                femmesh_testfile.getElementNodes(femmesh_testfile.Volumes[0]),
+            ],
+            self.expected_elem["volumes"],
+            "Test reading {} mesh from {} file failed. Volumes are different.\n".format(
+                self.elem, file_extension
+            ),
+        )
+
     # ********************************************************************************************
     def test_tetra10_inp(self):
         # tetra10 element: reading from and writing to inp mesh file format
@@ -191,3 +191,79 @@ class TestResult(unittest.TestCase):
         self.assertEqual(
             disp_abs, expected_dispabs, "Calculated displacement abs are not the expected values."
         )
+
+    # ********************************************************************************************
+    def test_result_array(self):
+        import ObjectsFem
+
+        res = ObjectsFem.makeResultMechanical(self.document)
+        res.Temperature = [1.5, 2, -3.25]
+        res.DisplacementVectors = [FreeCAD.Vector(1, 2, 3), FreeCAD.Vector(-4, 5.5, 6)]
+        self.assertEqual(res.Temperature, [1.5, 2.0, -3.25])
+        self.assertEqual(res.DisplacementVectors[1], FreeCAD.Vector(-4, 5.5, 6))
+
+        # save and load the document
+        res_name = res.Name
+        file_path = join(testtools.get_fem_test_tmp_dir("result_array"), "result_array.FCStd")
+        self.document.saveAs(file_path)
+        FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.openDocument(file_path)
+
+        res = self.document.getObject(res_name)
+        self.assertEqual(res.Temperature, [1.5, 2.0, -3.25])
+        self.assertEqual(len(res.DisplacementVectors), 2)
+        self.assertEqual(res.DisplacementVectors[0], FreeCAD.Vector(1, 2, 3))
+        self.assertEqual(res.Peeq, [])
+
+    # ********************************************************************************************
+    def test_post_frames(self):
+        if "BUILD_FEM_VTK" not in FreeCAD.__cmake__:
+            fcc_print("FEM_VTK post processing is disabled.")
+            return
+
+        import Fem
+        import ObjectsFem
+
+        mesh = Fem.FemMesh()
+        mesh.addNode(0, 0, 0, 1)
+        mesh.addNode(1, 0, 0, 2)
+        mesh.addNode(0, 1, 0, 3)
+        mesh.addNode(0, 0, 1, 4)
+        mesh.addVolume([1, 2, 3, 4])
+        mesh_obj = self.document.addObject("Fem::FemMeshObject", "ResultMesh")
+        mesh_obj.FemMesh = mesh
+
+        results = []
+        for i in range(3):
+            res = ObjectsFem.makeResultMechanical(self.document)
+            res.Mesh = mesh_obj
+            res.Time = 0.5 * i
+            res.Temperature = [i, i + 1, i + 2, i + 3]
+            results.append(res)
+
+        pipeline = self.document.addObject("Fem::FemPostPipeline", "Pipeline")
+        pipeline.load(results)
+        self.assertEqual(len(pipeline.FrameResults), 3)
+        self.assertEqual(pipeline.FrameValues, [0.0, 0.5, 1.0])
+        pipeline.Frame = 2
+        self.assertEqual(pipeline.Frame, 2)
+        # frames are constrained to the loaded ones
+        pipeline.Frame = 5
+        self.assertEqual(pipeline.Frame, 2)
+
+        # the output holds the temperatures of the shown frame, at the center of the
+        # tetrahedron they are the mean of its node values
+        point = self.document.addObject("Fem::FemPostDataAtPointFilter", "DataAtPoint")
+        pipeline.Filter = [point]
+        point.FieldName = "Temperature"
+        point.Center = FreeCAD.Vector(0.25, 0.25, 0.25)
+        self.document.recompute()
+        for frame in (0, 1, 2, 1):
+            pipeline.Frame = frame
+            self.assertEqual(len(point.PointData), 1)
+            self.assertAlmostEqual(point.PointData[0], frame + 1.5)
+
+        # a single result is no frame
+        pipeline.load(results[0])
+        self.assertEqual(pipeline.FrameResults, [])
+        self.assertEqual(pipeline.FrameValues, [])
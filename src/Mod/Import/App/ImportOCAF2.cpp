@@ -25,7 +25,9 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <algorithm>
 #include <Interface_Static.hxx>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -34,6 +36,8 @@
 #include <TDF_LabelSequence.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
@@ -108,6 +112,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.parallel = settings.getParallelImport();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
     auto hGrp =
@@ -199,11 +204,27 @@ void ImportOCAF2::setObjectName(Info& info, TDF_Label label)
     }
 }
 
-bool ImportOCAF2::getColor(const TopoDS_Shape& shape, Info& info, bool check, bool noDefault)
+bool ImportOCAF2::getShapeColor(const TopoDS_Shape& shape,
+                                TDF_Label label,
+                                XCAFDoc_ColorType type,
+                                Quantity_ColorRGBA& color) const
+{
+    // Looking up the shape searches its label, which is slow for large assemblies
+    if (!label.IsNull()) {
+        return aColorTool->GetColor(label, type, color);
+    }
+    return aColorTool->GetColor(shape, type, color);
+}
+
+bool ImportOCAF2::getColor(const TopoDS_Shape& shape,
+                           Info& info,
+                           bool check,
+                           bool noDefault,
+                           TDF_Label label)
 {
     bool ret = false;
     Quantity_ColorRGBA aColor;
-    if (aColorTool->GetColor(shape, XCAFDoc_ColorSurf, aColor)) {
+    if (getShapeColor(shape, label, XCAFDoc_ColorSurf, aColor)) {
         App::Color c = Tools::convertColor(aColor);
         if (!check || info.faceColor != c) {
             info.faceColor = c;
@@ -211,7 +232,8 @@ bool ImportOCAF2::getColor(const TopoDS_Shape& shape, Info& info, bool check, bo
             ret = true;
         }
     }
-    if (!noDefault && !info.hasFaceColor && aColorTool->GetColor(shape, XCAFDoc_ColorGen, aColor)) {
+    if (!noDefault && !info.hasFaceColor
+        && getShapeColor(shape, label, XCAFDoc_ColorGen, aColor)) {
         App::Color c = Tools::convertColor(aColor);
         if (!check || info.faceColor != c) {
             info.faceColor = c;
@@ -219,7 +241,7 @@ bool ImportOCAF2::getColor(const TopoDS_Shape& shape, Info& info, bool check, bo
             ret = true;
         }
     }
-    if (aColorTool->GetColor(shape, XCAFDoc_ColorCurv, aColor)) {
+    if (getShapeColor(shape, label, XCAFDoc_ColorCurv, aColor)) {
         App::Color c = Tools::convertColor(aColor);
         // Some STEP include a curve color with the same value of the face
         // color. And this will look weird in FC. So for shape with face
@@ -281,103 +303,225 @@ ImportOCAF2::expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape
     return info.obj;
 }
 
-bool ImportOCAF2::createObject(App::Document* doc,
-                               TDF_Label label,
-                               const TopoDS_Shape& shape,
-                               Info& info,
-                               bool newDoc)
+void ImportOCAF2::collectColors(TDF_Label label, const TopoDS_Shape& shape, ShapeColors& colors)
 {
-    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
-        FC_WARN(Tools::labelName(label) << " has empty shape");
-        return false;
-    }
-
-    getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
-
-    Part::TopoShape tshape(shape);
-    std::vector<App::Color> faceColors;
-    std::vector<App::Color> edgeColors;
+    colors.shape = shape;
+    getColor(shape, colors.info);
 
     TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return;
+    }
+
+    bool hasFaces = TopExp_Explorer(shape, TopAbs_FACE).More();
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 1; i <= seq.Length(); ++i) {
+            TDF_Label l = seq.Value(i);
+            TopoDS_Shape subShape = aShapeTool->GetShape(l);
+            if (subShape.IsNull()) {
+                continue;
+            }
+            if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
+                if (j == 0) {
                     continue;
                 }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
+            }
+            else if (j != 0) {
+                continue;
+            }
+
+            SubShapeColor sub;
+            sub.shape = subShape;
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+                sub.faceColor = Tools::convertColor(aColor);
+                sub.hasFaceColor = true;
+            }
+            if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                sub.edgeColor = Tools::convertColor(aColor);
+                sub.hasEdgeColor = true;
+                if (j == 0 && sub.hasFaceColor && hasFaces && sub.edgeColor == sub.faceColor) {
+                    // Do not set edge the same color as face
+                    sub.hasEdgeColor = false;
                 }
+            }
+            if (sub.hasFaceColor || sub.hasEdgeColor) {
+                colors.subShapes.push_back(sub);
+            }
+        }
+    }
+}
+
+void ImportOCAF2::mapColors(ShapeColors& colors, bool expandCompound)
+{
+    // Only works on the shapes, so it can run in parallel for different shapes
+    const TopoDS_Shape& shape = colors.shape;
+    if (expandCompound) {
+        TopTools_IndexedMapOfShape solidMap, shellMap;
+        TopExp::MapShapes(shape, TopAbs_SOLID, solidMap);
+        if (solidMap.Extent() == 0) {
+            TopExp::MapShapes(shape, TopAbs_SHELL, shellMap);
+        }
+        colors.expand = solidMap.Extent() > 1 || shellMap.Extent() > 1;
+    }
+
+    colors.prepared = true;
+    if (colors.subShapes.empty()) {
+        return;
+    }
 
-                bool foundFaceColor = false, foundEdgeColor = false;
-                App::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    Info& info = colors.info;
+    colors.faceColors.assign(faceMap.Extent(), info.faceColor);
+    colors.edgeColors.assign(edgeMap.Extent(), info.edgeColor);
+    for (const auto& sub : colors.subShapes) {
+        if (sub.hasFaceColor) {
+            for (TopExp_Explorer exp(sub.shape, TopAbs_FACE); exp.More(); exp.Next()) {
+                int idx = faceMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)colors.faceColors.size()) {
+                    colors.faceColors[idx] = sub.faceColor;
+                    colors.hasFaceColors = true;
+                    info.hasFaceColor = true;
                 }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
+            }
+        }
+        if (sub.hasEdgeColor) {
+            for (TopExp_Explorer exp(sub.shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)colors.edgeColors.size()) {
+                    colors.edgeColors[idx] = sub.edgeColor;
+                    colors.hasEdgeColors = true;
+                    info.hasEdgeColor = true;
                 }
+            }
+        }
+    }
+}
 
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
-                }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
+void ImportOCAF2::prepareShapes()
+{
+    myTopLabels.clear();
+    myPrepared.clear();
+
+    TDF_LabelSequence labels;
+    aShapeTool->GetShapes(labels);
+    std::size_t count = labels.Length();
+    Base::SequencerLauncher seq("Preparing shapes...", 2 * count);
+
+    // The colors are read from the document in this thread, only the work on the shapes is done
+    // in parallel
+    std::vector<ShapeColors*> shapes;
+    TopTools_MapOfShape faces;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        if (options.showProgress) {
+            seq.next(true);
+        }
+        auto label = labels.Value(i);
+        auto shape = aShapeTool->GetShape(label);
+        if (shape.IsNull()) {
+            continue;
+        }
+        myTopLabels.emplace(shape.Oriented(TopAbs_FORWARD), label);
+        if (aShapeTool->IsAssembly(label) || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
+            continue;
+        }
+
+        auto& colors = myPrepared[label];
+        collectColors(label, shape, colors);
+        // The triangulation is stored with the faces
+        TopTools_MapOfShape shapeFaces;
+        for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+            TopoDS_Shape face = exp.Current().Located(TopLoc_Location());
+            if (shapeFaces.Add(face) && !faces.Add(face)) {
+                colors.tessellate = false;
+            }
+        }
+        shapes.push_back(&colors);
+    }
+
+    bool expandCompound = options.expandCompound;
+    std::size_t step = std::max<std::size_t>(1, shapes.size() / 100);
+    for (std::size_t begin = 0; begin < shapes.size(); begin += step) {
+        std::size_t end = std::min(shapes.size(), begin + step);
+        OSD_Parallel::For(static_cast<int>(begin), static_cast<int>(end), [&](int index) {
+            ShapeColors& colors = *shapes[index];
+            try {
+                mapColors(colors, expandCompound);
+                if (colors.tessellate) {
+                    tessellateShape(colors.shape);
                 }
             }
+            catch (...) {
+                // handled again when the object is created
+                colors.prepared = false;
+            }
+        });
+        if (options.showProgress) {
+            seq.setProgress(count + count * end / shapes.size());
         }
     }
+    FC_LOG("prepared " << shapes.size() << " unique shapes");
+}
+
+TDF_Label ImportOCAF2::searchLabel(const TopoDS_Shape& shape, const ShapeLabels& components) const
+{
+    // Same order as XCAFDoc_ShapeTool::Search(), i.e. top-level shapes first and then components,
+    // but looked up in hash tables
+    auto key = shape.Oriented(TopAbs_FORWARD);
+    auto it = myTopLabels.find(key);
+    if (it != myTopLabels.end()) {
+        return it->second;
+    }
+    it = components.find(key);
+    if (it != components.end()) {
+        return it->second;
+    }
+    TDF_Label label;
+    aShapeTool->Search(shape, label, Standard_True, Standard_True, Standard_False);
+    return label;
+}
+
+bool ImportOCAF2::createObject(App::Document* doc,
+                               TDF_Label label,
+                               const TopoDS_Shape& shape,
+                               Info& info,
+                               bool newDoc)
+{
+    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
+        FC_WARN(Tools::labelName(label) << " has empty shape");
+        return false;
+    }
+
+    ShapeColors colors;
+    auto it = label.IsNull() ? myPrepared.end() : myPrepared.find(label);
+    if (it != myPrepared.end() && it->second.prepared && it->second.shape.IsEqual(shape)) {
+        colors = std::move(it->second);
+        myPrepared.erase(it);
+    }
+    else {
+        collectColors(label, shape, colors);
+        mapColors(colors, options.expandCompound);
+    }
+    info.faceColor = colors.info.faceColor;
+    info.edgeColor = colors.info.edgeColor;
+    info.hasFaceColor = colors.info.hasFaceColor;
+    info.hasEdgeColor = colors.info.hasEdgeColor;
 
+    Part::TopoShape tshape(shape);
     Part::Feature* feature;
 
     if (newDoc && (options.mode == ObjectPerDoc || options.mode == ObjectPerDir)) {
         doc = getDocument(doc, label);
     }
 
-    if (options.expandCompound
-        && (tshape.countSubShapes(TopAbs_SOLID) > 1
-            || (!tshape.countSubShapes(TopAbs_SOLID) && tshape.countSubShapes(TopAbs_SHELL) > 1))) {
+    if (colors.expand) {
         feature = dynamic_cast<Part::Feature*>(expandShape(doc, label, shape));
         assert(feature);
     }
@@ -388,11 +532,11 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (colors.hasFaceColors) {
+        applyFaceColors(feature, colors.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (colors.hasEdgeColors) {
+        applyEdgeColors(feature, colors.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -515,6 +659,10 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
     }
 
+    if (options.parallel) {
+        prepareShapes();
+    }
+
     TDF_LabelSequence labels;
     aShapeTool->GetShapes(labels);
     Base::SequencerLauncher seq("Importing...", labels.Length());
@@ -581,6 +729,8 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret->recomputeFeature(true);
     }
     sequencer = nullptr;
+    myTopLabels.clear();
+    myPrepared.clear();
     return ret;
 }
 
@@ -691,7 +841,7 @@ App::DocumentObject* ImportOCAF2::loadShape(App::Document* doc,
     }
 
     auto info = it->second;
-    getColor(shape, info, true);
+    getColor(shape, info, true, false, options.parallel ? label : TDF_Label());
 
     if (shuoColors.empty() && info.free && doc == info.obj->getDocument()) {
         it->second.free = false;
@@ -759,13 +909,34 @@ bool ImportOCAF2::createAssembly(App::Document* _doc,
         doc = getDocument(_doc, label);
     }
 
+    // Searching the label of each child is quadratic in the number of instances, so a parallel
+    // import looks up the components of this assembly instead
+    ShapeLabels components;
+    if (options.parallel && !label.IsNull()) {
+        TDF_LabelSequence seq;
+        aShapeTool->GetComponents(label, seq);
+        for (int i = 1; i <= seq.Length(); ++i) {
+            components.emplace(aShapeTool->GetShape(seq.Value(i)).Oriented(TopAbs_FORWARD),
+                               seq.Value(i));
+        }
+    }
+
     for (TopoDS_Iterator it(shape, Standard_False, Standard_False); it.More(); it.Next()) {
         TopoDS_Shape childShape = it.Value();
         if (childShape.IsNull()) {
             continue;
         }
         TDF_Label childLabel;
-        aShapeTool->Search(childShape, childLabel, Standard_True, Standard_True, Standard_False);
+        if (options.parallel) {
+            childLabel = searchLabel(childShape, components);
+        }
+        else {
+            aShapeTool->Search(childShape,
+                               childLabel,
+                               Standard_True,
+                               Standard_True,
+                               Standard_False);
+        }
         if (!childLabel.IsNull() && !options.importHidden && !aColorTool->IsVisible(childLabel)) {
             continue;
         }
@@ -796,7 +967,10 @@ bool ImportOCAF2::createAssembly(App::Document* _doc,
         childInfo.plas.emplace_back(
             Part::TopoShape::convert(childShape.Location().Transformation()));
         Quantity_ColorRGBA aColor;
-        if (aColorTool->GetColor(childShape, XCAFDoc_ColorSurf, aColor)) {
+        if (getShapeColor(childShape,
+                          options.parallel ? childLabel : TDF_Label(),
+                          XCAFDoc_ColorSurf,
+                          aColor)) {
             childInfo.colors[childInfo.plas.size() - 1] = Tools::convertColor(aColor);
         }
     }
@@ -30,6 +30,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include <Quantity_ColorRGBA.hxx>
+#include <TDF_Label.hxx>
 #include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
@@ -43,7 +45,6 @@
 #include "Tools.h"
 
 
-class TDF_Label;
 class TopLoc_Location;
 
 namespace App
@@ -71,6 +72,7 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool parallel = false;
     int mode = 0;
 };
 
@@ -108,6 +110,13 @@ public:
     {
         options.expandCompound = enable;
     }
+    /** Prepares each unique shape once and in parallel before the objects are created.
+     * Repeated occurrences become links to the object of their shape as before.
+     */
+    void setParallel(bool enable)
+    {
+        options.parallel = enable;
+    }
 
     enum ImportMode
     {
@@ -137,6 +146,35 @@ private:
         int free = true;
     };
 
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+    };
+
+    /// The colors of a shape and its faces and edges
+    struct ShapeColors
+    {
+        TopoDS_Shape shape;
+        Info info;
+        // colored sub-shapes, the faces and edges come last to override the solids
+        std::vector<SubShapeColor> subShapes;
+        std::vector<App::Color> faceColors;
+        std::vector<App::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+        // the compound is expanded into an object per solid
+        bool expand = false;
+        // false if the shape shares faces with another one that is tessellated at the same time
+        bool tessellate = true;
+        bool prepared = false;
+    };
+
+    using ShapeLabels = std::unordered_map<TopoDS_Shape, TDF_Label, ShapeHasher>;
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -159,8 +197,19 @@ private:
                      std::vector<App::DocumentObject*>& children,
                      const boost::dynamic_bitset<>& visibilities,
                      bool canReduce = false);
-    bool
-    getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false);
+    bool getColor(const TopoDS_Shape& shape,
+                  Info& info,
+                  bool check = false,
+                  bool noDefault = false,
+                  TDF_Label label = TDF_Label());
+    bool getShapeColor(const TopoDS_Shape& shape,
+                       TDF_Label label,
+                       XCAFDoc_ColorType type,
+                       Quantity_ColorRGBA& color) const;
+    void collectColors(TDF_Label label, const TopoDS_Shape& shape, ShapeColors& colors);
+    static void mapColors(ShapeColors& colors, bool expandCompound);
+    void prepareShapes();
+    TDF_Label searchLabel(const TopoDS_Shape& shape, const ShapeLabels& components) const;
     void
     getSHUOColors(TDF_Label label, std::map<std::string, App::Color>& colors, bool appendFirst);
     void setObjectName(Info& info, TDF_Label label);
@@ -176,6 +225,11 @@ private:
     {}
     virtual void applyLinkColor(App::DocumentObject*, int /*index*/, App::Color)
     {}
+    /** Called for the unique shapes of a parallel import, e.g. to compute their tessellation
+     * ahead. Shapes that are passed at the same time share no faces.
+     */
+    virtual void tessellateShape(const TopoDS_Shape&) const
+    {}
 
 private:
     class ImportLegacy: public ImportOCAF
@@ -208,6 +262,9 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    // only used by a parallel import
+    ShapeLabels myTopLabels;
+    std::unordered_map<TDF_Label, ShapeColors, LabelHasher> myPrepared;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
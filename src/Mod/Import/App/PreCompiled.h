@@ -39,6 +39,7 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <fcntl.h>
@@ -27,6 +27,9 @@
 #include <boost/core/ignore_unused.hpp>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 #if OCC_VERSION_HEX >= 0x070500
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
@@ -34,7 +37,10 @@
 #endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
+#include <Mod/Part/App/MeshHelper.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
@@ -58,6 +64,24 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
 #endif
+
+    // glTF only stores triangles, shapes that are not shown yet wouldn't be exported otherwise
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);  // NOLINT
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);  // NOLINT
+
+    TDF_LabelSequence labels;
+    XCAFDoc_DocumentTool::ShapeTool(hDoc->Main())->GetFreeShapes(labels);
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(labels.Value(i));
+        if (!shape.IsNull()) {
+            Part::MeshHelper::mesh(shape,
+                                   Part::MeshHelper::relativeDeflection(shape, deviation),
+                                   Base::toRadians(angularDeflection));
+        }
+    }
+
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
     if (!ret) {
         throw Base::FileException("Cannot save to file: ", file);
@@ -141,6 +141,7 @@ private:
             options.setItem("reduceObjects", Py::Boolean(stepSettings.reduceObjects));
             options.setItem("showProgress", Py::Boolean(stepSettings.showProgress));
             options.setItem("expandCompound", Py::Boolean(stepSettings.expandCompound));
+            options.setItem("parallel", Py::Boolean(stepSettings.parallel));
             options.setItem("mode", Py::Long(stepSettings.mode));
             options.setItem("codePage", Py::Long(stepSettings.codePage));
         }
@@ -244,6 +245,10 @@ private:
                         ocaf.setExpandCompound(
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound"))));
                     }
+                    if (options.hasKey("parallel")) {
+                        ocaf.setParallel(
+                            static_cast<bool>(Py::Boolean(options.getItem("parallel"))));
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
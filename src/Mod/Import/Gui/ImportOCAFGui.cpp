@@ -25,9 +25,16 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <BRepMesh_IncrementalMesh.hxx>
+#endif
+
 #include "ImportOCAFGui.h"
+#include <App/Application.h>
+#include <Base/Tools.h>
 #include <Gui/Application.h>
 #include <Gui/ViewProviderLink.h>
+#include <Mod/Part/App/MeshHelper.h>
 #include <Mod/Part/Gui/ViewProvider.h>
 
 using namespace ImportGui;
@@ -36,7 +43,25 @@ ImportOCAFGui::ImportOCAFGui(Handle(TDocStd_Document) hDoc,
                              App::Document* pDoc,
                              const std::string& name)
     : ImportOCAF2(hDoc, pDoc, name)
-{}
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);
+}
+
+void ImportOCAFGui::tessellateShape(const TopoDS_Shape& shape) const
+{
+    // Same parameters as the view provider uses so that it can take the triangulation
+    double deflection = Part::MeshHelper::relativeDeflection(shape, deviation);
+
+    // the shapes are already processed in parallel
+    BRepMesh_IncrementalMesh(shape,
+                             deflection,
+                             Standard_False,
+                             Base::toRadians(angularDeflection),
+                             Standard_False);
+}
 
 void ImportOCAFGui::applyFaceColors(Part::Feature* part, const std::vector<App::Color>& colors)
 {
@@ -36,11 +36,16 @@ public:
     ImportOCAFGui(Handle(TDocStd_Document) hDoc, App::Document* pDoc, const std::string& name);
 
 private:
+    void tessellateShape(const TopoDS_Shape& shape) const override;
     void applyFaceColors(Part::Feature* part, const std::vector<App::Color>& colors) override;
     void applyEdgeColors(Part::Feature* part, const std::vector<App::Color>& colors) override;
     void applyLinkColor(App::DocumentObject* obj, int index, App::Color color) override;
     void applyElementColors(App::DocumentObject* obj,
                             const std::map<std::string, App::Color>& colors) override;
+
+private:
+    double deviation;
+    double angularDeflection;
 };
 
 }  // namespace ImportGui
@@ -24,6 +24,7 @@ import tempfile
 import unittest
 import FreeCAD as App
 import ImportGui
+import Part
 from pivy import coin
 
 
@@ -89,3 +90,61 @@ class ExportImportTest(unittest.TestCase):
 
         mat = paths.get(2).getTail()
         self.assertEqual(mat.diffuseColor.getNum(), 6)
+
+    def testParallelImportAssembly(self):
+        """
+        Import a synthetic assembly with many instances of a few parts with and without
+        the parallel mode and compare the results
+        """
+        shapes = [Part.makeBox(2, 3, 4), Part.makeCylinder(1, 5), Part.makeSphere(2)]
+        parts = []
+        for i, shape in enumerate(shapes):
+            part = self.doc.addObject("App::Part", "Part")
+            feature = part.newObject("Part::Feature", "Feature")
+            feature.Shape = shape
+            colors = [(1.0, 0.0, 0.0, 1.0)] * len(shape.Faces)
+            colors[0] = (0.0, 0.0, 1.0 / (i + 1), 1.0)
+            feature.ViewObject.DiffuseColor = colors
+            parts.append(part)
+
+        row = self.doc.addObject("App::Part", "Row")
+        for i in range(20):
+            link = row.newObject("App::Link", "Link")
+            link.LinkedObject = parts[i % len(parts)]
+            link.Placement.Base = App.Vector(10 * i, 0, 0)
+        plant = self.doc.addObject("App::Part", "Plant")
+        for i in range(20):
+            link = plant.newObject("App::Link", "Row")
+            link.LinkedObject = row
+            link.Placement.Base = App.Vector(0, 10 * i, 0)
+        self.doc.recompute()
+
+        fileName = os.path.join(tempfile.gettempdir(), "ParallelImportTest.step")
+        ImportGui.export([plant], fileName)
+
+        results = []
+        for parallel in (False, True):
+            doc = App.newDocument()
+            ImportGui.insert(
+                name=fileName,
+                docName=doc.Name,
+                options={
+                    "merge": False,
+                    "useLinkGroup": True,
+                    "reduceObjects": False,
+                    "showProgress": False,
+                    "parallel": parallel,
+                },
+            )
+            types = sorted(obj.TypeId for obj in doc.Objects)
+            colors = sorted(
+                obj.ViewObject.DiffuseColor
+                for obj in doc.Objects
+                if obj.isDerivedFrom("Part::Feature")
+            )
+            results.append((types, colors))
+            App.closeDocument(doc.Name)
+        os.remove(fileName)
+
+        self.assertEqual(len(results[0][1]), len(shapes))
+        self.assertEqual(results[0], results[1])
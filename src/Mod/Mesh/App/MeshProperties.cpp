@@ -721,6 +721,7 @@ bool PropertyMaterial::isSame(const App::Property& other) const
 
 PropertyMeshKernel::PropertyMeshKernel()
     : _meshObject(new MeshObject())
+    , _sharedMesh(std::make_shared<int>())
 {
     // Note: Normally this property is a member of a document object, i.e. the setValue()
     // method gets called in the constructor of a subclass of DocumentObject, e.g. Mesh::Feature.
@@ -738,33 +739,73 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+bool PropertyMeshKernel::isShared() const
+{
+    return _sharedMesh.use_count() > 1;
+}
+
+void PropertyMeshKernel::detach()
+{
+    if (isShared()) {
+        setMeshObject(new MeshObject(*_meshObject));
+    }
+}
+
+void PropertyMeshKernel::setMeshObject(MeshObject* mesh)
+{
+    if (_meshObject == mesh) {
+        return;
+    }
+
+    // keep the old mesh until the Python wrapper has released it
+    Base::Reference<MeshObject> tmp(_meshObject);
+    _meshObject = mesh;
+    _sharedMesh = std::make_shared<int>();
+    if (meshPyObject) {
+        mesh->ref();
+        meshPyObject->setTwinPointer(mesh);
+        tmp->unref();
+    }
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    setMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    if (isShared()) {
+        setMeshObject(new MeshObject(mesh));
+    }
+    else {
+        *_meshObject = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
-    _meshObject->setKernel(mesh);
+    if (isShared()) {
+        setMeshObject(new MeshObject(mesh, _meshObject->getTransform()));
+    }
+    else {
+        _meshObject->setKernel(mesh);
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detach();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -772,6 +813,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detach();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -807,6 +849,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -818,6 +861,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detach();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +870,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detach();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +880,7 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detach();
     _meshObject->setTransform(rclTrf);
 }
 
@@ -910,6 +956,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detach();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,23 +974,26 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _meshObject->load(reader);
     hasSetValue();
 }
 
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it gets copied on modification
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
+    prop->_sharedMesh = this->_sharedMesh;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
+    // Note: Reference the same mesh object, it gets copied on modification
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    aboutToSetValue();
+    setMeshObject(prop._meshObject);
+    _sharedMesh = prop._sharedMesh;
     hasSetValue();
 }
@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -316,12 +317,26 @@ public:
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
+    /** The copy references the same mesh object. The mesh data gets copied only when one of the
+     * properties is modified afterwards, which keeps the snapshots of the undo stack cheap.
+     */
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    /// True if the mesh object is referenced by another property, e.g. a copy for undo
+    bool isShared() const;
+    /// Creates an own copy of the mesh object before it gets modified if it is shared
+    void detach();
+    /// References \a mesh and moves the Python wrapper along
+    void setMeshObject(MeshObject* mesh);
+
 private:
     Base::Reference<MeshObject> _meshObject;
+    // Owned by all properties sharing the mesh object by Copy() or Paste(). Other references,
+    // e.g. of the view provider or the Python wrapper, don't count.
+    std::shared_ptr<int> _sharedMesh;
     MeshPy* meshPyObject {nullptr};
 };
 
@@ -747,3 +747,56 @@ class MeshProperty(unittest.TestCase):
         self.assertEqual(len(material2["emissiveColor"]), len1 + len2)
         self.assertEqual(len(material2["shininess"]), len1 + len2)
         self.assertEqual(len(material2["transparency"]), len1 + len2)
+
+
+class MeshPropertyUndoCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("MeshUndoTest")
+        self.doc.UndoMode = 1
+        self.obj = self.doc.addObject("Mesh::Feature", "Mesh")
+
+    def testUndoSetMesh(self):
+        self.doc.openTransaction("Box")
+        self.obj.Mesh = Mesh.createBox(1.0, 1.0, 1.0)
+        self.doc.commitTransaction()
+        mesh = self.obj.Mesh
+
+        self.doc.openTransaction("Sphere")
+        self.obj.Mesh = Mesh.createSphere(1.0, 20)
+        self.doc.commitTransaction()
+        count = self.obj.Mesh.CountFacets
+        self.assertNotEqual(count, 12)
+        # the Python wrapper follows the property
+        self.assertEqual(mesh.CountFacets, count)
+
+        self.doc.undo()
+        self.assertEqual(self.obj.Mesh.CountFacets, 12)
+        self.assertEqual(mesh.CountFacets, 12)
+        self.doc.undo()
+        self.assertEqual(self.obj.Mesh.CountFacets, 0)
+        self.doc.redo()
+        self.doc.redo()
+        self.assertEqual(self.obj.Mesh.CountFacets, count)
+
+    def testUndoPlacement(self):
+        self.doc.openTransaction("Box")
+        self.obj.Mesh = Mesh.createBox(1.0, 1.0, 1.0)
+        self.doc.commitTransaction()
+        xmin = self.obj.Mesh.BoundBox.XMin
+
+        self.doc.openTransaction("Move")
+        self.obj.Placement = FreeCAD.Placement(FreeCAD.Vector(5, 0, 0), FreeCAD.Rotation())
+        self.doc.commitTransaction()
+        self.assertAlmostEqual(self.obj.Mesh.BoundBox.XMin, xmin + 5)
+
+        self.doc.undo()
+        self.assertAlmostEqual(self.obj.Mesh.BoundBox.XMin, xmin)
+        self.doc.undo()
+        self.assertEqual(self.obj.Mesh.CountFacets, 0)
+        self.doc.redo()
+        self.assertAlmostEqual(self.obj.Mesh.BoundBox.XMin, xmin)
+        self.doc.redo()
+        self.assertAlmostEqual(self.obj.Mesh.BoundBox.XMin, xmin + 5)
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
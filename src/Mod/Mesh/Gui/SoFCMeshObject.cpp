@@ -42,11 +42,13 @@
 #include <Inventor/actions/SoGetPrimitiveCountAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/actions/SoPickAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/actions/SoSearchAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/details/SoPointDetail.h>
 #include <Inventor/misc/SoState.h>
 #endif
 
@@ -619,6 +621,7 @@ void SoFCMeshObjectShape::notify(SoNotList* node)
 {
     inherited::notify(node);
     updateGLArray = true;
+    pickTreeMesh = nullptr;
 }
 
 #define RENDER_GLARRAYS
@@ -1071,11 +1074,107 @@ void SoFCMeshObjectShape::renderSelectionGeometry(const Mesh::MeshObject* mesh)
 
 
 /**
- * Calculates picked point based on primitives generated by subclasses.
+ * Calculates the picked points. Instead of generating all triangles as primitives only the
+ * facets whose bounding box is cut by the pick ray are tested. The picked points get the same
+ * normals and details as the ones created by generatePrimitives().
  */
 void SoFCMeshObjectShape::rayPick(SoRayPickAction* action)
 {
-    inherited::rayPick(action);
+    SoState* state = action->getState();
+    const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
+    if (!mesh || mesh->countPoints() < 3 || mesh->countFacets() == 0) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    if (!shouldRayPick(action)) {
+        return;
+    }
+    computeObjectSpaceRay(action);
+    updatePickTree(state, mesh);
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    Binding mbind = this->findMaterialBinding(state);
+
+    const SbLine& line = action->getLine();
+    const SbVec3f& pos = line.getPosition();
+    const SbVec3f& dir = line.getDirection();
+    Base::Vector3f base(pos[0], pos[1], pos[2]);
+    Base::Vector3f direction(dir[0], dir[1], dir[2]);
+
+    auto cutByRay = [&base, &direction](const Base::BoundBox3f& box) {
+        return Base::BoundBoxTree::isCutByLine(box, base, direction);
+    };
+    auto pickFacet = [&](int index) {
+        const MeshCore::MeshFacet& rFacet = rFacets[index];
+        SbVec3f v0 = sbvec3f(rPoints[rFacet._aulPoints[0]]);
+        SbVec3f v1 = sbvec3f(rPoints[rFacet._aulPoints[1]]);
+        SbVec3f v2 = sbvec3f(rPoints[rFacet._aulPoints[2]]);
+
+        SbVec3f intersection;
+        SbVec3f barycentric;
+        SbBool front {};
+        if (!action->intersect(v0, v1, v2, intersection, barycentric, front)
+            || !action->isBetweenPlanes(intersection)) {
+            return;
+        }
+
+        SoPickedPoint* pp = action->addIntersection(intersection);
+        if (!pp) {
+            return;
+        }
+
+        bool indexed = (mbind == PER_VERTEX_INDEXED || mbind == PER_FACE_INDEXED);
+        SbVec3f normal = (v1 - v0).cross(v2 - v0);
+        normal.normalize();
+        pp->setObjectNormal(normal);
+        pp->setMaterialIndex(indexed ? int(rFacet._aulPoints[0]) : 0);
+
+        auto detail = new SoFaceDetail();
+        detail->setFaceIndex(index);
+        detail->setNumPoints(3);
+        for (int i = 0; i < 3; i++) {
+            SoPointDetail pointDetail;
+            pointDetail.setCoordinateIndex(int(rFacet._aulPoints[i]));
+            if (indexed) {
+                pointDetail.setMaterialIndex(int(rFacet._aulPoints[i]));
+            }
+            detail->setPoint(i, &pointDetail);
+        }
+        pp->setDetail(detail, this);
+    };
+
+    pickTree.search(cutByRay, pickFacet);
+}
+
+/**
+ * Rebuilds the bounding box tree of the facets if the mesh has changed since the last pick.
+ */
+void SoFCMeshObjectShape::updatePickTree(SoState* state, const Mesh::MeshObject* mesh)
+{
+    SbUniqueId meshId = SoFCMeshObjectElement::getInstance(state)->getNodeId();
+    if (pickTreeMesh == mesh && pickTreeMeshId == meshId
+        && pickTreeFacets == mesh->countFacets()) {
+        return;
+    }
+
+    pickTreeMesh = mesh;
+    pickTreeMeshId = meshId;
+    pickTreeFacets = mesh->countFacets();
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(rFacets.size());
+    for (const auto& rFacet : rFacets) {
+        Base::BoundBox3f box;
+        box.Add(rPoints[rFacet._aulPoints[0]]);
+        box.Add(rPoints[rFacet._aulPoints[1]]);
+        box.Add(rPoints[rFacet._aulPoints[2]]);
+        boxes.push_back(box);
+    }
+    pickTree.build(std::move(boxes));
 }
 
 /** Sets the point indices, the geometric points and the normal for each triangle.
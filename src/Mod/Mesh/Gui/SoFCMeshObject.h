@@ -29,6 +29,7 @@
 #include <Inventor/fields/SoSFVec3s.h>
 #include <Inventor/fields/SoSField.h>
 #include <Inventor/nodes/SoShape.h>
+#include <Base/BoundBoxTree.h>
 #include <Mod/Mesh/App/Mesh.h>
 
 
@@ -221,6 +222,7 @@ private:
                    SbBool ccw) const;
     void drawPoints(const Mesh::MeshObject*, SbBool needNormals, SbBool ccw) const;
     unsigned int countTriangles(SoAction* action) const;
+    void updatePickTree(SoState* state, const Mesh::MeshObject*);
 
     void startSelection(SoAction* action, const Mesh::MeshObject*);
     void stopSelection(SoAction* action, const Mesh::MeshObject*);
@@ -238,6 +240,11 @@ private:
     std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
     SbBool updateGLArray {false};
+    // Bounding box tree of the facets to speed up picking
+    Base::BoundBoxTree pickTree;
+    const Mesh::MeshObject* pickTreeMesh {nullptr};
+    SbUniqueId pickTreeMeshId {0};
+    unsigned long pickTreeFacets {0};
 };
 
 class MeshGuiExport SoFCMeshSegmentShape: public SoShape
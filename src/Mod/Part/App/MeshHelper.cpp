@@ -0,0 +1,123 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <gp.hxx>
+#endif
+
+#include "MeshHelper.h"
+
+
+using namespace Part;
+
+namespace
+{
+// the tolerance OCC uses to accept an existing triangulation
+constexpr double deflectionRatio = 0.1;
+
+bool acceptDeflection(double current, double deflection, bool exact)
+{
+    return current <= (1.0 + deflectionRatio) * deflection
+        && (!exact || current >= (1.0 - deflectionRatio) * deflection);
+}
+}  // namespace
+
+bool MeshHelper::isMeshed(const TopoDS_Shape& shape, double deflection, bool exact)
+{
+    bool hasMesh = false;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        hasMesh = true;
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (mesh.IsNull() || !acceptDeflection(mesh->Deflection(), deflection, exact)) {
+            return false;
+        }
+    }
+    // the mesher discretizes the edges that are not on a face into 3D polygons
+    for (TopExp_Explorer xp(shape, TopAbs_EDGE, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        hasMesh = true;
+        TopLoc_Location loc;
+        Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, loc);
+        if (polygon.IsNull() || !acceptDeflection(polygon->Deflection(), deflection, exact)) {
+            return false;
+        }
+    }
+    return hasMesh;
+}
+
+double MeshHelper::relativeDeflection(const TopoDS_Shape& shape, double deviation)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real deflection = ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+
+    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
+    // should be displayed.
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
+    return deflection;
+}
+
+void MeshHelper::mesh(const TopoDS_Shape& shape,
+                             double deflection,
+                             double angularDeflection,
+                             bool exact)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    if (isMeshed(shape, deflection, exact)) {
+        return;
+    }
+
+#if OCC_VERSION_HEX >= 0x070500
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = Standard_False;
+    meshParams.Angle = angularDeflection;
+    meshParams.InParallel = Standard_True;
+    meshParams.AllowQualityDecrease = exact;
+
+    BRepMesh_IncrementalMesh(shape, meshParams);
+#else
+    BRepMesh_IncrementalMesh(shape, deflection, Standard_False, angularDeflection, Standard_True);
+#endif
+}
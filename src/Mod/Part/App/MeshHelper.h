@@ -0,0 +1,60 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PART_MESHHELPER_H
+#define PART_MESHHELPER_H
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+
+namespace Part
+{
+
+/** Triangulates shapes for the 3D view and the exports with the same settings.
+ *
+ * OCC keeps the triangulation with the faces of a shape and the polygons with its free edges, so
+ * a shape that is already meshed at least as fine as requested is not passed to the mesher again,
+ * i.e. a finer mesh serves a coarser request. The faces of a shape are triangulated in parallel.
+ */
+class PartExport MeshHelper
+{
+public:
+    /** Meshes the faces and free edges of \a shape that are not meshed with at most \a deflection.
+     * With \a exact a much finer triangulation is replaced too, e.g. if the user asks for a coarser
+     * one.
+     */
+    static void mesh(const TopoDS_Shape& shape,
+                     double deflection,
+                     double angularDeflection,
+                     bool exact = false);
+
+    /// True if all faces and free edges of \a shape are meshed with at most \a deflection
+    static bool isMeshed(const TopoDS_Shape& shape, double deflection, bool exact = false);
+    /// The deflection for \a shape relative to its size, as used by the 3D view
+    static double relativeDeflection(const TopoDS_Shape& shape, double deviation);
+};
+
+}  // namespace Part
+
+
+#endif  // PART_MESHHELPER_H
@@ -262,6 +262,16 @@ bool ImportExportSettings::getExpandCompound() const
     return pGroup->GetBool("ExpandCompound", false);
 }
 
+void ImportExportSettings::setParallelImport(bool on)
+{
+    pGroup->SetBool("ParallelImport", on);
+}
+
+bool ImportExportSettings::getParallelImport() const
+{
+    return pGroup->GetBool("ParallelImport", false);
+}
+
 void ImportExportSettings::setShowProgress(bool on)
 {
     pGroup->SetBool("ShowProgress", on);
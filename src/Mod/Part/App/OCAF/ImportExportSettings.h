@@ -92,6 +92,9 @@ public:
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
+    void setParallelImport(bool);
+    bool getParallelImport() const;
+
     void setShowProgress(bool);
     bool getShowProgress() const;
 
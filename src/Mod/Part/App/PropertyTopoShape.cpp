@@ -566,21 +566,25 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (_Shape.getShape().IsNull())
         return;
     TopoDS_Shape myShape = _Shape.getShape();
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General");
+    // Storing the triangulation makes the file bigger but the shape doesn't need to be
+    // triangulated again when the document is opened
+    bool withTriangles = hGrp->GetBool("SaveTriangulation", false);
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), withTriangles);
     }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+        bool direct = hGrp->GetBool("DirectAccess", true);
         if (!direct) {
             saveToFile(writer);
         }
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), withTriangles);
         }
     }
 }
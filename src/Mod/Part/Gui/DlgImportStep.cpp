@@ -48,6 +48,7 @@ DlgImportStep::DlgImportStep(QWidget* parent)
     ui->checkBoxReduceObjects->setChecked(settings.getReduceObjects());
     ui->checkBoxExpandCompound->setChecked(settings.getExpandCompound());
     ui->checkBoxShowProgress->setChecked(settings.getShowProgress());
+    ui->checkBoxParallelImport->setChecked(settings.getParallelImport());
 #if OCC_VERSION_HEX >= 0x070800
     std::list<Part::OCAF::ImportExportSettings::CodePage> codepagelist;
     codepagelist = settings.getCodePageList();
@@ -79,6 +80,7 @@ void DlgImportStep::saveSettings()
     ui->checkBoxReduceObjects->onSave();
     ui->checkBoxExpandCompound->onSave();
     ui->checkBoxShowProgress->onSave();
+    ui->checkBoxParallelImport->onSave();
     ui->comboBoxImportMode->onSave();
 }
 
@@ -95,6 +97,7 @@ void DlgImportStep::loadSettings()
     ui->checkBoxReduceObjects->onRestore();
     ui->checkBoxExpandCompound->onRestore();
     ui->checkBoxShowProgress->onRestore();
+    ui->checkBoxParallelImport->onRestore();
     ui->comboBoxImportMode->onRestore();
 }
 
@@ -109,6 +112,7 @@ StepImportSettings DlgImportStep::getSettings() const
     set.reduceObjects = settings.getReduceObjects();
     set.showProgress = settings.getShowProgress();
     set.expandCompound = settings.getExpandCompound();
+    set.parallel = settings.getParallelImport();
     set.mode = static_cast<int>(settings.getImportMode());
 #if OCC_VERSION_HEX >= 0x070800
     Resource_FormatType cp = settings.getImportCodePage();
@@ -42,6 +42,7 @@ struct StepImportSettings
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool parallel = false;
     int mode = 0;
     int codePage = -1;
 };
@@ -61,6 +61,7 @@
 // Boost
 #include <boost/regex.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/functional/hash.hpp>
 
 // GL
 // Include glext before QtAll/InventorAll
@@ -33,19 +33,27 @@
 # endif
 # include <algorithm>
 # include <cfloat>
+# include <boost/functional/hash.hpp>
+# include <Inventor/SbBox3f.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
+# include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/details/SoLineDetail.h>
+# include <Inventor/details/SoPointDetail.h>
 # include <Inventor/elements/SoCoordinateElement.h>
 # include <Inventor/elements/SoGLCoordinateElement.h>
 # include <Inventor/elements/SoLineWidthElement.h>
+# include <Inventor/elements/SoMaterialBindingElement.h>
+# include <Inventor/elements/SoNormalElement.h>
 # include <Inventor/errors/SoDebugError.h>
 # include <Inventor/misc/SoState.h>
 #endif
 
+#include <Base/BoundBoxTree.h>
 #include <Gui/SoFCUnifiedSelection.h>
 #include "SoBrepEdgeSet.h"
 
@@ -58,6 +66,21 @@ struct SoBrepEdgeSet::SelContext: Gui::SoFCSelectionContext {
     std::vector<int32_t> hl, sl;
 };
 
+struct SoBrepEdgeSet::PickCache {
+    // the coordinates and indices the tree was built for, the indices may be edited in place so
+    // their hash is compared whenever the node has changed
+    SbUniqueId coordsId{0};
+    SbUniqueId nodeId{0};
+    const int32_t *vertexindices{nullptr};
+    int num_vertexindices{-1};
+    std::size_t indexHash{0};
+    // false if the tree can't be used, e.g. because of a polyline with a single point
+    bool usable{false};
+    Base::BoundBoxTree tree;
+    // the offset of the first index of each segment and the polyline it belongs to
+    std::vector<std::pair<int, int>> segments;
+};
+
 void SoBrepEdgeSet::initClass()
 {
     SO_NODE_INIT_CLASS(SoBrepEdgeSet, SoIndexedLineSet, "IndexedLineSet");
@@ -70,6 +93,8 @@ SoBrepEdgeSet::SoBrepEdgeSet()
     SO_NODE_CONSTRUCTOR(SoBrepEdgeSet);
 }
 
+SoBrepEdgeSet::~SoBrepEdgeSet() = default;
+
 void SoBrepEdgeSet::GLRender(SoGLRenderAction *action)
 {
     auto state = action->getState();
@@ -465,3 +490,145 @@ SoDetail * SoBrepEdgeSet::createLineSegmentDetail(SoRayPickAction * action,
     return detail;
 }
 
+
+/**
+ * Picks the line segments with the help of a bounding box tree instead of generating all of
+ * them as primitives. For bindings the tree doesn't support the traversal of the base class
+ * is used.
+ */
+void SoBrepEdgeSet::rayPick(SoRayPickAction *action)
+{
+    SoState * state = action->getState();
+    SoMaterialBindingElement::Binding mbind = SoMaterialBindingElement::get(state);
+    SoTextureCoordinateBundle tb(action, false, false);
+    if (this->vertexProperty.getValue() || tb.needCoordinates() ||
+        SoNormalElement::getInstance(state)->getNum() > 0 ||
+        (mbind != SoMaterialBindingElement::OVERALL && mbind != SoMaterialBindingElement::PER_FACE)) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    const SoCoordinateElement * coords = SoCoordinateElement::getInstance(state);
+    const int32_t * cindices = this->coordIndex.getValues(0);
+    int numindices = this->coordIndex.getNum();
+    if (!updatePickCache(coords, cindices, numindices)) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    if (!this->shouldRayPick(action)) {
+        return;
+    }
+    this->computeObjectSpaceRay(action);
+
+    // the boxes are tested against the view volume as the pick radius also applies to lines
+    auto cutByRay = [action](const Base::BoundBox3f& box) {
+        return action->intersect(SbBox3f(box.MinX, box.MinY, box.MinZ,
+                                         box.MaxX, box.MaxY, box.MaxZ), true);
+    };
+    auto pickSegment = [&](int index) {
+        int start = pickCache->segments[index].first;
+        int line = pickCache->segments[index].second;
+        SbVec3f v1 = coords->get3(cindices[start]);
+        SbVec3f v2 = coords->get3(cindices[start + 1]);
+
+        SbVec3f intersection;
+        if (!action->intersect(v1, v2, intersection) || !action->isBetweenPlanes(intersection)) {
+            return;
+        }
+
+        SoPickedPoint * pp = action->addIntersection(intersection);
+        if (!pp) {
+            return;
+        }
+
+        int material = mbind == SoMaterialBindingElement::PER_FACE ? line : 0;
+        pp->setObjectNormal(SbVec3f(0,0,1));
+        pp->setObjectTextureCoords(SbVec4f(0,0,0,1));
+        pp->setMaterialIndex(material);
+
+        auto detail = new SoLineDetail();
+        detail->setLineIndex(line);
+        detail->setPartIndex(line);
+        SoPointDetail pointDetail;
+        pointDetail.setMaterialIndex(material);
+        pointDetail.setCoordinateIndex(cindices[start]);
+        detail->setPoint0(&pointDetail);
+        pointDetail.setCoordinateIndex(cindices[start + 1]);
+        detail->setPoint1(&pointDetail);
+        pp->setDetail(detail, this);
+    };
+
+    pickCache->tree.search(cutByRay, pickSegment);
+}
+
+bool SoBrepEdgeSet::updatePickCache(const SoCoordinateElement * coords,
+                                    const int32_t *vertexindices,
+                                    int num_vertexindices)
+{
+    if (!pickCache) {
+        pickCache = std::make_unique<PickCache>();
+    }
+
+    PickCache& cache = *pickCache;
+    if (cache.coordsId != coords->getNodeId() ||
+        cache.vertexindices != vertexindices ||
+        cache.num_vertexindices != num_vertexindices) {
+        cache.nodeId = 0;
+    }
+    else if (cache.nodeId == this->getNodeId()) {
+        return cache.usable;
+    }
+
+    // highlighting and selection touch the node without changing its geometry
+    std::size_t hash = boost::hash_range(vertexindices, vertexindices + num_vertexindices);
+    if (cache.nodeId != 0 && cache.indexHash == hash) {
+        cache.nodeId = this->getNodeId();
+        return cache.usable;
+    }
+
+    cache.coordsId = coords->getNodeId();
+    cache.nodeId = this->getNodeId();
+    cache.vertexindices = vertexindices;
+    cache.num_vertexindices = num_vertexindices;
+    cache.indexHash = hash;
+    cache.usable = false;
+    cache.tree.clear();
+    cache.segments.clear();
+
+    int numcoords = coords->getNum();
+    std::vector<Base::BoundBox3f> boxes;
+    int line = 0;
+    int start = 0;
+    for (int i = 0; i <= num_vertexindices; i++) {
+        if (i < num_vertexindices && vertexindices[i] >= 0) {
+            if (vertexindices[i] >= numcoords) {
+                return false;
+            }
+            continue;
+        }
+
+        // the polyline ends at index i
+        if (i - start < 2) {
+            if (i == start && i == num_vertexindices) {
+                break;
+            }
+            return false;
+        }
+        for (int j = start; j + 1 < i; j++) {
+            SbVec3f v1 = coords->get3(vertexindices[j]);
+            SbVec3f v2 = coords->get3(vertexindices[j + 1]);
+            Base::BoundBox3f box;
+            box.Add(Base::Vector3f(v1[0], v1[1], v1[2]));
+            box.Add(Base::Vector3f(v2[0], v2[1], v2[2]));
+            boxes.push_back(box);
+            cache.segments.emplace_back(j, line);
+        }
+        line++;
+        start = i + 1;
+    }
+
+    cache.tree.build(std::move(boxes));
+    cache.usable = true;
+    return true;
+}
@@ -46,10 +46,11 @@ public:
     SoBrepEdgeSet();
 
 protected:
-    ~SoBrepEdgeSet() override = default;
+    ~SoBrepEdgeSet() override;
     void GLRender(SoGLRenderAction *action) override;
     void GLRenderBelowPath(SoGLRenderAction * action) override;
     void doAction(SoAction* action) override;
+    void rayPick(SoRayPickAction *action) override;
     SoDetail * createLineSegmentDetail(
         SoRayPickAction *action,
         const SoPrimitiveVertex *v1,
@@ -67,12 +68,19 @@ private:
     void renderHighlight(SoGLRenderAction *action, SelContextPtr);
     void renderSelection(SoGLRenderAction *action, SelContextPtr, bool push=true);
     bool validIndexes(const SoCoordinateElement*, const std::vector<int32_t>&) const;
+    bool updatePickCache(const SoCoordinateElement * coords,
+                         const int32_t *vertexindices,
+                         int num_vertexindices);
 
 private:
     SelContextPtr selContext;
     SelContextPtr selContext2;
     Gui::SoFCSelectionCounter selCounter;
     uint32_t packedColor{0};
+
+    // Bounding box tree of the line segments to speed up picking
+    struct PickCache;
+    std::unique_ptr<PickCache> pickCache;
 };
 
 } // namespace PartGui
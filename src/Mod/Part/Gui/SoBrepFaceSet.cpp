@@ -32,10 +32,13 @@
 # include <algorithm>
 # include <cfloat>
 # include <map>
+# include <boost/functional/hash.hpp>
+# include <Inventor/SbLine.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/elements/SoLazyElement.h>
@@ -46,6 +49,7 @@
 # include <Inventor/elements/SoGLVBOElement.h>
 # include <Inventor/errors/SoDebugError.h>
 # include <Inventor/details/SoFaceDetail.h>
+# include <Inventor/details/SoPointDetail.h>
 # include <Inventor/misc/SoState.h>
 # include <Inventor/misc/SoContextHandler.h>
 # include <Inventor/elements/SoCacheElement.h>
@@ -68,6 +72,7 @@
 # include <Inventor/C/glue/gl.h>
 #endif
 
+#include <Base/BoundBoxTree.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/SoFCSelectionAction.h>
 #include <Gui/SoFCUnifiedSelection.h>
@@ -156,6 +161,22 @@ public:
 
 SbBool SoBrepFaceSet::VBO::vboAvailable = false;
 
+struct SoBrepFaceSet::PickCache {
+    // the coordinates and indices the tree was built for, the indices may be edited in place so
+    // their hash is compared whenever the node has changed
+    SbUniqueId coordsId{0};
+    SbUniqueId nodeId{0};
+    const int32_t *vertexindices{nullptr};
+    int num_vertexindices{-1};
+    int num_partindices{-1};
+    std::size_t indexHash{0};
+    // false if the tree can't be used, e.g. because the face set doesn't only consist of triangles
+    bool usable{false};
+    Base::BoundBoxTree tree;
+    // the index of the first triangle of each part
+    std::vector<int> partStart;
+};
+
 void SoBrepFaceSet::initClass()
 {
     SO_NODE_INIT_CLASS(SoBrepFaceSet, SoIndexedFaceSet, "IndexedFaceSet");
@@ -335,6 +356,7 @@ void SoBrepFaceSet::doAction(SoAction* action)
             v.second.updateVbo = true;
             v.second.vboLoaded = false;
         }
+        pickCache.reset();
     }
 
     inherited::doAction(action);
@@ -1868,6 +1890,226 @@ void SoBrepFaceSet::renderShape(SoGLRenderAction * action,
     glEnd();
 }
 
+/**
+ * Picks the triangles with the help of a bounding box tree instead of generating all of
+ * them as primitives. The picked points get the same normals and details as with the
+ * traversal of the base class, which is used for bindings the tree doesn't support.
+ */
+void SoBrepFaceSet::rayPick(SoRayPickAction *action)
+{
+    SoState * state = action->getState();
+    Binding mbind = this->findMaterialBinding(state);
+    Binding nbind = this->findNormalBinding(state);
+    if (this->vertexProperty.getValue() || (mbind != OVERALL && mbind != PER_PART)) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    SoTextureCoordinateBundle tb(action, false, false);
+    if (tb.needCoordinates()) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    const SoCoordinateElement * coords;
+    const SbVec3f * normals;
+    const int32_t * cindices;
+    int numindices;
+    const int32_t * nindices;
+    const int32_t * tindices;
+    const int32_t * mindices;
+    SbBool normalCacheUsed;
+
+    this->getVertexData(state, coords, normals, cindices,
+                        nindices, tindices, mindices, numindices,
+                        true, normalCacheUsed);
+
+    if (normalCacheUsed && nbind == PER_VERTEX) {
+        nbind = PER_VERTEX_INDEXED;
+    }
+    if (nbind == PER_VERTEX_INDEXED && !nindices) {
+        nindices = cindices;
+    }
+    if (!normals) {
+        nbind = OVERALL;
+    }
+
+    bool supported = (nbind == OVERALL || nbind == PER_VERTEX_INDEXED) &&
+                     updatePickCache(coords, cindices, numindices);
+    if (supported && this->shouldRayPick(action)) {
+        this->computeObjectSpaceRay(action);
+        rayPickTriangles(action, coords, cindices, normals, nindices, nbind, mbind);
+    }
+
+    if (normalCacheUsed) {
+        this->readUnlockNormalCache();
+    }
+
+    if (!supported) {
+        inherited::rayPick(action);
+    }
+}
+
+bool SoBrepFaceSet::updatePickCache(const SoCoordinateElement * coords,
+                                    const int32_t *vertexindices,
+                                    int num_vertexindices)
+{
+    if (!pickCache) {
+        pickCache = std::make_unique<PickCache>();
+    }
+
+    PickCache& cache = *pickCache;
+    if (cache.coordsId != coords->getNodeId() ||
+        cache.vertexindices != vertexindices ||
+        cache.num_vertexindices != num_vertexindices ||
+        cache.num_partindices != this->partIndex.getNum()) {
+        cache.nodeId = 0;
+    }
+    else if (cache.nodeId == this->getNodeId()) {
+        return cache.usable;
+    }
+
+    // highlighting and selection touch the node without changing its geometry
+    const int32_t* partindices = this->partIndex.getValues(0);
+    int num_partindices = this->partIndex.getNum();
+    std::size_t hash = boost::hash_range(vertexindices, vertexindices + num_vertexindices);
+    boost::hash_combine(hash, boost::hash_range(partindices, partindices + num_partindices));
+    if (cache.nodeId != 0 && cache.indexHash == hash) {
+        cache.nodeId = this->getNodeId();
+        return cache.usable;
+    }
+
+    cache.coordsId = coords->getNodeId();
+    cache.nodeId = this->getNodeId();
+    cache.vertexindices = vertexindices;
+    cache.num_vertexindices = num_vertexindices;
+    cache.num_partindices = num_partindices;
+    cache.indexHash = hash;
+    cache.usable = false;
+    cache.tree.clear();
+    cache.partStart.clear();
+
+    // each triangle takes four indices, the last one may omit its terminating -1
+    if (num_vertexindices % 4 != 0 && num_vertexindices % 4 != 3) {
+        return false;
+    }
+
+    int numtriangles = (num_vertexindices + 1) / 4;
+    int numcoords = coords->getNum();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(numtriangles);
+    for (int i = 0; i < numtriangles; i++) {
+        const int32_t * triangle = vertexindices + 4 * i;
+        if (4 * i + 3 < num_vertexindices && triangle[3] >= 0) {
+            return false;
+        }
+
+        Base::BoundBox3f box;
+        for (int j = 0; j < 3; j++) {
+            if (triangle[j] < 0 || triangle[j] >= numcoords) {
+                return false;
+            }
+            const SbVec3f& v = coords->get3(triangle[j]);
+            box.Add(Base::Vector3f(v[0], v[1], v[2]));
+        }
+        boxes.push_back(box);
+    }
+
+    // the parts must cover exactly all triangles
+    const int32_t * parts = this->partIndex.getValues(0);
+    int count = 0;
+    cache.partStart.reserve(cache.num_partindices);
+    for (int i = 0; i < cache.num_partindices; i++) {
+        if (parts[i] < 0) {
+            return false;
+        }
+        cache.partStart.push_back(count);
+        count += parts[i];
+    }
+    if (count != numtriangles) {
+        return false;
+    }
+
+    cache.tree.build(std::move(boxes));
+    cache.usable = true;
+    return true;
+}
+
+void SoBrepFaceSet::rayPickTriangles(SoRayPickAction * action,
+                                     const SoCoordinateElement * coords,
+                                     const int32_t *vertexindices,
+                                     const SbVec3f *normals,
+                                     const int32_t *normindices,
+                                     Binding nbind,
+                                     Binding mbind)
+{
+    const SbLine& line = action->getLine();
+    const SbVec3f& pos = line.getPosition();
+    const SbVec3f& dir = line.getDirection();
+    Base::Vector3f base(pos[0], pos[1], pos[2]);
+    Base::Vector3f direction(dir[0], dir[1], dir[2]);
+
+    const SbVec3f dummynormal(0,0,1);
+    const std::vector<int>& partStart = pickCache->partStart;
+
+    auto cutByRay = [&base, &direction](const Base::BoundBox3f& box) {
+        return Base::BoundBoxTree::isCutByLine(box, base, direction);
+    };
+    auto pickTriangle = [&](int index) {
+        const int32_t * triangle = vertexindices + 4 * index;
+        SbVec3f v1 = coords->get3(triangle[0]);
+        SbVec3f v2 = coords->get3(triangle[1]);
+        SbVec3f v3 = coords->get3(triangle[2]);
+
+        SbVec3f intersection;
+        SbVec3f barycentric;
+        SbBool front;
+        if (!action->intersect(v1, v2, v3, intersection, barycentric, front) ||
+            !action->isBetweenPlanes(intersection)) {
+            return;
+        }
+
+        SoPickedPoint * pp = action->addIntersection(intersection);
+        if (!pp) {
+            return;
+        }
+
+        int part = static_cast<int>(std::upper_bound(partStart.begin(), partStart.end(), index)
+                                    - partStart.begin()) - 1;
+
+        SbVec3f normal = normals ? normals[0] : dummynormal;
+        if (nbind == PER_VERTEX_INDEXED) {
+            const int32_t * normal_indices = normindices + 4 * index;
+            normal = normals[normal_indices[0]] * barycentric[0] +
+                     normals[normal_indices[1]] * barycentric[1] +
+                     normals[normal_indices[2]] * barycentric[2];
+        }
+        normal.normalize();
+        pp->setObjectNormal(normal);
+        pp->setObjectTextureCoords(SbVec4f(0,0,0,1));
+        pp->setMaterialIndex(mbind == PER_PART ? part : 0);
+
+        auto detail = new SoFaceDetail();
+        detail->setFaceIndex(index);
+        detail->setPartIndex(part);
+        detail->setNumPoints(3);
+        for (int i = 0; i < 3; i++) {
+            SoPointDetail pointDetail;
+            pointDetail.setCoordinateIndex(triangle[i]);
+            if (nbind == PER_VERTEX_INDEXED) {
+                pointDetail.setNormalIndex(normindices[4 * index + i]);
+            }
+            if (mbind == PER_PART) {
+                pointDetail.setMaterialIndex(part);
+            }
+            detail->setPoint(i, &pointDetail);
+        }
+        pp->setDetail(detail, this);
+    };
+
+    pickCache->tree.search(cutByRay, pickTriangle);
+}
+
 SoDetail * SoBrepFaceSet::createTriangleDetail(SoRayPickAction * action,
                                                const SoPrimitiveVertex * v1,
                                                const SoPrimitiveVertex * v2,
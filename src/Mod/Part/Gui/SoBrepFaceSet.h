@@ -32,6 +32,7 @@
 #include <Mod/Part/PartGlobal.h>
 
 
+class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
@@ -87,6 +88,7 @@ protected:
     void GLRender(SoGLRenderAction *action) override;
     void GLRenderBelowPath(SoGLRenderAction * action) override;
     void doAction(SoAction* action) override;
+    void rayPick(SoRayPickAction *action) override;
     SoDetail * createTriangleDetail(
         SoRayPickAction * action,
         const SoPrimitiveVertex * v1,
@@ -134,6 +136,17 @@ private:
 
     bool overrideMaterialBinding(SoGLRenderAction *action, SelContextPtr ctx, SelContextPtr ctx2);
 
+    bool updatePickCache(const SoCoordinateElement * coords,
+                         const int32_t *vertexindices,
+                         int num_vertexindices);
+    void rayPickTriangles(SoRayPickAction * action,
+                          const SoCoordinateElement * coords,
+                          const int32_t *vertexindices,
+                          const SbVec3f *normals,
+                          const int32_t *normindices,
+                          Binding nbind,
+                          Binding mbind);
+
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
     void renderColoredArray(SoMaterialBundle *const materials);
@@ -154,6 +167,10 @@ private:
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
+
+    // Bounding box tree of the triangles to speed up picking
+    struct PickCache;
+    std::unique_ptr<PickCache> pickCache;
 };
 
 } // namespace PartGui
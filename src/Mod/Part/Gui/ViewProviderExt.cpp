@@ -82,6 +82,7 @@
 #include <Gui/SoFCSelectionAction.h>
 #include <Gui/SoFCUnifiedSelection.h>
 #include <Gui/ViewParams.h>
+#include <Mod/Part/App/MeshHelper.h>
 #include <Mod/Part/App/ShapeMapHasher.h>
 #include <Mod/Part/App/Tools.h>
 
@@ -127,6 +128,7 @@ ViewProviderPartExt::ViewProviderPartExt()
     texture.initExtension(this);
 
     VisualTouched = true;
+    TessellationChanged = false;
     forceUpdateCount = 0;
     NormalsFromUV = true;
 
@@ -287,12 +289,14 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     // to freeze the GUI
     // https://forum.freecad.org/viewtopic.php?f=3&t=24912&p=195613
     if (prop == &Deviation) {
+        TessellationChanged = true;
         if(isUpdateForced()||Visibility.getValue())
             updateVisual();
         else
             VisualTouched = true;
     }
     if (prop == &AngularDeflection) {
+        TessellationChanged = true;
         if(isUpdateForced()||Visibility.getValue())
             updateVisual();
         else
@@ -970,18 +974,8 @@ void ViewProviderPartExt::updateVisual()
 
     try {
         // calculating the deflection value
-        Bnd_Box bounds;
-        BRepBndLib::Add(cShape, bounds);
-        bounds.SetGap(0.0);
-        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
-        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
-        Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * Deviation.getValue();
-
-        // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
-        // should be displayed.
-        if (deflection < gp::Resolution()) {
-            deflection = Precision::Confusion();
-        }
+        Standard_Real deflection =
+            Part::MeshHelper::relativeDeflection(cShape, Deviation.getValue());
 
         // For very big objects the computed deflection can become very high and thus leads to a useless
         // tessellation. To avoid this the upper limit is set to 20.0
@@ -991,18 +985,10 @@ void ViewProviderPartExt::updateVisual()
         // create or use the mesh on the data structure
         Standard_Real AngDeflectionRads = AngularDeflection.getValue() / 180.0 * M_PI;
 
-#if OCC_VERSION_HEX >= 0x070500
-        IMeshTools_Parameters meshParams;
-        meshParams.Deflection = deflection;
-        meshParams.Relative = Standard_False;
-        meshParams.Angle = AngDeflectionRads;
-        meshParams.InParallel = Standard_True;
-        meshParams.AllowQualityDecrease = Standard_True;
-
-        BRepMesh_IncrementalMesh(cShape, meshParams);
-#else
-        BRepMesh_IncrementalMesh(cShape, deflection, Standard_False, AngDeflectionRads, Standard_True);
-#endif
+        // A finer triangulation, e.g. made for an export, is kept unless the user changed the
+        // tessellation settings of the object
+        Part::MeshHelper::mesh(cShape, deflection, AngDeflectionRads, TessellationChanged);
+        TessellationChanged = false;
 
         // We must reset the location here because the transformation data
         // are set in the placement property
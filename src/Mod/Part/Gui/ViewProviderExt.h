@@ -185,6 +185,7 @@ protected:
     SoBrepPointSet    * nodeset;
 
     bool VisualTouched;
+    bool TessellationChanged;
     bool NormalsFromUV;
 
 private:
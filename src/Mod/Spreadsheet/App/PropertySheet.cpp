@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <deque>
 
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm/copy.hpp>
@@ -73,6 +74,8 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellToProviderMap.clear();
+    cellToDependantMap.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -289,6 +292,8 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellToProviderMap(other.cellToProviderMap)
+    , cellToDependantMap(other.cellToDependantMap)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -1386,6 +1391,15 @@ void PropertySheet::addDependencies(CellAddress key)
                 propertyNameToCellMap[propName].insert(key);
                 cellToPropertyNameMap[key].insert(propName);
 
+                // A cell of this sheet?
+                if (docObj == owner && !name.empty()) {
+                    CellAddress addr = getCellAddress(name.c_str(), true);
+                    if (addr.isValid()) {
+                        cellToProviderMap[key].insert(addr);
+                        cellToDependantMap[addr].insert(key);
+                    }
+                }
+
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom(Sheet::getClassTypeId())) {
                     auto other = static_cast<Sheet*>(docObj);
@@ -1462,6 +1476,26 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToDocumentObjectMap.erase(i2);
         ++updateCount;
     }
+
+    /* Remove from the cell graph */
+
+    auto i3 = cellToProviderMap.find(key);
+
+    if (i3 != cellToProviderMap.end()) {
+        for (const auto& provider : i3->second) {
+            auto k = cellToDependantMap.find(provider);
+
+            if (k != cellToDependantMap.end()) {
+                k->second.erase(key);
+
+                if (k->second.empty()) {
+                    cellToDependantMap.erase(k);
+                }
+            }
+        }
+
+        cellToProviderMap.erase(i3);
+    }
 }
 
 /**
@@ -1654,6 +1688,104 @@ void PropertySheet::recomputeDependencies(CellAddress key)
     signaller.tryInvoke();
 }
 
+void PropertySheet::getRecomputeLevels(const std::set<CellAddress>& cells,
+                                       std::vector<std::vector<CellAddress>>& levels,
+                                       std::set<CellAddress>& cyclic) const
+{
+    static const std::set<CellAddress> none;
+    auto getDependants = [this](CellAddress address) -> const std::set<CellAddress>& {
+        auto it = cellToDependantMap.find(address);
+        return it != cellToDependantMap.end() ? it->second : none;
+    };
+
+    // Collect the cells to recompute together with the number of their providers among them
+    std::map<CellAddress, int> pending;
+    std::deque<CellAddress> workQueue;
+    for (const auto& address : cells) {
+        pending.emplace(address, 0);
+        workQueue.push_back(address);
+    }
+    while (!workQueue.empty()) {
+        for (const auto& dep : getDependants(workQueue.front())) {
+            if (pending.emplace(dep, 0).second) {
+                workQueue.push_back(dep);
+            }
+        }
+        workQueue.pop_front();
+    }
+    for (const auto& v : pending) {
+        for (const auto& dep : getDependants(v.first)) {
+            ++pending[dep];
+        }
+    }
+
+    // Sort them level by level, starting with the cells whose providers are up to date
+    std::vector<CellAddress> level;
+    for (const auto& v : pending) {
+        if (v.second == 0) {
+            level.push_back(v.first);
+        }
+    }
+    while (!level.empty()) {
+        std::vector<CellAddress> next;
+        for (const auto& address : level) {
+            for (const auto& dep : getDependants(address)) {
+                if (--pending[dep] == 0) {
+                    next.push_back(dep);
+                }
+            }
+        }
+        std::sort(next.begin(), next.end());
+        levels.push_back(std::move(level));
+        level = std::move(next);
+    }
+
+    // The remaining cells wait for a cyclic dependency
+    for (const auto& v : pending) {
+        if (v.second > 0) {
+            cyclic.insert(v.first);
+        }
+    }
+}
+
+void PropertySheet::removeDependantsOfCycles(std::set<CellAddress>& cyclic) const
+{
+    // Remove the cells that no other remaining cell depends on, until only cycles are left
+    std::map<CellAddress, int> dependants;
+    for (const auto& address : cyclic) {
+        int count = 0;
+        auto it = cellToDependantMap.find(address);
+        if (it != cellToDependantMap.end()) {
+            for (const auto& dep : it->second) {
+                count += cyclic.count(dep);
+            }
+        }
+        dependants[address] = count;
+    }
+
+    std::deque<CellAddress> workQueue;
+    for (const auto& v : dependants) {
+        if (v.second == 0) {
+            workQueue.push_back(v.first);
+        }
+    }
+    while (!workQueue.empty()) {
+        CellAddress address = workQueue.front();
+        workQueue.pop_front();
+        cyclic.erase(address);
+
+        auto it = cellToProviderMap.find(address);
+        if (it != cellToProviderMap.end()) {
+            for (const auto& provider : it->second) {
+                auto k = dependants.find(provider);
+                if (k != dependants.end() && --k->second == 0) {
+                    workQueue.push_back(provider);
+                }
+            }
+        }
+    }
+}
+
 void PropertySheet::hasSetValue()
 {
     if (updateCount == 0 || !owner || !owner->isAttachedToDocument() || owner->isRestoring()
@@ -24,6 +24,8 @@
 #define PROPERTYSHEET_H
 
 #include <map>
+#include <set>
+#include <vector>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -202,6 +204,18 @@ public:
 
     void recomputeDependencies(App::CellAddress key);
 
+    /** Sorts \a cells and the cells of this sheet depending on them into levels for
+     * recomputing. A cell only depends on cells of lower levels, i.e. the cells of a level do
+     * not depend on each other. Cells that are part of a cyclic dependency or depend on one are
+     * returned in \a cyclic instead.
+     */
+    void getRecomputeLevels(const std::set<App::CellAddress>& cells,
+                            std::vector<std::vector<App::CellAddress>>& levels,
+                            std::set<App::CellAddress>& cyclic) const;
+
+    /// Removes the cells from \a cyclic that only depend on a cyclic dependency
+    void removeDependantsOfCycles(std::set<App::CellAddress>& cyclic) const;
+
     PyObject* getPyObject() override;
     void setPyObject(PyObject*) override;
 
@@ -322,6 +336,12 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Cells of this sheet that the cell given in key depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToProviderMap;
+
+    /*! Cells of this sheet depending on the cell given in key */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToDependantMap;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -24,7 +24,6 @@
 
 #ifndef _PreComp_
 #include <boost/tokenizer.hpp>
-#include <deque>
 #include <memory>
 #include <sstream>
 #endif
@@ -52,19 +51,6 @@ using namespace Spreadsheet;
 
 PROPERTY_SOURCE(Spreadsheet::Sheet, App::DocumentObject)
 
-using DependencyList = boost::adjacency_list<
-    boost::vecS,         // class OutEdgeListS  : a Sequence or an AssociativeContainer
-    boost::vecS,         // class VertexListS   : a Sequence or a RandomAccessContainer
-    boost::directedS,    // class DirectedS     : This is a directed graph
-    boost::no_property,  // class VertexProperty:
-    boost::no_property,  // class EdgeProperty:
-    boost::no_property,  // class GraphProperty:
-    boost::listS         // class EdgeListS:
-    >;
-using Traits = boost::graph_traits<DependencyList>;
-using Vertex = Traits::vertex_descriptor;
-using Edge = Traits::edge_descriptor;
-
 /**
  * Construct a new Sheet object.
  */
@@ -1037,124 +1023,53 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
-    std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
-    while (!workQueue.empty()) {
-        CellAddress currPos = workQueue.front();
-        workQueue.pop_front();
-
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
+    // Sort the cells into levels, each only depending on the cells of the levels before
+    std::vector<std::vector<CellAddress>> levels;
+    std::set<CellAddress> cyclic;
+    cells.getRecomputeLevels(dirtyCells, levels, cyclic);
 
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
-                }
-            }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
-        }
-    }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
-        // Recompute cells
-        FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
+    // Recompute cells
+    FC_LOG("recomputing " << getFullName());
+    for (const auto& level : levels) {
+        for (const auto& addr : level) {
             FC_TRACE(addr.toString());
             recomputeCell(addr);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
-            Cell* cell = cells.getValue(v.first);
+
+    if (!cyclic.empty()) {
+        for (const auto& addr : cyclic) {
+            Cell* cell = cells.getValue(addr);
             // Mark as erroneous
             if (cell) {
-                cellErrors.insert(v.first);
+                cellErrors.insert(addr);
                 cell->setException("Pending computation due to cyclic dependency", true);
-                cellUpdated(v.first);
+                cellUpdated(addr);
             }
         }
 
-        // Try to be more user friendly by finding individual loops
-        while (!dirtyCells.empty()) {
-
-            std::deque<CellAddress> workQueue;
-            DependencyList graph;
-            std::map<CellAddress, Vertex> VertexList;
-            std::map<Vertex, CellAddress> VertexIndexList;
-
-            CellAddress currentAddr = *dirtyCells.begin();
-            workQueue.push_back(currentAddr);
-            dirtyCells.erase(dirtyCells.begin());
-
-            while (!workQueue.empty()) {
-                CellAddress currPos = workQueue.front();
-                workQueue.pop_front();
-
-                // Insert into map of CellPos -> Index, if it doesn't exist already
-                auto res = VertexList.emplace(currPos, Vertex());
-                if (res.second) {
-                    res.first->second = add_vertex(graph);
-                    VertexIndexList[res.first->second] = currPos;
-                }
-
-                // Process cells that depend on the current cell
-                for (auto& dep : providesTo(currPos)) {
-                    auto resDep = VertexList.emplace(dep, Vertex());
-                    if (resDep.second) {
-                        resDep.first->second = add_vertex(graph);
-                        VertexIndexList[resDep.first->second] = dep;
-                        workQueue.push_back(dep);
-                        dirtyCells.erase(dep);
-                    }
-                    // Add edge to graph to signal dependency
-                    add_edge(res.first->second, resDep.first->second, graph);
-                }
+        // Try to be more user friendly by only reporting the cells of the loops
+        cells.removeDependantsOfCycles(cyclic);
+        Base::Console().Error("Cyclic dependency detected in spreadsheet : %s\n",
+                              *pcNameInDocument);
+        std::ostringstream ss;
+        ss << "Cyclic dependency";
+        int count = 0;
+        for (const auto& addr : cyclic) {
+            if (count++ % 20 == 0) {
+                ss << std::endl;
             }
-
-            std::list<Vertex> make_order;
-            try {
-                boost::topological_sort(graph, std::front_inserter(make_order));
+            else {
+                ss << ", ";
             }
-            catch (std::exception&) {  // TODO: evaluate using a more specific exception (not_a_dag)
-                // Cycle detected; flag all with errors
-                Base::Console().Error("Cyclic dependency detected in spreadsheet : %s\n",
-                                      *pcNameInDocument);
-                std::ostringstream ss;
-                ss << "Cyclic dependency";
-                int count = 0;
-                for (auto& v : VertexList) {
-                    if (count++ % 20 == 0) {
-                        ss << std::endl;
-                    }
-                    else {
-                        ss << ", ";
-                    }
-                    ss << v.first.toString();
-                }
-                std::string msg = ss.str();
-                for (auto& v : VertexList) {
-                    Cell* cell = cells.getValue(v.first);
-                    if (cell) {
-                        cell->setException(msg.c_str(), true);
-                        cellUpdated(v.first);
-                    }
-                }
+            ss << addr.toString();
+        }
+        std::string msg = ss.str();
+        for (const auto& addr : cyclic) {
+            Cell* cell = cells.getValue(addr);
+            if (cell) {
+                cell->setException(msg.c_str(), true);
+                cellUpdated(addr);
             }
         }
     }
@@ -1135,6 +1135,37 @@ class SpreadsheetCases(unittest.TestCase):
         sheet.set("A3", "A1")
         self.assertEqual(sheet.getContents("A3"), "'A1")
 
+    def testRecomputeChain(self):
+        """Cells are recomputed after the cells they depend on, also when only some changed"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        sheet.set("A1", "1")
+        for row in range(2, 101):
+            sheet.set("A{}".format(row), "=A{} + 1".format(row - 1))
+            sheet.set("B{}".format(row), "=A{} + A1".format(row))
+        self.doc.recompute()
+        self.assertEqual(sheet.A100, 100)
+        self.assertEqual(sheet.B100, 101)
+        sheet.set("A50", "0")
+        self.doc.recompute()
+        self.assertEqual(sheet.A100, 50)
+        self.assertEqual(sheet.B100, 51)
+        self.assertEqual(sheet.B49, 50)
+
+    def testCyclicDependency(self):
+        """Cells not depending on a cyclic dependency are still computed"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        sheet.set("A1", "=B1 + 1")
+        sheet.set("B1", "=A1 + 1")
+        sheet.set("C1", "=A1 + 1")
+        sheet.set("D1", "1")
+        sheet.set("E1", "=D1 * 2")
+        self.doc.recompute()
+        self.assertEqual(sheet.E1, 2)
+        sheet.set("B1", "5")
+        self.doc.recompute()
+        self.assertEqual(sheet.A1, 6)
+        self.assertEqual(sheet.C1, 7)
+
     def testInsertRowsAlias(self):
         """Regression test for issue 4429; insert rows to sheet with aliases"""
         sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
@@ -118,6 +118,7 @@
 #include <Mod/Part/App/PartFeature.h>
 
 #include "DrawComplexSection.h"
+#include "DrawPage.h"
 #include "DrawUtil.h"
 #include "GeometryObject.h"
 #include "ShapeUtils.h"
@@ -285,13 +286,17 @@ void DrawComplexSection::makeSectionCut(const TopoDS_Shape& baseShape)
     try {
         connectAlignWatcher =
             QObject::connect(&m_alignWatcher, &QFutureWatcherBase::finished, &m_alignWatcher,
-                             [this] { this->onSectionCutFinished(); });
+                             [this] {
+                                 if (this->waitingForCut()) {
+                                     this->onSectionCutFinished();
+                                 }
+                             });
 
         // We create a lambda closure to hold a copy of baseShape.
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
-        m_alignFuture = QtConcurrent::run(std::move(lambda));
+        m_alignFuture = QtConcurrent::run(DrawPage::viewThreadPool(), std::move(lambda));
         m_alignWatcher.setFuture(m_alignFuture);
         waitingForAlign(true);
     }
@@ -314,11 +319,22 @@ void DrawComplexSection::onSectionCutFinished()
         return;
     }
 
+    waitingForAlign(false);
     DrawViewSection::onSectionCutFinished();
 
     QObject::disconnect(connectAlignWatcher);
 }
 
+bool DrawComplexSection::finishPendingTasks()
+{
+    if (waitingForCut()) {
+        //the alignment task is started by the cut task, so it is known once the cut is done
+        m_cutFuture.waitForFinished();
+        m_alignFuture.waitForFinished();
+    }
+    return DrawViewSection::finishPendingTasks();
+}
+
 //for Aligned strategy, cut the rawShape by each segment of the tool
 //TODO: this process should replace the "makeSectionCut" from DVS
 void DrawComplexSection::makeAlignedPieces(const TopoDS_Shape& rawShape)
@@ -614,10 +630,15 @@ TopoDS_Compound DrawComplexSection::singleToolIntersections(const TopoDS_Shape&
         return result;
     }
 
+    //the box of the tool is the same for all the faces
+    Bnd_Box toolBox;
+    BRepBndLib::Add(m_toolFaceShape, toolBox);
+    toolBox.SetGap(0.1);
+
     TopExp_Explorer expFaces(cutShape, TopAbs_FACE);
     for (; expFaces.More(); expFaces.Next()) {
         TopoDS_Face face = TopoDS::Face(expFaces.Current());
-        if (!boxesIntersect(face, m_toolFaceShape)) {
+        if (!boxesIntersect(face, toolBox)) {
             continue;
         }
         std::vector<TopoDS_Face> commonFaces = faceShapeIntersect(face, m_toolFaceShape);
@@ -649,10 +670,14 @@ TopoDS_Compound DrawComplexSection::alignedToolIntersections(const TopoDS_Shape&
                                    -Precision::Infinite(), Precision::Infinite());
     TopoDS_Face cuttingFace = mkFace.Face();
 
+    Bnd_Box cuttingBox;
+    BRepBndLib::Add(cuttingFace, cuttingBox);
+    cuttingBox.SetGap(0.1);
+
     TopExp_Explorer expFaces(cutShape, TopAbs_FACE);
     for (; expFaces.More(); expFaces.Next()) {
         TopoDS_Face face = TopoDS::Face(expFaces.Current());
-        if (!boxesIntersect(face, cuttingFace)) {
+        if (!boxesIntersect(face, cuttingBox)) {
             continue;
         }
         std::vector<TopoDS_Face> commonFaces = faceShapeIntersect(face, cuttingFace);
@@ -1155,12 +1180,19 @@ gp_Dir DrawComplexSection::getFaceNormal(TopoDS_Face& face)
 
 bool DrawComplexSection::boxesIntersect(TopoDS_Face& face, TopoDS_Shape& shape)
 {
-    Bnd_Box box0, box1;
-    BRepBndLib::Add(face, box0);
-    box0.SetGap(0.1);//generous
+    Bnd_Box box1;
     BRepBndLib::Add(shape, box1);
     box1.SetGap(0.1);
-    if (box0.IsOut(box1)) {
+    return boxesIntersect(face, box1);
+}
+
+//box is the already enlarged box of the other shape
+bool DrawComplexSection::boxesIntersect(TopoDS_Face& face, const Bnd_Box& box)
+{
+    Bnd_Box box0;
+    BRepBndLib::Add(face, box0);
+    box0.SetGap(0.1);//generous
+    if (box0.IsOut(box)) {
         return false;//boxes don't intersect
     }
     return true;
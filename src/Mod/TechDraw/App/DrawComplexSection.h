@@ -32,6 +32,8 @@
 
 #include "DrawViewSection.h"
 
+class Bnd_Box;
+
 namespace TechDraw
 {
 
@@ -58,6 +60,7 @@ public:
     std::pair<Base::Vector3d, Base::Vector3d> sectionLineEnds() override;
 
     void makeSectionCut(const TopoDS_Shape& baseShape) override;
+    bool finishPendingTasks() override;
 
     void waitingForAlign(bool s) { m_waitingForAlign = s; }
     bool waitingForAlign(void) const { return m_waitingForAlign; }
@@ -68,6 +71,7 @@ public Q_SLOTS:
     void onSectionCutFinished(void) override;
 
     bool boxesIntersect(TopoDS_Face& face, TopoDS_Shape& shape);
+    bool boxesIntersect(TopoDS_Face& face, const Bnd_Box& box);
     TopoDS_Shape shapeShapeIntersect(const TopoDS_Shape& shape0, const TopoDS_Shape& shape1);
     std::vector<TopoDS_Face> faceShapeIntersect(const TopoDS_Face& face, const TopoDS_Shape& shape);
     TopoDS_Shape extrudeWireToFace(TopoDS_Wire& wire, gp_Dir extrudeDir, double extrudeDist);
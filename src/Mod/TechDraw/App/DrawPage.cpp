@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <sstream>
+# include <QThread>
+# include <QThreadPool>
 
 # include <Precision.hxx>
 #endif
@@ -361,6 +363,41 @@ void DrawPage::updateAllViews()
     }
 }
 
+//! wait until the background tasks of all the views on this page have finished. The follow up
+//! processing of the views (dimensions, balloons, faces, ...) is run directly instead of through
+//! the event loop, so this also works in FreeCADCmd where there is no event loop.
+void DrawPage::waitForViews()
+{
+    //finishing one stage may start the next one (section cut -> HLR -> faces), so repeat until
+    //no view has anything left to do
+    bool pending = true;
+    while (pending) {
+        pending = false;
+        for (auto& v : getAllViews()) {
+            auto* part = dynamic_cast<DrawViewPart*>(v);
+            if (part && part->finishPendingTasks()) {
+                pending = true;
+            }
+        }
+    }
+}
+
+//! the thread pool shared by the background tasks of all views. The HLR runs of the views on a
+//! page are started during the recompute and run concurrently, up to the number of threads of
+//! this pool. Follow up work for a view starts as soon as its own tasks are finished.
+QThreadPool* DrawPage::viewThreadPool()
+{
+    static QThreadPool pool;
+    int maxThreads = Preferences::maxParallelViews();
+    if (maxThreads <= 0) {
+        maxThreads = QThread::idealThreadCount();
+    }
+    if (pool.maxThreadCount() != maxThreads) {
+        pool.setMaxThreadCount(maxThreads);
+    }
+    return &pool;
+}
+
 std::vector<App::DocumentObject*> DrawPage::getViews() const
 {
     std::vector<App::DocumentObject*> views = Views.getValues();
@@ -31,6 +31,7 @@
 
 #include "DrawViewPart.h"
 
+class QThreadPool;
 
 namespace TechDraw
 {
@@ -97,6 +98,8 @@ public:
     int getNextBalloonIndex();
 
     void updateAllViews();
+    void waitForViews();
+    static QThreadPool* viewThreadPool();
     static bool GlobalUpdateDrawings();
     static bool AllowPageOverride();
     void forceRedraw(bool b) { m_forceRedraw = b; }
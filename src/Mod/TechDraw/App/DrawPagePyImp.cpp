@@ -153,6 +153,21 @@ PyObject* DrawPagePy::requestPaint(PyObject* args)
     Py_Return;
 }
 
+PyObject* DrawPagePy::waitForViews(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY {
+        DrawPage* page = getDrawPagePtr();
+        page->waitForViews();
+    }
+    PY_CATCH;
+
+    Py_Return;
+}
+
 //! replace the current Label with a translated version
 PyObject* DrawPagePy::translateLabel(PyObject *args)
 {
@@ -441,9 +441,40 @@ std::vector<TopoDS_Edge> DrawProjectSplit::scrubEdges(std::vector<TopoDS_Edge>&
         return openEdges;
     }
 
+    //an edge whose box touches no other box can not be split or joined by the fuse. If it is
+    //closed it is a face boundary on its own, otherwise it would be pruned as unconnected
+    //anyway, so there is no need to feed it to the general fuse.
+    std::vector<Bnd_Box> boxes = edgeBoxes(origEdges);
+    std::vector<std::vector<int>> overlaps = overlappingBoxes(boxes);
+    std::vector<bool> isolated(origEdges.size(), true);
+    for (size_t iEdge = 0; iEdge < overlaps.size(); iEdge++) {
+        for (int other : overlaps.at(iEdge)) {
+            isolated.at(iEdge) = false;
+            isolated.at(other) = false;
+        }
+    }
+
     TopTools_ListOfShape edgeList;
-    for (auto edge : origEdges) {
-        edgeList.Append(edge);
+    std::vector<TopoDS_Edge> isolatedClosed;
+    for (size_t iEdge = 0; iEdge < origEdges.size(); iEdge++) {
+        TopoDS_Edge& edge = origEdges.at(iEdge);
+        TopoDS_Vertex first = TopExp::FirstVertex(edge);
+        TopoDS_Vertex last = TopExp::LastVertex(edge);
+        if (isolated.at(iEdge) && BRep_Tool::IsClosed(edge)) {
+            isolatedClosed.push_back(edge);
+        }
+        else if (!isolated.at(iEdge) || DrawUtil::vertexEqual(first, last)) {
+            //the fuse merges the coincident ends of an isolated edge into a closed edge
+            edgeList.Append(edge);
+        }
+    }
+    if (edgeList.Size() < 2) {
+        //the general fuse needs at least 2 edges, so use them all as before
+        edgeList.Clear();
+        for (auto& edge : origEdges) {
+            edgeList.Append(edge);
+        }
+        isolatedClosed.clear();
     }
 
     BOPAlgo_Builder bopBuilder;
@@ -475,6 +506,8 @@ std::vector<TopoDS_Edge> DrawProjectSplit::scrubEdges(std::vector<TopoDS_Edge>&
         Base::Console().Warning("DrawProjectSplit::scrubEdges - OCC fuse raised warning(s):\n%s\n", warnStr.c_str());
     }
 
+    closedEdges.insert(closedEdges.end(), isolatedClosed.begin(), isolatedClosed.end());
+
     const TopoDS_Shape &bopResult = bopBuilder.Shape();
     if (!bopResult.IsNull()) {
         for (TopExp_Explorer explorer(bopResult, TopAbs_EDGE); explorer.More(); explorer.Next()) {
@@ -591,18 +624,19 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> outEdges;
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
+    //only pairs of edges with overlapping boxes need the expensive common operation
+    std::vector<std::vector<int>> candidates = overlappingBoxes(edgeBoxes(inEdges));
     int edgeCount = inEdges.size();
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
+        for (int ie1 : candidates.at(ie0)) {
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
-            int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
+            int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1), false);
             if (rc == e0ISSUBSET) {
                 skipThisEdge.at(ie0) = true;
                 break;      //stop checking ie0
@@ -638,9 +672,10 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
 }
 
 //determine if edge0 & edge1 are superimposed, and classify the type of overlap
-int DrawProjectSplit::isSubset(const TopoDS_Edge &edge0, const TopoDS_Edge &edge1)
+//checkBoxes can be false if the caller already knows that the boxes of the edges intersect
+int DrawProjectSplit::isSubset(const TopoDS_Edge &edge0, const TopoDS_Edge &edge1, bool checkBoxes)
 {
-    if (!boxesIntersect(edge0, edge1)) {
+    if (checkBoxes && !boxesIntersect(edge0, edge1)) {
         return NOTASUBSET;      //boxes don't intersect, so edges do not overlap
     }
 
@@ -715,6 +750,72 @@ bool DrawProjectSplit::boxesIntersect(const TopoDS_Edge &edge0, const TopoDS_Edg
     return true;
 }
 
+//make the boxes of the edges, with the same generous gap as boxesIntersect()
+std::vector<Bnd_Box> DrawProjectSplit::edgeBoxes(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<Bnd_Box> boxes;
+    boxes.reserve(edges.size());
+    for (auto& edge : edges) {
+        Bnd_Box box;
+        BRepBndLib::Add(edge, box);
+        box.SetGap(0.1);
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+//find all pairs of intersecting boxes by sweeping along X. Instead of comparing every box
+//with every other box, a box is only compared with the boxes whose X range is still open
+//at its start. The result holds, for each box, the ascending indexes of the later boxes it
+//intersects.
+std::vector<std::vector<int>> DrawProjectSplit::overlappingBoxes(const std::vector<Bnd_Box>& boxes)
+{
+    struct XRange {
+        double xMin;
+        double xMax;
+        int index;
+    };
+
+    std::vector<XRange> ranges;
+    ranges.reserve(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        if (boxes.at(i).IsVoid()) {
+            continue;   //a void box does not intersect anything
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        boxes.at(i).Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        ranges.push_back({xMin, xMax, int(i)});
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const XRange& r0, const XRange& r1) {
+        return r0.xMin < r1.xMin;
+    });
+
+    std::vector<std::vector<int>> result(boxes.size());
+    std::vector<XRange> active;
+    for (auto& range : ranges) {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&range](const XRange& open) {
+                                        return open.xMax < range.xMin;
+                                    }),
+                     active.end());
+        const Bnd_Box& box = boxes.at(range.index);
+        for (auto& open : active) {
+            if (box.IsOut(boxes.at(open.index))) {
+                continue;
+            }
+            int first = std::min(open.index, range.index);
+            int second = std::max(open.index, range.index);
+            result.at(first).push_back(second);
+        }
+        active.push_back(range);
+    }
+
+    for (auto& indexes : result) {
+        std::sort(indexes.begin(), indexes.end());
+    }
+    return result;
+}
+
 //this is an aid to debugging and isn't used in normal processing.
 void DrawProjectSplit::dumpVertexMap(vertexMap verts)
 {
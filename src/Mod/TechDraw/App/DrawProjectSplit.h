@@ -34,6 +34,7 @@
 #include "Geometry.h"
 
 
+class Bnd_Box;
 class gp_Pnt;
 class gp_Ax2;
 
@@ -125,11 +126,14 @@ public:
     static bool                     sameEndPoints(const TopoDS_Edge& e1,
                                                   const TopoDS_Edge& e2);
     static int                      isSubset(const TopoDS_Edge &e0,
-                                             const TopoDS_Edge &e1);
+                                             const TopoDS_Edge &e1,
+                                             bool checkBoxes = true);
     static std::vector<TopoDS_Edge> fuseEdges(const TopoDS_Edge& e0,
                                               const TopoDS_Edge& e1);
     static bool                     boxesIntersect(const TopoDS_Edge& e0,
                                                    const TopoDS_Edge& e1);
+    static std::vector<Bnd_Box>     edgeBoxes(const std::vector<TopoDS_Edge>& edges);
+    static std::vector<std::vector<int>> overlappingBoxes(const std::vector<Bnd_Box>& boxes);
     static void dumpVertexMap(vertexMap verts);
 
 };
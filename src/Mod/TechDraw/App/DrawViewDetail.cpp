@@ -55,6 +55,7 @@
 #include <Base/Parameter.h>
 
 #include "DrawComplexSection.h"
+#include "DrawPage.h"
 #include "DrawUtil.h"
 #include "DrawViewDetail.h"
 #include "DrawViewSection.h"
@@ -194,14 +195,18 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
     //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
     connectDetailWatcher =
         QObject::connect(&m_detailWatcher, &QFutureWatcherBase::finished, &m_detailWatcher,
-                         [this] { this->onMakeDetailFinished(); });
+                         [this] {
+                             if (this->waitingForDetail()) {
+                                 this->onMakeDetailFinished();
+                             }
+                         });
 
     // We create a lambda closure to hold a copy of shape.
     // This is important because this variable might be local to the calling
     // function and might get destructed before the parallel processing finishes.
     // TODO: What about dvp and dvs? Do they live past makeDetailShape?
     auto lambda = [this, shape, dvp, dvs]{this->makeDetailShape(shape, dvp, dvs);};
-    m_detailFuture = QtConcurrent::run(std::move(lambda));
+    m_detailFuture = QtConcurrent::run(DrawPage::viewThreadPool(), std::move(lambda));
     m_detailWatcher.setFuture(m_detailFuture);
     waitingForDetail(true);
 }
@@ -415,6 +420,16 @@ bool DrawViewDetail::waitingForResult() const
     }
     return false;
 }
+
+bool DrawViewDetail::finishPendingTasks()
+{
+    if (waitingForDetail()) {
+        m_detailFuture.waitForFinished();
+        onMakeDetailFinished();
+        return true;
+    }
+    return DrawViewPart::finishPendingTasks();
+}
 TopoDS_Shape DrawViewDetail::projectEdgesOntoFace(TopoDS_Shape& edgeShape, TopoDS_Face& projFace,
                                                   gp_Dir& projDir)
 {
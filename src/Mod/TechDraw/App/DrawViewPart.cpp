@@ -306,8 +306,11 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     // if we use the passed reference directly, the centering doesn't work.  Maybe the underlying OCC TShape
     // isn't modified?  using a copy works and the referenced shape (from getSourceShape in execute())
     // isn't used for anything anyway.
+    // The coarse view keeps the tessellation of the source through the copy and the transforms in
+    // centerScaleRotate(), so the polygon HLR can reuse it instead of meshing the shape again.
+    // With OCC before 7.6 the scaling and rotation drop it and the HLR meshes the shape.
     bool copyGeometry = true;
-    bool copyMesh = false;
+    bool copyMesh = CoarseView.getValue();
     BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
     TopoDS_Shape localShape = copier.Shape();
 
@@ -328,10 +331,13 @@ TopoDS_Shape DrawViewPart::centerScaleRotate(const DrawViewPart *dvp, TopoDS_Sha
     //center shape on origin
     TopoDS_Shape centeredShape = ShapeUtils::moveShape(inOutShape, centroid * -1.0);
 
-    inOutShape = ShapeUtils::scaleShape(centeredShape, dvp->getScale());
+    // keep the tessellation for the polygon HLR of the coarse view
+    bool copyMesh = dvp->CoarseView.getValue();
+    inOutShape = ShapeUtils::scaleShape(centeredShape, dvp->getScale(), copyMesh);
     if (!DrawUtil::fpCompare(dvp->Rotation.getValue(), 0.0)) {
+        //conventional rotation
         inOutShape = ShapeUtils::rotateShape(inOutShape, viewAxis,
-                                           dvp->Rotation.getValue());//conventional rotation
+                                           dvp->Rotation.getValue(), copyMesh);
     }
     //    BRepTools::Write(inOutShape, "DVPScaled.brep");            //debug
     return centeredShape;
@@ -343,6 +349,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
 {
 //    Base::Console().Message("DVP::buildGeometryObject() - %s\n", getNameInDocument());
     showProgressMessage(getNameInDocument(), "is finding hidden lines");
+    m_hlrStart.setCurrent();
 
     TechDraw::GeometryObjectPtr go(
         std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
@@ -362,14 +369,19 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
         //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
         //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
+        //the finished signal is ignored if finishPendingTasks() has already done the work
         connectHlrWatcher = QObject::connect(&m_hlrWatcher, &QFutureWatcherBase::finished,
-                                             &m_hlrWatcher, [this] { this->onHlrFinished(); });
+                                             &m_hlrWatcher, [this] {
+                                                 if (this->waitingForHlr()) {
+                                                     this->onHlrFinished();
+                                                 }
+                                             });
 
         // We create a lambda closure to hold a copy of go, shape and viewAxis.
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
+        m_hlrFuture = QtConcurrent::run(DrawPage::viewThreadPool(), std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
     }
@@ -401,6 +413,10 @@ void DrawViewPart::onHlrFinished()
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
     showProgressMessage(getNameInDocument(), "has finished finding hidden lines");
+    if (Preferences::reportTiming()) {
+        Base::Console().Message("TechDraw: %s hidden line removal took %.3f s\n",
+                                getNameInDocument(), Base::TimeElapsed::diffTimeF(m_hlrStart));
+    }
 
     postHlrTasks();//application level tasks that depend on HLR/GO being complete
 
@@ -413,10 +429,14 @@ void DrawViewPart::onHlrFinished()
             //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
             connectFaceWatcher =
                 QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
-                                 [this] { this->onFacesFinished(); });
+                                 [this] {
+                                     if (this->waitingForFaces()) {
+                                         this->onFacesFinished();
+                                     }
+                                 });
 
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
+            m_faceFuture = QtConcurrent::run(DrawPage::viewThreadPool(), std::move(lambda));
             m_faceWatcher.setFuture(m_faceFuture);
             waitingForFaces(true);
         }
@@ -495,6 +515,9 @@ void DrawViewPart::extractFaces()
     }
 
     showProgressMessage(getNameInDocument(), "is extracting faces");
+    m_faceStart.setCurrent();
+    m_scrubTime = 0.0F;
+    m_wireTime = 0.0F;
 
     const std::vector<TechDraw::BaseGeomPtr>& goEdges =
         geometryObject->getVisibleFaceEdges(SmoothVisible.getValue(), SeamVisible.getValue());
@@ -514,8 +537,11 @@ void DrawViewPart::extractFaces()
 // use the revised face finder algo
 void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
 {
+    //this runs in the face finding thread, the timings are only reported in onFacesFinished
+    Base::TimeElapsed scrubStart;
     std::vector<TopoDS_Edge> closedEdges;
     std::vector<TopoDS_Edge> cleanEdges = DrawProjectSplit::scrubEdges(goEdges, closedEdges);
+    m_scrubTime = Base::TimeElapsed::diffTimeF(scrubStart);
 
     if (cleanEdges.empty() && closedEdges.empty()) {
         //how does this happen?  something wrong somewhere
@@ -524,6 +550,7 @@ void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
     }
 
     //use EdgeWalker to make wires from edges
+    Base::TimeElapsed wireStart;
     EdgeWalker eWalker;
     std::vector<TopoDS_Wire> sortedWires;
     try {
@@ -534,6 +561,7 @@ void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
     catch (Base::Exception& e) {
         throw Base::RuntimeError(e.what());
     }
+    m_wireTime = Base::TimeElapsed::diffTimeF(wireStart);
     geometryObject->clearFaceGeom();
 
     std::vector<TopoDS_Wire> closedWires;
@@ -700,6 +728,12 @@ void DrawViewPart::onFacesFinished()
     waitingForFaces(false);
     QObject::disconnect(connectFaceWatcher);
     showProgressMessage(getNameInDocument(), "has finished extracting faces");
+    if (Preferences::reportTiming()) {
+        Base::Console().Message(
+            "TechDraw: %s face extraction took %.3f s (edge cleanup %.3f s, wire building %.3f s)\n",
+            getNameInDocument(), Base::TimeElapsed::diffTimeF(m_faceStart), m_scrubTime,
+            m_wireTime);
+    }
 
     // Now we can recompute Dimensions and do other tasks possibly depending on Face extraction
     postFaceExtractionTasks();
@@ -1034,6 +1068,23 @@ bool DrawViewPart::waitingForResult() const
     return false;
 }
 
+//! block until the running background task is finished and do its follow up processing here
+//! instead of waiting for the watcher's signal.  Returns true if there was a task to wait for.
+bool DrawViewPart::finishPendingTasks()
+{
+    if (waitingForHlr()) {
+        m_hlrFuture.waitForFinished();
+        onHlrFinished();
+        return true;
+    }
+    if (waitingForFaces()) {
+        m_faceFuture.waitForFinished();
+        onFacesFinished();
+        return true;
+    }
+    return false;
+}
+
 bool DrawViewPart::hasGeometry() const
 {
     if (!geometryObject) {
@@ -35,6 +35,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <Base/BoundBox.h>
+#include <Base/TimeInfo.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -211,6 +212,7 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    virtual bool finishPendingTasks();
     void progressValueChanged(int v);
 
 public Q_SLOTS:
@@ -258,6 +260,12 @@ private:
     QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
 
+    // stage timing, reported if Preferences::reportTiming() is set
+    Base::TimeElapsed m_hlrStart;
+    Base::TimeElapsed m_faceStart;
+    float m_scrubTime {0.0F};
+    float m_wireTime {0.0F};
+
 };
 
 using DrawViewPartPython = App::FeaturePythonT<DrawViewPart>;
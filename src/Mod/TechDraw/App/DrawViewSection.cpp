@@ -86,6 +86,7 @@
 
 #include "DrawGeomHatch.h"
 #include "DrawHatch.h"
+#include "DrawPage.h"
 #include "DrawUtil.h"
 #include "DrawViewDetail.h"
 #include "EdgeWalker.h"
@@ -466,14 +467,17 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
         // https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
         connectCutWatcher =
             QObject::connect(&m_cutWatcher, &QFutureWatcherBase::finished, &m_cutWatcher, [this] {
-                this->onSectionCutFinished();
+                // ignore the signal if finishPendingTasks() has already done the work
+                if (this->waitingForCut()) {
+                    this->onSectionCutFinished();
+                }
             });
 
         // We create a lambda closure to hold a copy of baseShape.
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
+        m_cutFuture = QtConcurrent::run(DrawPage::viewThreadPool(), std::move(lambda));
         m_cutWatcher.setFuture(m_cutFuture);
         waitingForCut(true);
     }
@@ -546,8 +550,6 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
                                 Label.getValue());
         return;
     }
-
-    waitingForCut(false);
 }
 
 //! position, scale and rotate shape for  buildGeometryObject
@@ -617,6 +619,9 @@ void DrawViewSection::onSectionCutFinished()
 {
     //    Base::Console().Message("DVS::onSectionCutFinished() - %s\n",
     //    getNameInDocument());
+    // the flag is cleared here in the main thread, not at the end of makeSectionCut, so that
+    // it is still set while the finished signal is pending
+    waitingForCut(false);
     QObject::disconnect(connectCutWatcher);
 
     showProgressMessage(getNameInDocument(), "has finished making section cut");
@@ -701,6 +706,16 @@ bool DrawViewSection::waitingForResult() const
     return false;
 }
 
+bool DrawViewSection::finishPendingTasks()
+{
+    if (waitingForCut()) {
+        m_cutFuture.waitForFinished();
+        onSectionCutFinished();
+        return true;
+    }
+    return DrawViewPart::finishPendingTasks();
+}
+
 gp_Pln DrawViewSection::getSectionPlane() const
 {
     gp_Ax2 viewAxis = getSectionCS();
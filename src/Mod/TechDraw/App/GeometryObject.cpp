@@ -26,6 +26,12 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <cmath>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepAlgo_NormalProjection.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
@@ -38,6 +44,7 @@
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
+#include <GeomAPI_PointsToBSpline.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
@@ -46,6 +53,8 @@
 #include <HLRBRep_HLRToShape.hxx>
 #include <HLRBRep_PolyAlgo.hxx>
 #include <HLRBRep_PolyHLRToShape.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -74,11 +83,372 @@
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
 #include "DrawProjectSplit.h"
+#include "Preferences.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
 using namespace std;
 
+namespace {
+
+//! The parameters of a HLR projection. The shape is described by the positions of its vertices,
+//! edge mid points and face mid points, normalized by the size of the shape, and the types of
+//! its curves and surfaces. This makes the key independent of the scale of the shape, which is
+//! applied before the projection.
+struct ProjectionKey
+{
+    std::vector<double> values;
+    std::vector<int> types;
+    double size {1.0};
+    gp_Ax2 viewAxis;
+    bool perspective {false};
+    double focus {0.0};
+    int isoCount {0};
+    bool polygon {false};
+    std::size_t hash {0};
+
+    ProjectionKey(const TopoDS_Shape& shape, const gp_Ax2& axis, bool persp, double foc, int iso,
+                  bool poly = false)
+        : viewAxis(axis), perspective(persp), focus(foc), isoCount(iso), polygon(poly)
+    {
+        auto addPoint = [this](const gp_Pnt& pnt) {
+            values.push_back(pnt.X());
+            values.push_back(pnt.Y());
+            values.push_back(pnt.Z());
+        };
+        for (TopExp_Explorer expl(shape, TopAbs_VERTEX); expl.More(); expl.Next()) {
+            addPoint(BRep_Tool::Pnt(TopoDS::Vertex(expl.Current())));
+        }
+        for (TopExp_Explorer expl(shape, TopAbs_EDGE); expl.More(); expl.Next()) {
+            const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+            if (BRep_Tool::Degenerated(edge)) {
+                types.push_back(-1);
+                continue;
+            }
+            BRepAdaptor_Curve adapt(edge);
+            types.push_back(adapt.GetType());
+            addPoint(adapt.Value((adapt.FirstParameter() + adapt.LastParameter()) / 2.0));
+        }
+        for (TopExp_Explorer expl(shape, TopAbs_FACE); expl.More(); expl.Next()) {
+            const TopoDS_Face& face = TopoDS::Face(expl.Current());
+            BRepAdaptor_Surface adapt(face);
+            types.push_back(adapt.GetType());
+            double uMin, uMax, vMin, vMax;
+            BRepTools::UVBounds(face, uMin, uMax, vMin, vMax);
+            if (!Precision::IsInfinite(uMin) && !Precision::IsInfinite(uMax)
+                && !Precision::IsInfinite(vMin) && !Precision::IsInfinite(vMax)) {
+                addPoint(adapt.Value((uMin + uMax) / 2.0, (vMin + vMax) / 2.0));
+            }
+        }
+
+        size = 0.0;
+        for (double value : values) {
+            size = std::max(size, std::fabs(value));
+        }
+        if (size < Precision::Confusion()) {
+            size = 1.0;
+        }
+        for (double& value : values) {
+            value /= size;
+        }
+
+        //the hash uses rounded values, so tiny differences only cause a cache miss
+        hash = values.size();
+        auto combine = [this](std::size_t h) {
+            hash ^= h + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        };
+        for (int type : types) {
+            combine(std::hash<int>()(type));
+        }
+        for (double value : values) {
+            combine(std::hash<long long>()(std::llround(value * 1.0e6)));
+        }
+        combine(std::hash<bool>()(perspective));
+        combine(std::hash<int>()(isoCount));
+        combine(std::hash<bool>()(polygon));
+    }
+
+    //! the result of a projection can only be scaled if the projection is scale invariant.
+    //! The tessellation used by the polygon algorithm depends on the scale.
+    bool canScale() const
+    {
+        gp_Pnt origin(0.0, 0.0, 0.0);
+        return !perspective && !polygon
+            && viewAxis.Location().Distance(origin) < Precision::Confusion();
+    }
+
+    bool matches(const ProjectionKey& other) const
+    {
+        if (hash != other.hash || types != other.types || values.size() != other.values.size()
+            || perspective != other.perspective || isoCount != other.isoCount
+            || polygon != other.polygon) {
+            return false;
+        }
+        if (perspective && focus != other.focus) {
+            return false;
+        }
+        if (!viewAxis.Direction().IsEqual(other.viewAxis.Direction(), Precision::Angular())
+            || !viewAxis.XDirection().IsEqual(other.viewAxis.XDirection(), Precision::Angular())
+            || viewAxis.Location().Distance(other.viewAxis.Location()) > Precision::Confusion()) {
+            return false;
+        }
+        if (std::fabs(size / other.size - 1.0) > Precision::Confusion() && !canScale()) {
+            return false;
+        }
+        constexpr double tolerance = 1.0e-9;
+        for (size_t i = 0; i < values.size(); i++) {
+            if (std::fabs(values[i] - other.values[i]) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+//! A process wide cache of HLR results. Views of the same shape from the same direction, for
+//! example on several pages or after a change that does not affect the projection, reuse the
+//! visible and hidden edge compounds instead of running HLR again. A result for the same shape
+//! at another scale is scaled to the new size.
+class ProjectionCache
+{
+public:
+    static ProjectionCache& instance()
+    {
+        static ProjectionCache cache;
+        return cache;
+    }
+
+    bool find(const ProjectionKey& key, std::vector<TopoDS_Shape>& results)
+    {
+        double scale = 1.0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = std::find_if(entries.begin(), entries.end(), [&key](const Entry& entry) {
+                return entry.key.matches(key);
+            });
+            if (it == entries.end()) {
+                return false;
+            }
+            results = it->results;
+            scale = key.size / it->key.size;
+        }
+
+        if (std::fabs(scale - 1.0) > Precision::Confusion()) {
+            for (auto& shape : results) {
+                if (!shape.IsNull()) {
+                    shape = ShapeUtils::scaleShape(shape, scale);
+                }
+            }
+        }
+        return true;
+    }
+
+    void add(const ProjectionKey& key, const std::vector<TopoDS_Shape>& results)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t maxEntries = std::max(Preferences::projectionCacheSize(), 0);
+        if (maxEntries == 0) {
+            entries.clear();
+            return;
+        }
+        entries.push_back({key, results});
+        while (entries.size() > maxEntries) {
+            entries.pop_front();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+    }
+
+private:
+    struct Entry
+    {
+        ProjectionKey key;
+        std::vector<TopoDS_Shape> results;
+    };
+
+    std::deque<Entry> entries;
+    std::mutex mutex;
+};
+
+//! deflection of the tessellation used by the polygon HLR, in page units
+constexpr double polygonDeflection = 0.1;
+//! largest turn between two tessellation segments that is still considered to be on a curve.
+//! Slightly larger than the angular deflection of the tessellation.
+constexpr double polygonMaxTurn = 0.55;
+//! distance below which tessellation points are merged when joining the projected segments
+constexpr double polygonJoinTolerance = polygonDeflection / 10.0;
+
+//! make edges for an ordered run of tessellation points. A straight run becomes one line,
+//! a curved run is approximated by a spline through the points.
+void addPolygonRun(const std::vector<gp_Pnt>& points, double tolerance, BRep_Builder& builder,
+                   TopoDS_Compound& result)
+{
+    if (points.size() < 2) {
+        return;
+    }
+
+    const gp_Pnt& first = points.front();
+    const gp_Pnt& last = points.back();
+    bool straight = true;
+    if (first.Distance(last) < tolerance) {
+        straight = points.size() == 2;
+    }
+    else {
+        gp_Vec axis(first, last);
+        axis.Normalize();
+        for (size_t i = 1; i + 1 < points.size() && straight; i++) {
+            gp_Vec offset(first, points[i]);
+            straight = offset.Crossed(axis).Magnitude() <= tolerance;
+        }
+    }
+    if (straight) {
+        if (first.Distance(last) >= tolerance) {
+            builder.Add(result, BRepBuilderAPI_MakeEdge(first, last).Edge());
+        }
+        return;
+    }
+
+    if (points.size() >= 4) {
+        TColgp_Array1OfPnt poles(1, static_cast<int>(points.size()));
+        for (size_t i = 0; i < points.size(); i++) {
+            poles.SetValue(static_cast<int>(i) + 1, points[i]);
+        }
+        try {
+            GeomAPI_PointsToBSpline approx(poles, 3, 8, GeomAbs_C2, tolerance);
+            if (approx.IsDone()) {
+                builder.Add(result, BRepBuilderAPI_MakeEdge(approx.Curve()).Edge());
+                return;
+            }
+        }
+        catch (const Standard_Failure&) {
+            //fall through and keep the segments
+        }
+    }
+
+    for (size_t i = 0; i + 1 < points.size(); i++) {
+        if (points[i].Distance(points[i + 1]) >= tolerance) {
+            builder.Add(result, BRepBuilderAPI_MakeEdge(points[i], points[i + 1]).Edge());
+        }
+    }
+}
+
+//! HLRBRep_PolyAlgo returns every segment of the tessellation as a separate edge. This joins
+//! the segments that meet end to end (and nothing else) into chains, and converts the chains
+//! back to lines and smooth curves. This gives far fewer TechDraw edges and much nicer output.
+TopoDS_Shape joinPolygonEdges(const TopoDS_Shape& edges, double tolerance)
+{
+    if (edges.IsNull()) {
+        return edges;
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+
+    //the end points of the segments, merged on a grid of size tolerance
+    std::vector<gp_Pnt> nodes;
+    std::map<std::pair<long long, long long>, int> nodeIndex;
+    auto findNode = [&](const gp_Pnt& pnt) {
+        std::pair<long long, long long> cell(std::llround(pnt.X() / tolerance),
+                                             std::llround(pnt.Y() / tolerance));
+        auto it = nodeIndex.find(cell);
+        if (it != nodeIndex.end()) {
+            return it->second;
+        }
+        int index = static_cast<int>(nodes.size());
+        nodes.push_back(pnt);
+        nodeIndex.emplace(cell, index);
+        return index;
+    };
+
+    std::vector<std::pair<int, int>> segments;
+    for (TopExp_Explorer expl(edges, TopAbs_EDGE); expl.More(); expl.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+        BRepAdaptor_Curve adapt(edge);
+        if (adapt.GetType() != GeomAbs_Line) {
+            builder.Add(result, edge);
+            continue;
+        }
+        int first = findNode(adapt.Value(adapt.FirstParameter()));
+        int last = findNode(adapt.Value(adapt.LastParameter()));
+        if (first != last) {
+            segments.emplace_back(first, last);
+        }
+    }
+
+    std::vector<std::vector<int>> nodeSegments(nodes.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        nodeSegments[segments[i].first].push_back(static_cast<int>(i));
+        nodeSegments[segments[i].second].push_back(static_cast<int>(i));
+    }
+
+    //follow the chain from node through segment until a node that does not join exactly 2
+    //segments. Returns the nodes passed after the start node.
+    std::vector<bool> used(segments.size(), false);
+    auto walk = [&](int node, int segment) {
+        std::vector<int> chain;
+        while (segment >= 0 && !used[segment]) {
+            used[segment] = true;
+            node = segments[segment].first == node ? segments[segment].second
+                                                   : segments[segment].first;
+            chain.push_back(node);
+            segment = -1;
+            if (nodeSegments[node].size() == 2) {
+                for (int next : nodeSegments[node]) {
+                    if (!used[next]) {
+                        segment = next;
+                    }
+                }
+            }
+        }
+        return chain;
+    };
+
+    for (size_t i = 0; i < segments.size(); i++) {
+        if (used[i]) {
+            continue;
+        }
+        int start = segments[i].first;
+        std::vector<int> forward = walk(start, static_cast<int>(i));
+        std::vector<int> backward;
+        if (nodeSegments[start].size() == 2) {
+            for (int other : nodeSegments[start]) {
+                if (!used[other]) {
+                    backward = walk(start, other);
+                }
+            }
+        }
+
+        std::vector<int> chain(backward.rbegin(), backward.rend());
+        chain.push_back(start);
+        chain.insert(chain.end(), forward.begin(), forward.end());
+
+        //split the chain at sharp corners, they are real corners of the drawing
+        std::vector<gp_Pnt> run {nodes[chain.front()]};
+        for (size_t j = 1; j < chain.size(); j++) {
+            const gp_Pnt& pnt = nodes[chain[j]];
+            if (run.size() >= 2) {
+                gp_Vec previous(run[run.size() - 2], run.back());
+                gp_Vec next(run.back(), pnt);
+                if (previous.Angle(next) > polygonMaxTurn) {
+                    addPolygonRun(run, tolerance, builder, result);
+                    run = {run.back()};
+                }
+            }
+            run.push_back(pnt);
+        }
+        addPolygonRun(run, tolerance, builder, result);
+    }
+
+    return result;
+}
+
+}// namespace
+
 using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
@@ -144,6 +514,23 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 {
     clear();
 
+    //the visibility flags of the parent only affect makeTDGeometry, so they are not part
+    //of the key
+    TopoDS_Shape* hlrResults[] = {&visHard, &visSmooth, &visSeam, &visOutline, &visIso,
+                                  &hidHard, &hidSmooth, &hidSeam, &hidOutline, &hidIso};
+    std::unique_ptr<ProjectionKey> key;
+    if (Preferences::projectionCacheSize() > 0) {
+        key = std::make_unique<ProjectionKey>(inShape, viewAxis, m_isPersp, m_focus, m_isoCount);
+        std::vector<TopoDS_Shape> cached;
+        if (ProjectionCache::instance().find(*key, cached)) {
+            for (size_t i = 0; i < cached.size(); i++) {
+                *hlrResults[i] = cached.at(i);
+            }
+            makeTDGeometry();
+            return;
+        }
+    }
+
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -244,9 +631,23 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    if (key) {
+        std::vector<TopoDS_Shape> results;
+        for (auto* result : hlrResults) {
+            results.push_back(*result);
+        }
+        ProjectionCache::instance().add(*key, results);
+    }
+
     makeTDGeometry();
 }
 
+//! forget all cached HLR results
+void GeometryObject::clearProjectionCache()
+{
+    ProjectionCache::instance().clear();
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -293,6 +694,21 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
     // Clear previous Geometry
     clear();
 
+    TopoDS_Shape* hlrResults[] = {&visHard, &visSmooth, &visSeam, &visOutline,
+                                  &hidHard, &hidSmooth, &hidSeam, &hidOutline};
+    std::unique_ptr<ProjectionKey> key;
+    if (Preferences::projectionCacheSize() > 0) {
+        key = std::make_unique<ProjectionKey>(input, viewAxis, m_isPersp, m_focus, 0, true);
+        std::vector<TopoDS_Shape> cached;
+        if (ProjectionCache::instance().find(*key, cached)) {
+            for (size_t i = 0; i < cached.size(); i++) {
+                *hlrResults[i] = cached.at(i);
+            }
+            makeTDGeometry();
+            return;
+        }
+    }
+
     //work around for Mantis issue #3332
     //if 3332 gets fixed in OCC, this will produce shifted views and will need
     //to be reverted.
@@ -312,7 +728,9 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
     try {
         // HLRBRep_PolyAlgo will fail if the whole input shape has not been meshed.
         // meshing the faces is not sufficient.
-        BRepMesh_IncrementalMesh(inCopy, 0.10);
+        // Faces that still carry a fine enough tessellation (ex. from the 3d view) are not
+        // meshed again, the others are meshed in parallel.
+        BRepMesh_IncrementalMesh(inCopy, polygonDeflection, false, 0.5, true);
 
         brep_hlrPoly = new HLRBRep_PolyAlgo();
         brep_hlrPoly->Load(inCopy);
@@ -342,39 +760,25 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
         HLRBRep_PolyHLRToShape polyhlrToShape;
         polyhlrToShape.Update(brep_hlrPoly);
 
-        visHard = polyhlrToShape.VCompound();
-        BRepLib::BuildCurves3d(visHard);
-        visHard =ShapeUtils::invertGeometry(visHard);
-        //        BRepTools::Write(visHard, "GOvisHardi.brep");            //debug
-
-        visSmooth = polyhlrToShape.Rg1LineVCompound();
-        BRepLib::BuildCurves3d(visSmooth);
-        visSmooth =ShapeUtils::invertGeometry(visSmooth);
-
-        visSeam = polyhlrToShape.RgNLineVCompound();
-        BRepLib::BuildCurves3d(visSeam);
-        visSeam =ShapeUtils::invertGeometry(visSeam);
+        //the tessellation segments come out as separate edges, join them into lines and
+        //curves before they are turned into TechDraw geometry
+        auto finishCompound = [](TopoDS_Shape edges) {
+            BRepLib::BuildCurves3d(edges);
+            edges = joinPolygonEdges(edges, polygonJoinTolerance);
+            return ShapeUtils::invertGeometry(edges);
+        };
 
-        visOutline = polyhlrToShape.OutLineVCompound();
-        BRepLib::BuildCurves3d(visOutline);
-        visOutline =ShapeUtils::invertGeometry(visOutline);
+        visHard = finishCompound(polyhlrToShape.VCompound());
+        //        BRepTools::Write(visHard, "GOvisHardi.brep");            //debug
+        visSmooth = finishCompound(polyhlrToShape.Rg1LineVCompound());
+        visSeam = finishCompound(polyhlrToShape.RgNLineVCompound());
+        visOutline = finishCompound(polyhlrToShape.OutLineVCompound());
 
-        hidHard = polyhlrToShape.HCompound();
-        BRepLib::BuildCurves3d(hidHard);
-        hidHard =ShapeUtils::invertGeometry(hidHard);
+        hidHard = finishCompound(polyhlrToShape.HCompound());
         //        BRepTools::Write(hidHard, "GOhidHardi.brep");            //debug
-
-        hidSmooth = polyhlrToShape.Rg1LineHCompound();
-        BRepLib::BuildCurves3d(hidSmooth);
-        hidSmooth =ShapeUtils::invertGeometry(hidSmooth);
-
-        hidSeam = polyhlrToShape.RgNLineHCompound();
-        BRepLib::BuildCurves3d(hidSeam);
-        hidSeam =ShapeUtils::invertGeometry(hidSeam);
-
-        hidOutline = polyhlrToShape.OutLineHCompound();
-        BRepLib::BuildCurves3d(hidOutline);
-        hidOutline =ShapeUtils::invertGeometry(hidOutline);
+        hidSmooth = finishCompound(polyhlrToShape.Rg1LineHCompound());
+        hidSeam = finishCompound(polyhlrToShape.RgNLineHCompound());
+        hidOutline = finishCompound(polyhlrToShape.OutLineHCompound());
     }
     catch (const Standard_Failure& e) {
         Base::Console().Error(
@@ -388,6 +792,14 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
                                  "occurred while extracting edges");
     }
 
+    if (key) {
+        std::vector<TopoDS_Shape> results;
+        for (auto* result : hlrResults) {
+            results.push_back(*result);
+        }
+        ProjectionCache::instance().add(*key, results);
+    }
+
     makeTDGeometry();
 }
 
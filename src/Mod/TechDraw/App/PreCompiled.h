@@ -35,11 +35,14 @@
 #include <algorithm>
 #include <cstdio>
 #include <chrono>
+#include <cmath>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -62,6 +65,8 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
@@ -352,6 +352,26 @@ bool Preferences::reportProgress()
     return getPreferenceGroup("General")->GetBool("ReportProgress", false);
 }
 
+//! report the time spent in hidden line removal and the face finding stages
+bool Preferences::reportTiming()
+{
+    return getPreferenceGroup("General")->GetBool("ReportTiming", false);
+}
+
+//! number of HLR results kept for reuse by views with the same shape and direction.
+//! 0 turns the cache off.
+int Preferences::projectionCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("ProjectionCacheSize", 20);
+}
+
+//! number of view tasks (HLR, face finding, section cuts) run at the same time.
+//! 0 uses one task per processor core.
+int Preferences::maxParallelViews()
+{
+    return getPreferenceGroup("General")->GetInt("MaxParallelViews", 0);
+}
+
 bool Preferences::lightOnDark()
 {
     return getPreferenceGroup("Colors")->GetBool("LightOnDark", false);
@@ -97,6 +97,9 @@ public:
     static double GapASME();
 
     static bool reportProgress();
+    static bool reportTiming();
+    static int projectionCacheSize();
+    static int maxParallelViews();
 
     static bool lightOnDark();
     static void lightOnDark(bool state);
@@ -47,6 +47,7 @@
 #include <HLRBRep_HLRToShape.hxx>
 #include <HLRBRep_PolyAlgo.hxx>
 #include <HLRBRep_PolyHLRToShape.hxx>
+#include <Standard_Version.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -263,9 +264,22 @@ TopoDS_Shape ShapeUtils::mirrorShape(const TopoDS_Shape& input, const gp_Pnt& in
     return transShape;
 }
 
+//! transforms a shape, and its triangulation if copyMesh is set and OCC supports it
+static TopoDS_Shape transformShape(const TopoDS_Shape& input, const gp_Trsf& transform,
+                                   bool copyMesh)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    BRepBuilderAPI_Transform mkTrf(input, transform, false, copyMesh);
+#else
+    (void)copyMesh;
+    BRepBuilderAPI_Transform mkTrf(input, transform);
+#endif
+    return mkTrf.Shape();
+}
+
 //!rotates a shape about a viewAxis
 TopoDS_Shape ShapeUtils::rotateShape(const TopoDS_Shape& input, const gp_Ax2& viewAxis,
-                                   double rotAngle)
+                                   double rotAngle, bool copyMesh)
 {
     TopoDS_Shape transShape;
     if (input.IsNull()) {
@@ -278,8 +292,7 @@ TopoDS_Shape ShapeUtils::rotateShape(const TopoDS_Shape& input, const gp_Ax2& vi
     try {
         gp_Trsf tempTransform;
         tempTransform.SetRotation(rotAxis, rotation);
-        BRepBuilderAPI_Transform mkTrf(input, tempTransform);
-        transShape = mkTrf.Shape();
+        transShape = transformShape(input, tempTransform, copyMesh);
     }
     catch (...) {
         return transShape;
@@ -288,15 +301,14 @@ TopoDS_Shape ShapeUtils::rotateShape(const TopoDS_Shape& input, const gp_Ax2& vi
 }
 
 //!scales a shape about origin
-TopoDS_Shape ShapeUtils::scaleShape(const TopoDS_Shape& input, double scale)
+TopoDS_Shape ShapeUtils::scaleShape(const TopoDS_Shape& input, double scale, bool copyMesh)
 {
     TopoDS_Shape transShape;
     try {
         gp_Trsf scaleTransform;
         scaleTransform.SetScale(gp_Pnt(0, 0, 0), scale);
 
-        BRepBuilderAPI_Transform mkTrf(input, scaleTransform);
-        transShape = mkTrf.Shape();
+        transShape = transformShape(input, scaleTransform, copyMesh);
     }
     catch (...) {
         return transShape;
@@ -72,12 +72,14 @@ public:
     //! another mirroring routine that modifies the shape to conform with the Qt coordinate system.
     static TopoDS_Shape invertGeometry(const TopoDS_Shape s);
 
-//! scales a shape uniformly in all directions
-    static TopoDS_Shape scaleShape(const TopoDS_Shape& input, double scale);
+//! scales a shape uniformly in all directions, with its triangulation if copyMesh is set
+    static TopoDS_Shape scaleShape(const TopoDS_Shape& input, double scale,
+                                   bool copyMesh = false);
 
-//! rotates a shape around the Z axis of a coordinate system
+//! rotates a shape around the Z axis of a coordinate system, with its triangulation if copyMesh
+//! is set
     static TopoDS_Shape rotateShape(const TopoDS_Shape& input, const gp_Ax2& coordSys,
-                                        double rotAngle);
+                                        double rotAngle, bool copyMesh = false);
 
 //! moves a shape in a direction and distance specified by the motion parameter
     static TopoDS_Shape moveShape(const TopoDS_Shape& input, const Base::Vector3d& motion);
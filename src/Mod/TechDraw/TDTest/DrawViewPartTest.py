@@ -50,5 +50,22 @@ class DrawViewPartTest(unittest.TestCase):
         self.assertEqual(len(edges), 4, "DrawViewPart has wrong number of edges")
         self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
 
+    def testWaitForViews(self):
+        """Tests if the views on a page can be finished without an event loop"""
+        print("testing DrawPage.waitForViews")
+        view1 = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View1")
+        self.page.addView(view1)
+        view1.Source = [FreeCAD.ActiveDocument.Box]
+        view2 = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View2")
+        self.page.addView(view2)
+        view2.Source = [FreeCAD.ActiveDocument.Box]
+        view2.Direction = FreeCAD.Vector(1, 0, 0)
+        FreeCAD.ActiveDocument.recompute()
+
+        self.page.waitForViews()
+
+        self.assertEqual(len(view1.getVisibleEdges()), 4, "View1 has wrong number of edges")
+        self.assertEqual(len(view2.getVisibleEdges()), 4, "View2 has wrong number of edges")
+
 if __name__ == "__main__":
     unittest.main()
@@ -968,6 +968,24 @@ class UndoRedoCases(unittest.TestCase):
         # switch on the Undo OFF
         self.Doc.UndoMode = 0
 
+    def testUndoMemSize(self):
+        self.Doc.UndoMode = 1
+        self.assertEqual(self.Doc.UndoRedoMemSize, 0)
+
+        self.Doc.openTransaction("Transaction1")
+        self.Doc.getObject("Base").FloatList = [1.0] * 1000
+        self.Doc.commitTransaction()
+        self.Doc.openTransaction("Transaction2")
+        self.Doc.getObject("Base").FloatList = []
+        self.Doc.commitTransaction()
+        # the second transaction keeps the list of the first one
+        self.assertGreaterEqual(self.Doc.UndoRedoMemSize, 1000 * 8)
+
+        self.Doc.undo()
+        self.assertGreaterEqual(self.Doc.UndoRedoMemSize, 1000 * 8)
+        self.Doc.clearUndos()
+        self.assertEqual(self.Doc.UndoRedoMemSize, 0)
+
     def testUndoClear(self):
         # switch on the Undo
         self.Doc.UndoMode = 1
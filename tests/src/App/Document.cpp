@@ -3,9 +3,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <chrono>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
+#include "Base/FileInfo.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
@@ -94,4 +98,201 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, undoSwapsOutOldTransactions)
+{
+    // Arrange
+    const int count = 20000;
+    const unsigned int limit = 500000;
+    doc()->setUndoMode(1);
+    doc()->setUndoLimit(limit);
+    auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Test"));
+
+    // Act
+    for (int i = 1; i <= 5; ++i) {
+        doc()->openTransaction("Change");
+        obj->FloatList.setValues(std::vector<double>(count, i));
+        doc()->commitTransaction();
+    }
+
+    // Assert
+    EXPECT_LE(doc()->getUndoMemSize(), limit);
+    for (int i = 4; i >= 1; --i) {
+        EXPECT_TRUE(doc()->undo());
+        ASSERT_EQ(obj->FloatList.getSize(), count);
+        EXPECT_EQ(obj->FloatList[0], i);
+    }
+}
+
+TEST_F(DocumentTest, addObjectMakesUniqueNames)
+{
+    // Arrange
+    doc()->addObject("App::FeatureTest", "Box");
+    doc()->addObject("App::FeatureTest", "Box");
+    auto box2 = doc()->addObject("App::FeatureTest", "Box");
+
+    // Act
+    doc()->removeObject(box2->getNameInDocument());
+    auto box3 = doc()->addObject("App::FeatureTest", "Box");
+
+    // Assert
+    EXPECT_STREQ(box3->getNameInDocument(), "Box002");
+    EXPECT_EQ(doc()->getUniqueObjectName("Box"), "Box003");
+    EXPECT_EQ(doc()->getUniqueObjectName("Box7"), "Box7");
+}
+
+TEST_F(DocumentTest, getObjectsByLabelFollowsLabelChanges)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::FeatureTest", "Test");
+
+    // Act
+    obj->Label.setValue("Renamed");
+
+    // Assert
+    EXPECT_TRUE(doc()->getObjectsByLabel("Test").empty());
+    EXPECT_THAT(doc()->getObjectsByLabel("Renamed"), ::testing::ElementsAre(obj));
+    doc()->removeObject(obj->getNameInDocument());
+    EXPECT_TRUE(doc()->getObjectsByLabel("Renamed").empty());
+}
+
+TEST_F(DocumentTest, getObjectsByLabelAfterUndo)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto obj = doc()->addObject("App::FeatureTest", "Test");
+    doc()->openTransaction("Remove");
+    doc()->removeObject(obj->getNameInDocument());
+    doc()->commitTransaction();
+
+    // Act
+    doc()->undo();
+
+    // Assert
+    auto objs = doc()->getObjectsByLabel("Test");
+    ASSERT_EQ(objs.size(), 1);
+    EXPECT_STREQ(objs.front()->getNameInDocument(), "Test");
+}
+
+TEST_F(DocumentTest, getObjectsByLabelAfterReload)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::FeatureTestRestoring", "Test");
+    obj->Label.setValue("Restored");
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".FCStd");
+    ASSERT_TRUE(doc()->saveCopy(fi.filePath().c_str()));
+
+    // Act
+    auto reloaded = App::GetApplication().openDocument(fi.filePath().c_str());
+    ASSERT_NE(reloaded, nullptr);
+    std::vector<std::string> names;
+    for (auto restored : reloaded->getObjectsByLabel("Restored")) {
+        names.emplace_back(restored->getNameInDocument());
+    }
+    App::GetApplication().closeDocument(reloaded->getName());
+    fi.deleteFile();
+
+    // Assert
+    EXPECT_THAT(names, ::testing::ElementsAre("Test"));
+}
+
+TEST_F(DocumentTest, setLabelMakesUniqueLabel)
+{
+    // Arrange
+    auto obj1 = doc()->addObject("App::FeatureTest", "Part");
+    auto obj2 = doc()->addObject("App::FeatureTest", "Other");
+    auto obj3 = doc()->addObject("App::FeatureTest", "Other");
+
+    // Act
+    obj2->Label.setValue("Part");
+    obj3->Label.setValue("Part");
+
+    // Assert
+    EXPECT_EQ(obj1->Label.getStrValue(), "Part");
+    EXPECT_EQ(obj2->Label.getStrValue(), "Part001");
+    EXPECT_EQ(obj3->Label.getStrValue(), "Part002");
+    EXPECT_EQ(doc()->getUniqueObjectLabel("Part"), "Part003");
+    EXPECT_EQ(doc()->getUniqueObjectLabel("Part002", obj3), "Part002");
+    EXPECT_EQ(doc()->getUniqueObjectLabel("Part002", obj2), "Part003");
+    EXPECT_EQ(doc()->getUniqueObjectLabel("Part005"), "Part005");
+}
+
+TEST_F(DocumentTest, addObjectsMakesUniqueNames)
+{
+    // Arrange
+    const int count = 20000;
+    doc()->addObject("App::FeatureTest", "Test");
+    std::vector<std::string> names(count, "Test");
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    auto objs = doc()->addObjects("App::FeatureTest", names);
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    // Assert
+    RecordProperty(
+        "AddObjectsMicroseconds",
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+    ASSERT_EQ(objs.size(), count);
+    EXPECT_STREQ(objs.front()->getNameInDocument(), "Test001");
+    EXPECT_STREQ(objs.back()->getNameInDocument(), "Test20000");
+    EXPECT_EQ(objs.back()->Label.getStrValue(), "Test20000");
+}
+
+TEST_F(DocumentTest, batchCoalescesChangeNotifications)
+{
+    // Arrange
+    auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Test"));
+    int changed = 0;
+    int coalesced = 0;
+    auto connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            changed += (&prop == &obj->Integer) ? 1 : 0;
+        });
+    auto connCoalesced = doc()->signalChangedObjectCoalesced.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            coalesced += (&prop == &obj->Integer) ? 1 : 0;
+        });
+
+    // Act
+    {
+        App::DocumentBatch batch(doc());
+        App::DocumentBatch nested(doc());
+        for (int i = 1; i <= 100; ++i) {
+            obj->Integer.setValue(i);
+        }
+        EXPECT_EQ(coalesced, 0);
+    }
+
+    // Assert
+    EXPECT_FALSE(doc()->isBatching());
+    EXPECT_EQ(changed, 100);
+    EXPECT_EQ(coalesced, 1);
+    obj->Integer.setValue(0);
+    EXPECT_EQ(coalesced, 2);
+    connChanged.disconnect();
+    connCoalesced.disconnect();
+}
+
+TEST_F(DocumentTest, batchSkipsRemovedObjects)
+{
+    // Arrange
+    auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Test"));
+    int coalesced = 0;
+    auto conn = doc()->signalChangedObjectCoalesced.connect(
+        [&](const App::DocumentObject&, const App::Property&) {
+            ++coalesced;
+        });
+
+    // Act
+    doc()->openBatch();
+    obj->Integer.setValue(1);
+    doc()->removeObject(obj->getNameInDocument());
+    doc()->closeBatch();
+
+    // Assert
+    EXPECT_EQ(coalesced, 0);
+    conn.disconnect();
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include <App/Application.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
@@ -266,6 +268,36 @@ TEST_F(ElementMapTest, findMappedName)
     EXPECT_EQ(findResult2, element2);
 }
 
+TEST_F(ElementMapTest, findMappedNameAfterErasingOthers)
+{
+    // Arrange
+    // Enough names to grow the table several times, every other one is erased again.
+    Data::ElementMap elementMap;
+    const int count = 100;
+    for (int i = 1; i <= count; ++i) {
+        Data::IndexedName element("Edge", i);
+        elementMap.setElementName(element, Data::MappedName(element), 0);
+    }
+
+    // Act
+    for (int i = 1; i <= count; i += 2) {
+        elementMap.erase(Data::MappedName(Data::IndexedName("Edge", i)));
+    }
+    auto all = elementMap.getAll();
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), count / 2);
+    for (int i = 1; i <= count; ++i) {
+        Data::IndexedName element("Edge", i);
+        auto findResult = elementMap.find(Data::MappedName(element));
+        EXPECT_EQ(findResult, i % 2 != 0 ? Data::IndexedName() : element);
+    }
+    ASSERT_EQ(all.size(), count / 2);
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.name < rhs.name;
+    }));
+}
+
 TEST_F(ElementMapTest, findIndexedName)
 {
     // Arrange
@@ -553,4 +585,32 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+
+TEST_F(ElementMapTest, getMemSizeCountsSharedChildMapsOnce)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    LessComplexPart otherCube(1L, "Box", _hasher);
+    auto givenCompound = [this](const Data::ElementMapPtr& first,
+                                const Data::ElementMapPtr& second) {
+        auto compound = std::make_shared<Data::ElementMap>();
+        compound->hasher = _hasher;
+        std::vector<Data::ElementMap::MappedChildElements> children = {
+            {Data::IndexedName("Face", 1), 6, 0, 1L, first, QByteArray("abc"), _sid},
+            {Data::IndexedName("Face", 1), 6, 6, 1L, second, QByteArray("def"), _sid}};
+        compound->addChildElements(3L, children);
+        return compound;
+    };
+
+    // Act
+    auto emptySize = Data::ElementMap().getMemSize();
+    auto cubeSize = cube.elementMapPtr->getMemSize();
+    auto sharedSize = givenCompound(cube.elementMapPtr, cube.elementMapPtr)->getMemSize();
+    auto separateSize = givenCompound(cube.elementMapPtr, otherCube.elementMapPtr)->getMemSize();
+
+    // Assert
+    EXPECT_LT(emptySize, cubeSize);
+    EXPECT_EQ(otherCube.elementMapPtr->getMemSize(), cubeSize);
+    EXPECT_EQ(separateSize - sharedSize, cubeSize);
+}
 // NOLINTEND(readability-magic-numbers)
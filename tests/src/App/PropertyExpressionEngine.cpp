@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+
+#include "Base/Interpreter.h"
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -8,6 +11,8 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -90,4 +95,100 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+// The compiled evaluation must give the same values as the evaluation in Python
+TEST_F(PropertyExpressionEngineTest, evaluateNumericWithoutPython)
+{
+    auto length = static_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "Len"));
+    auto number = static_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Num"));
+    auto count = static_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "Cnt"));
+    auto flag = static_cast<App::PropertyBool*>(this_obj()->addDynamicProperty("App::PropertyBool", "Flag"));
+    length->setValue(12.5);
+    number->setValue(2.5);
+    count->setValue(7);
+    flag->setValue(true);
+
+    const char* sources[] = {
+        "1 + 2", "7 / 2", "7 % -3", "-7 % 3", "2 ^ 10", "2 ^ -2", "7.5 % 2", "-Cnt", "+Flag",
+        "Len * 2 + 1 mm", "Len / 2.5 mm", "Len % 5 mm", "Len ^ 2", "Len - 2.5 mm", "2 * Len",
+        "Num * Cnt", "Cnt / 2", "Cnt * Cnt", "Num ^ 2", "Flag + Cnt", "Cnt % 4",
+        "Cnt > 5", "Num <= 2.5", "Len == 12.5 mm", "Len != 12.5 mm", "Len > 10 mm", "Len >= 12.5 mm",
+        "Cnt == Num", "Len < 13", "Flag ? Len : 1 mm", "Cnt > 10 ? 1 : 2.5",
+        "sin(30)", "cos(Num)", "sqrt(Len * Len)", "abs(-Len)", "mod(Len; 5 mm)", "pow(Len; 2)",
+        "hypot(3 mm; Len; 4 mm)", "round(Num)", "atan2(Len; Len)", "min(1; 2)", "True", "False",
+    };
+    for (auto source : sources) {
+        std::unique_ptr<App::Expression> expr(App::Expression::parse(this_obj(), source));
+        App::any compiled = expr->getValueAsAny();
+        App::any python;
+        {
+            Base::PyGILStateLocker lock;
+            python = App::pyObjectToAny(expr->getPyValue());
+        }
+        EXPECT_EQ(compiled.type(), python.type()) << source;
+        EXPECT_TRUE(App::isAnyEqual(compiled, python)) << source;
+
+        std::unique_ptr<App::Expression> value(expr->eval());
+        EXPECT_TRUE(App::isAnyEqual(value->getValueAsAny(), python)) << source;
+    }
+}
+
+// Errors are reported by the evaluation in Python
+TEST_F(PropertyExpressionEngineTest, evaluateNumericErrors)
+{
+    this_obj()->addDynamicProperty("App::PropertyInteger", "Cnt");
+
+    const char* sources[] = {"1 mm + 1 s", "Cnt / 0", "2 % 1 mm"};
+    for (auto source : sources) {
+        std::unique_ptr<App::Expression> expr(App::Expression::parse(this_obj(), source));
+        EXPECT_THROW(expr->getValueAsAny(), Base::Exception) << source;
+    }
+
+    // like in Python the branch that is not taken is not evaluated
+    std::unique_ptr<App::Expression> expr(App::Expression::parse(this_obj(), "Cnt ? 1 mm + 1 s : 2"));
+    EXPECT_EQ(App::any_cast<long>(expr->getValueAsAny()), 2);
+}
+
+TEST_F(PropertyExpressionEngineTest, executeNumericBindings)
+{
+    auto number = static_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Num"));
+    number->setValue(1.5);
+
+    const int count = 200;
+    std::vector<std::unique_ptr<App::Expression>> expressions;
+    for (int i = 0; i < count; ++i) {
+        auto name = "Length" + std::to_string(i);
+        this_obj()->addDynamicProperty("App::PropertyLength", name.c_str());
+        auto source = "Num * " + std::to_string(i) + " mm + (Num > 1 ? 2 mm : 1 mm)";
+        std::shared_ptr<App::Expression> expr(App::Expression::parse(this_obj(), source));
+        expressions.emplace_back(expr->copy());
+        this_obj()->setExpression(App::ObjectIdentifier::parse(this_obj(), name), expr);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    for (int run = 0; run < 20; ++run) {
+        number->setValue(1.5 + run);
+        this_obj()->ExpressionEngine.execute();
+    }
+    auto compiled = Clock::now() - start;
+
+    for (int i = 0; i < count; ++i) {
+        auto prop = static_cast<App::PropertyLength*>(this_obj()->getPropertyByName(("Length" + std::to_string(i)).c_str()));
+        EXPECT_DOUBLE_EQ(prop->getValue(), 20.5 * i + 2.0);
+    }
+
+    // the same expressions evaluated in Python for comparison
+    start = Clock::now();
+    for (int run = 0; run < 20; ++run) {
+        Base::PyGILStateLocker lock;
+        for (auto& expr : expressions) {
+            App::pyObjectToAny(expr->getPyValue());
+        }
+    }
+    auto python = Clock::now() - start;
+
+    RecordProperty("CompiledMicroseconds", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(compiled).count()));
+    RecordProperty("PythonMicroseconds", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(python).count()));
+}
+
 // clang-format on
@@ -7,8 +7,13 @@
 #include <App/StringHasherPy.h>
 #include <App/StringIDPy.h>
 
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+
 #include <QCryptographicHash>
 #include <array>
+#include <chrono>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1591,128 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, getIDs)  // NOLINT
+{
+    // Arrange
+    auto existing = Hasher()->getID("existing");
+    std::vector<QByteArray> data {"first", "existing", "second", "first"};
+
+    // Act
+    auto ids = Hasher()->getIDs(data);
+
+    // Assert
+    ASSERT_EQ(data.size(), ids.size());
+    EXPECT_EQ(3, Hasher()->size());
+    EXPECT_EQ(existing, ids[1]);
+    EXPECT_EQ(ids[0], ids[3]);
+    EXPECT_LT(ids[0].value(), ids[2].value());
+    EXPECT_EQ(ids[2], Hasher()->getID("second"));
+}
+
+TEST_F(StringHasherTest, getIDFromSeveralThreads)  // NOLINT
+{
+    // Arrange
+    const int count {1000};
+    const int numThreads {4};
+    std::vector<std::vector<long>> values(numThreads);
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([this, i, &values] {
+            for (int j = 0; j < count; ++j) {
+                auto text = "Edge" + std::to_string(j);
+                values[i].push_back(Hasher()->getID(text.c_str()).value());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(count, Hasher()->size());
+    for (int i = 1; i < numThreads; ++i) {
+        EXPECT_EQ(values[0], values[i]);
+    }
+}
+
+TEST_F(StringHasherTest, saveAndRestoreDocFile)  // NOLINT
+{
+    // Arrange
+    const int count {100000};
+    Hasher()->setSaveAll(true);
+    QVector<App::StringIDRef> sids;
+    for (int i = 0; i < count; ++i) {
+        auto name = givenMappedName(("Face" + std::to_string(i % 100)).c_str(),
+                                    (";:H" + std::to_string(i) + ":7,F").c_str());
+        auto sid = Hasher()->getID(name, sids);
+        sids.clear();
+        sids.push_back(sid);
+    }
+    auto restored = Base::Reference<App::StringHasher>(new App::StringHasher);
+
+    // Act
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    Base::StringWriter writer;
+    Hasher()->SaveDocFile(writer);
+    auto saving = Clock::now() - start;
+
+    start = Clock::now();
+    std::istringstream stream(writer.getString());
+    Base::Reader reader(stream, "StringHasher.Table.txt", 1);
+    restored->RestoreDocFile(reader);
+    auto restoring = Clock::now() - start;
+
+    // Assert
+    EXPECT_EQ(Hasher()->size(), restored->size());
+    for (const auto& entry : Hasher()->getIDMap()) {
+        auto sid = restored->getID(entry.first);
+        ASSERT_TRUE(sid);
+        EXPECT_EQ(entry.second.dataToText(), sid.dataToText());
+        EXPECT_EQ(entry.second.relatedIDs().size(), sid.relatedIDs().size());
+    }
+    restored->clear();
+
+    RecordProperty("SaveMicroseconds",
+                   static_cast<int>(
+                       std::chrono::duration_cast<std::chrono::microseconds>(saving).count()));
+    RecordProperty("RestoreMicroseconds",
+                   static_cast<int>(
+                       std::chrono::duration_cast<std::chrono::microseconds>(restoring).count()));
+}
+
+TEST_F(StringHasherTest, getIDsBenchmark)  // NOLINT
+{
+    // Arrange
+    const int count {100000};
+    std::vector<QByteArray> data;
+    for (int i = 0; i < count; ++i) {
+        data.emplace_back(("Vertex" + std::to_string(i)).c_str());
+    }
+
+    // Act
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    for (const auto& text : data) {
+        Hasher()->getID(text);
+    }
+    auto single = Clock::now() - start;
+
+    start = Clock::now();
+    auto ids = Hasher()->getIDs(data);
+    auto batch = Clock::now() - start;
+
+    // Assert
+    EXPECT_EQ(count, Hasher()->size());
+    EXPECT_EQ(count, ids.size());
+
+    RecordProperty("SingleMicroseconds",
+                   static_cast<int>(
+                       std::chrono::duration_cast<std::chrono::microseconds>(single).count()));
+    RecordProperty("BatchMicroseconds",
+                   static_cast<int>(
+                       std::chrono::duration_cast<std::chrono::microseconds>(batch).count()));
+}
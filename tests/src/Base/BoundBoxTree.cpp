@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+
+#include <Base/BoundBoxTree.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+// a grid of n x n unit squares in the xy plane, the square at (i, j) has the index i * n + j
+std::vector<Base::BoundBox3f> makeGrid(int n)
+{
+    std::vector<Base::BoundBox3f> boxes;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            boxes.emplace_back(float(i), float(j), 0.0F, float(i + 1), float(j + 1), 0.0F);
+        }
+    }
+    return boxes;
+}
+}  // namespace
+
+TEST(BoundBoxTree, emptyTreeFindsNothing)
+{
+    Base::BoundBoxTree tree;
+    tree.build({});
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.findAlongLine(Base::Vector3f(), Base::Vector3f(0, 0, 1)).empty());
+}
+
+TEST(BoundBoxTree, findAlongLineFindsBoxesOnLine)
+{
+    // Arrange
+    const int n = 100;
+    Base::BoundBoxTree tree;
+    tree.build(makeGrid(n));
+
+    // Act
+    auto found = tree.findAlongLine(Base::Vector3f(10.5F, 20.5F, 5.0F), Base::Vector3f(0, 0, -1));
+    auto near = tree.findAlongLine(Base::Vector3f(10.5F, 20.5F, 5.0F),
+                                   Base::Vector3f(0, 0, -1),
+                                   0.6F);
+
+    // Assert
+    EXPECT_EQ(tree.size(), n * n);
+    EXPECT_THAT(found, ::testing::ElementsAre(10 * n + 20));
+    std::sort(near.begin(), near.end());
+    EXPECT_THAT(near,
+                ::testing::ElementsAre(9 * n + 19,
+                                       9 * n + 20,
+                                       9 * n + 21,
+                                       10 * n + 19,
+                                       10 * n + 20,
+                                       10 * n + 21,
+                                       11 * n + 19,
+                                       11 * n + 20,
+                                       11 * n + 21));
+}
+
+TEST(BoundBoxTree, findAlongLineInPlane)
+{
+    // Arrange
+    const int n = 10;
+    Base::BoundBoxTree tree;
+    tree.build(makeGrid(n));
+
+    // Act
+    auto found = tree.findAlongLine(Base::Vector3f(-5.0F, 3.5F, 0.0F), Base::Vector3f(1, 0, 0));
+
+    // Assert
+    std::sort(found.begin(), found.end());
+    std::vector<int> expected;
+    for (int i = 0; i < n; ++i) {
+        expected.push_back(i * n + 3);
+    }
+    EXPECT_EQ(found, expected);
+}
+
+TEST(BoundBoxTree, searchVisitsEveryPrimitiveOnce)
+{
+    // Arrange
+    const int n = 37;
+    Base::BoundBoxTree tree;
+    tree.build(makeGrid(n));
+    std::vector<int> visits(n * n);
+
+    // Act
+    tree.search(
+        [](const Base::BoundBox3f&) {
+            return true;
+        },
+        [&visits](int index) {
+            ++visits[index];
+        });
+
+    // Assert
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int count) {
+        return count == 1;
+    }));
+}
+
+TEST(BoundBoxTree, findAlongLineFindsEachSquareOfDiagonal)
+{
+    // Arrange
+    const int n = 50;
+    Base::BoundBoxTree tree;
+    tree.build(makeGrid(n));
+
+    // Act
+    std::vector<int> found;
+    for (int i = 0; i < n; ++i) {
+        float pos = float(i) + 0.5F;
+        auto indices = tree.findAlongLine(Base::Vector3f(pos, pos, 1.0F), Base::Vector3f(0, 0, -1));
+        found.insert(found.end(), indices.begin(), indices.end());
+    }
+
+    // Assert
+    std::vector<int> expected;
+    for (int i = 0; i < n; ++i) {
+        expected.push_back(i * n + i);
+    }
+    EXPECT_THAT(found, testing::ElementsAreArray(expected));
+}
+
+// NOLINTEND(readability-magic-numbers)
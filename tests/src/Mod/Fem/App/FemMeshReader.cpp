@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Fem/App/FemMeshReader.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+// NOLINTBEGIN(cppcoreguidelines-pro-type-vararg)
+
+class FemMeshReaderTest: public ::testing::Test
+{
+protected:
+    // the number of tetra10 elements of the generated meshes, each with its own nodes
+    static constexpr int numElements = 500;
+    static constexpr int numNodes = 10 * numElements;
+
+    void SetUp() override
+    {
+        tmp.setFile(Base::FileInfo::getTempFileName() + ".bdf");
+    }
+
+    void TearDown() override
+    {
+        tmp.deleteFile();
+    }
+
+    std::string getFileName() const
+    {
+        return tmp.filePath();
+    }
+
+    void writeFile(const std::string& content) const
+    {
+        Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+        file << content;
+    }
+
+    static std::string format(const char* fmt, ...)
+    {
+        char buf[256];
+        va_list args;
+        va_start(args, fmt);
+        std::vsnprintf(buf, sizeof(buf), fmt, args);
+        va_end(args);
+        return buf;
+    }
+
+    /// a Nastran mesh with long field GRID* cards and fixed field CTETRA cards
+    static std::string nastranLongField()
+    {
+        std::string content = "$ generated\nBEGIN BULK\n";
+        for (int i = 1; i <= numNodes; i++) {
+            content += format("GRID*   %16d%16s%16.6f%16.6f*N%d\n*N%-6d%16.6f\n",
+                              i,
+                              "",
+                              0.5 * i,
+                              1.0,
+                              i,
+                              i,
+                              2.0);
+        }
+        for (int i = 1; i <= numElements; i++) {
+            int n = 10 * (i - 1);
+            content += format("CTETRA  %8d%8d%8d%8d%8d%8d%8d%8d+E%d\n+E%-6d%8d%8d%8d%8d\n",
+                              i,
+                              1,
+                              n + 1,
+                              n + 2,
+                              n + 3,
+                              n + 4,
+                              n + 5,
+                              n + 6,
+                              i,
+                              i,
+                              n + 7,
+                              n + 8,
+                              n + 9,
+                              n + 10);
+        }
+        content += "ENDDATA\n";
+        return content;
+    }
+
+    /// a Nastran mesh with free field cards
+    static std::string nastranFreeField()
+    {
+        std::string content = "BEGIN BULK\n";
+        for (int i = 1; i <= numNodes; i++) {
+            content += format("GRID,%d,0,%f,%f,%f\n", i, 0.5 * i, 1.0, 2.0);
+        }
+        for (int i = 1; i <= numElements; i++) {
+            int n = 10 * (i - 1);
+            content += format("CTETRA,%d,1,%d,%d,%d,%d,%d,%d,+\n+,%d,%d,%d,%d\n",
+                              i,
+                              n + 1,
+                              n + 2,
+                              n + 3,
+                              n + 4,
+                              n + 5,
+                              n + 6,
+                              n + 7,
+                              n + 8,
+                              n + 9,
+                              n + 10);
+        }
+        content += "ENDDATA\n";
+        return content;
+    }
+
+    /// a NASTRAN-95 mesh with single line GRID cards and two line CHEXA1 cards
+    static std::string nastran95()
+    {
+        std::string content = "BEGIN BULK\n";
+        for (int i = 1; i <= numNodes; i++) {
+            content += format("GRID    %8d        %8.2f%8.2f%8.2f\n", i, 0.5 * i, 1.0, 2.0);
+        }
+        for (int i = 1; i <= numElements; i++) {
+            int n = 10 * (i - 1);
+            content += format("CHEXA1  %8d     200%8d%8d%8d%8d%8d%8d+SOL1\n+SOL1   %8d%8d\n",
+                              i,
+                              n + 1,
+                              n + 2,
+                              n + 3,
+                              n + 4,
+                              n + 5,
+                              n + 6,
+                              n + 7,
+                              n + 8);
+        }
+        content += "ENDDATA\n";
+        return content;
+    }
+
+    /// reads the file with the default sizes and with \a block and \a minChunk
+    template<typename Reader>
+    void readInChunks(std::size_t block, std::size_t minChunk) const
+    {
+        Fem::FemMeshData sequential;
+        Reader().read(getFileName(), sequential);
+
+        Fem::FemMeshData chunked;
+        Reader reader;
+        reader.setBlockSize(block, minChunk);
+        reader.read(getFileName(), chunked);
+
+        EXPECT_EQ(sequential.countNodes(), numNodes);
+        EXPECT_EQ(sequential.countElements(), numElements);
+        EXPECT_EQ(chunked.countNodes(), sequential.countNodes());
+        EXPECT_EQ(chunked.countElements(), sequential.countElements());
+    }
+
+private:
+    Base::FileInfo tmp;
+};
+
+TEST_F(FemMeshReaderTest, nastranLongFieldInChunks)
+{
+    // Arrange
+    writeFile(nastranLongField());
+
+    // Act / Assert
+    readInChunks<Fem::FemMeshNastranReader>(4096, 256);
+}
+
+TEST_F(FemMeshReaderTest, nastranLongFieldRecordLargerThanBlock)
+{
+    // Arrange
+    writeFile(nastranLongField());
+
+    // Act / Assert
+    readInChunks<Fem::FemMeshNastranReader>(16, 1);
+}
+
+TEST_F(FemMeshReaderTest, nastranFreeFieldInChunks)
+{
+    // Arrange
+    writeFile(nastranFreeField());
+
+    // Act / Assert
+    readInChunks<Fem::FemMeshNastranReader>(4096, 256);
+}
+
+TEST_F(FemMeshReaderTest, nastran95InChunks)
+{
+    // Arrange
+    writeFile(nastran95());
+
+    // Act / Assert
+    readInChunks<Fem::FemMeshNastran95Reader>(4096, 256);
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-vararg)
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
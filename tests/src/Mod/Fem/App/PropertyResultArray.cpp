@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+#include <Mod/Fem/App/PropertyResultArray.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class PropertyResultArrayTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    /// saves \a from as pure XML, like the Content attribute in Python, and restores it into \a to
+    static void roundTripXML(const Fem::PropertyResultArray& from, Fem::PropertyResultArray& to)
+    {
+        Base::StringWriter writer;
+        writer.setForceXML(true);
+        writer.Stream() << "<Content>" << std::endl;
+        from.Save(writer);
+        writer.Stream() << "</Content>";
+
+        std::istringstream stream(writer.getString());
+        Base::XMLReader reader("", stream);
+        reader.readElement("Content");
+        to.Restore(reader);
+    }
+};
+
+TEST_F(PropertyResultArrayTest, restoreForcedXMLVectors)
+{
+    // Arrange
+    Fem::PropertyResultArray prop;
+    std::vector<Base::Vector3d> vectors {Base::Vector3d(1.0, 2.0, 3.0),
+                                         Base::Vector3d(-4.0, 5.5, 1.0 / 3.0)};
+    prop.setValues(
+        Fem::PropertyResultArray::makeValues(vectors, Fem::PropertyResultArray::Float64));
+    Fem::PropertyResultArray restored;
+
+    // Act
+    roundTripXML(prop, restored);
+
+    // Assert
+    EXPECT_EQ(restored.getComponents(), 3);
+    EXPECT_EQ(restored.getVectors(), vectors);
+    EXPECT_TRUE(restored.isSame(prop));
+}
+
+TEST_F(PropertyResultArrayTest, restoreForcedXMLSinglePrecision)
+{
+    // Arrange
+    Fem::PropertyResultArray prop;
+    std::vector<double> scalars {1.5, 2.0, 0.1, -3.25};
+    prop.setValues(
+        Fem::PropertyResultArray::makeValues(scalars, Fem::PropertyResultArray::Float32));
+    Fem::PropertyResultArray restored;
+
+    // Act
+    roundTripXML(prop, restored);
+
+    // Assert
+    EXPECT_EQ(restored.getValues()->type, Fem::PropertyResultArray::Float32);
+    EXPECT_EQ(restored.getSize(), 4);
+    EXPECT_TRUE(restored.isSame(prop));
+}
+
+TEST_F(PropertyResultArrayTest, restoreForcedXMLEmpty)
+{
+    // Arrange
+    Fem::PropertyResultArray prop;
+    Fem::PropertyResultArray restored;
+    restored.setValues(Fem::PropertyResultArray::makeValues(std::vector<double> {1.0},
+                                                            Fem::PropertyResultArray::Float64));
+
+    // Act
+    roundTripXML(prop, restored);
+
+    // Assert
+    EXPECT_EQ(restored.getSize(), 0);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
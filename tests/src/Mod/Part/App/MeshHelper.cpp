@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Part/App/MeshHelper.h>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+int countTriangles(const TopoDS_Shape& shape)
+{
+    int count = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (!mesh.IsNull()) {
+            count += mesh->NbTriangles();
+        }
+    }
+    return count;
+}
+}  // namespace
+
+TEST(MeshHelper, meshShape)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+
+    // Act
+    bool before = Part::MeshHelper::isMeshed(cylinder, 0.1);
+    Part::MeshHelper::mesh(cylinder, 0.1, 0.5);
+
+    // Assert
+    EXPECT_FALSE(before);
+    EXPECT_TRUE(Part::MeshHelper::isMeshed(cylinder, 0.1));
+    EXPECT_GT(countTriangles(cylinder), 0);
+}
+
+TEST(MeshHelper, finerMeshServesCoarserRequest)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+    Part::MeshHelper::mesh(cylinder, 0.01, 0.5);
+    int fine = countTriangles(cylinder);
+
+    // Act
+    Part::MeshHelper::mesh(cylinder, 0.5, 0.5);
+
+    // Assert
+    EXPECT_EQ(countTriangles(cylinder), fine);
+    EXPECT_TRUE(Part::MeshHelper::isMeshed(cylinder, 0.5));
+    EXPECT_FALSE(Part::MeshHelper::isMeshed(cylinder, 0.5, true));
+}
+
+TEST(MeshHelper, exactMeshReplacesFinerOne)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+    Part::MeshHelper::mesh(cylinder, 0.01, 0.5);
+    int fine = countTriangles(cylinder);
+
+    // Act
+    Part::MeshHelper::mesh(cylinder, 0.5, 0.5, true);
+
+    // Assert
+    EXPECT_LT(countTriangles(cylinder), fine);
+    EXPECT_TRUE(Part::MeshHelper::isMeshed(cylinder, 0.5, true));
+}
+
+TEST(MeshHelper, coarserMeshIsRefined)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+    Part::MeshHelper::mesh(cylinder, 0.5, 0.5);
+    int coarse = countTriangles(cylinder);
+
+    // Act
+    Part::MeshHelper::mesh(cylinder, 0.01, 0.5);
+
+    // Assert
+    EXPECT_GT(countTriangles(cylinder), coarse);
+}
+
+TEST(MeshHelper, freeEdgeOfMeshedCompound)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+    TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(gp_Pnt(0.0, 0.0, 30.0), gp_Pnt(10.0, 0.0, 30.0));
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    builder.Add(compound, cylinder);
+    builder.Add(compound, edge);
+    Part::MeshHelper::mesh(cylinder, 0.1, 0.5);
+
+    // Act
+    bool before = Part::MeshHelper::isMeshed(compound, 0.1);
+    Part::MeshHelper::mesh(compound, 0.1, 0.5);
+
+    // Assert
+    TopLoc_Location loc;
+    EXPECT_FALSE(before);
+    EXPECT_FALSE(BRep_Tool::Polygon3D(edge, loc).IsNull());
+    EXPECT_TRUE(Part::MeshHelper::isMeshed(compound, 0.1));
+}
+
+TEST(MeshHelper, shapeWithoutFaces)
+{
+    // Arrange
+    TopoDS_Shape vertex = BRepBuilderAPI_MakeVertex(gp_Pnt(1.0, 2.0, 3.0)).Shape();
+
+    // Act
+    double deflection = Part::MeshHelper::relativeDeflection(vertex, 0.5);
+
+    // Assert
+    EXPECT_GT(deflection, 0.0);
+    EXPECT_FALSE(Part::MeshHelper::isMeshed(vertex, deflection));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)